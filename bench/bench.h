@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------
+// bench.h
+//----------------------------------------------------------------------------
+//
+//  Minimal timing helpers shared by the bench_*.c programs. Each bench is
+//  a standalone executable linked against libswingame and the headless
+//  backend; see the Makefile's bench target.
+//
+//----------------------------------------------------------------------------
+
+#ifndef Bench
+#define Bench
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+// Monotonic nanoseconds since an arbitrary epoch
+static inline uint64_t bench_now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Prints one result line: name, iterations, ns per iteration, rate
+static inline void bench_report(const char *name, uint64_t iterations, uint64_t elapsed)
+{
+    double perIter = iterations ? (double)elapsed / iterations : 0;
+    printf("%-40s %10llu iters %12.1f ns/iter %14.0f /s\n", name,
+           (unsigned long long)iterations, perIter, perIter > 0 ? 1e9 / perIter : 0);
+}
+
+// Keeps a computed value alive so the optimiser cannot drop the work
+static volatile uint64_t bench_sink;
+
+#endif
@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------
+// bench_atlas.c
+//----------------------------------------------------------------------------
+//
+//  Packs the sprites' images into an atlas as DDBitmapCache packAtlas does
+//  and reports how they were placed, then draws a frame of many darts
+//  with some clouds, health packs and the balloon, first one bitmap per
+//  draw as DDSprite draw does, then gathered in a DDBatch from the atlas
+//  sheet. Checks that both frames come out the same, pixel for pixel.
+//
+//  The headless backend has no per-draw driver cost and both paths end
+//  in the same blit, and here the batch comes out slower (gathering and
+//  flushing cost more than they save), which is why the game draws each
+//  sprite from its own bitmap unless DD_ATLAS is set. Natively the batch
+//  would save one Objective-C wrapper call per sprite and keep every
+//  draw on one texture.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Graphics.h"
+#include "Images.h"
+#include "SGHeadless.h"
+
+#include "DDAtlas.h"
+
+#define FRAMES      500
+#define DARTS       300
+#define IMAGES      6
+
+static const char *names[IMAGES] = { "background.png", "balloon.png", "dart.png",
+                                     "health.png", "cloudL.png", "cloudR.png" };
+
+// One sprite of the frame: which image, and where
+typedef struct placed
+{
+    int     image;
+    float   x, y;
+} placed;
+
+int main()
+{
+    bitmap          images[IMAGES];
+    DDAtlasRegion   regions[IMAGES];
+    DDAtlas         atlas;
+    DDBatch         batch;
+    placed          frame[DARTS + 5];
+    int             count = 0;
+
+    sg_Headless_SetResourcePath("Resources");
+    open_graphics_window("Dart Dodger", 400, 600);
+
+    for (int i = 0; i < IMAGES; i++) images[i] = load_bitmap_named(names[i], names[i]);
+
+    dd_atlas_init(&atlas);
+    uint64_t start = bench_now();
+    int packed = dd_atlas_pack(&atlas, images, IMAGES, regions);
+    bench_report("pack atlas", 1, bench_now() - start);
+    printf("  %d of %d images on %d sheet(s) of %d x %d\n", packed, IMAGES, atlas.sheetCount,
+           DD_ATLAS_SHEET_SIZE, DD_ATLAS_SHEET_SIZE);
+    for (int i = 0; i < IMAGES; i++)
+    {
+        if (regions[i].sheet)
+            printf("    %-16s at %4.0f,%4.0f\n", names[i], regions[i].source.x, regions[i].source.y);
+        else
+            printf("    %-16s drawn by itself\n", names[i]);
+    }
+
+    // The canvas' order: background, balloon, darts, health, clouds
+    srand(1);
+    frame[count++] = (placed){ 0, 0, -300 };
+    frame[count++] = (placed){ 1, 163, 440 };
+    for (int i = 0; i < DARTS; i++)
+        frame[count++] = (placed){ 2, rand() % 400, rand() % 700 - 100 };
+    frame[count++] = (placed){ 3, 60, 200 };
+    frame[count++] = (placed){ 4, -30, 120 };
+    frame[count++] = (placed){ 5, 250, 320 };
+
+    size_t screenBytes = (size_t)400 * 600 * sizeof(uint32_t);
+    uint32_t *direct = malloc(screenBytes);
+
+    start = bench_now();
+    for (int f = 0; f < FRAMES; f++)
+    {
+        for (int i = 0; i < count; i++)
+            draw_bitmap(images[frame[i].image], frame[i].x, frame[i].y);
+    }
+    bench_report("one bitmap per draw", (uint64_t)FRAMES * count, bench_now() - start);
+    printf("  %d source bitmaps\n", IMAGES);
+    memcpy(direct, sg_Headless_Pixels(sg_Headless_Screen()), screenBytes);
+
+    clear_screen();
+    dd_batch_init(&batch);
+    start = bench_now();
+    for (int f = 0; f < FRAMES; f++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            const placed *p = &frame[i];
+            if (regions[p->image].sheet) { dd_batch_add(&batch, &regions[p->image], p->x, p->y); }
+            else
+            {
+                dd_batch_flush(&batch);
+                draw_bitmap(images[p->image], p->x, p->y);
+            }
+        }
+        dd_batch_flush(&batch);
+    }
+    bench_report("batched from the atlas", (uint64_t)FRAMES * count, bench_now() - start);
+    printf("  %d source bitmaps, %.1f flushes/frame\n", atlas.sheetCount + IMAGES - packed,
+           (double)batch.flushes / FRAMES);
+
+    int same = memcmp(direct, sg_Headless_Pixels(sg_Headless_Screen()), screenBytes) == 0;
+    printf("  frames %s\n", same ? "match" : "DIFFER");
+
+    free(direct);
+    dd_atlas_free(&atlas);
+    return same ? 0 : 1;
+}
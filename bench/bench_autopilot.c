@@ -0,0 +1,166 @@
+//----------------------------------------------------------------------------
+// bench_autopilot.c
+//----------------------------------------------------------------------------
+//
+//  Plays a cut-down game (darts falling on the balloon's outer triangle,
+//  wrapping around the screen as DDBalloon does) in the round 8+ regime
+//  of 30 darts at speed 7, steered by the autopilot, by a random policy
+//  like the farm's and by no one, to show how much longer the autopilot
+//  survives; then times one dd_autopilot_steer call against a full
+//  screen of darts, which DDGame autopilotKeys makes every tick.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include "Geometry.h"
+#include "DDAutopilot.h"
+#include "DDRandom.h"
+
+#define SCREEN_WIDTH    400
+#define SCREEN_HEIGHT   600
+#define BALLOON_WIDTH   74
+#define BALLOON_HEIGHT  109
+#define DART_HEIGHT     58
+#define DARTS           30
+#define SPEED           7
+#define GAMES           100
+#define MAX_TICKS       (60 * 60 * 5)   // Five minutes a game
+#define STEERS          100000
+
+enum { POLICY_BOT, POLICY_RANDOM, POLICY_IDLE };
+
+// Puts a dart (by its bottom centre) at a random spot above the screen
+static void respawn(DDRandom *rng, point2d *dart)
+{
+    dart->x = (float)dd_random_upto(rng, SCREEN_WIDTH);
+    dart->y = -100.0f - dd_random_upto(rng, 200) + DART_HEIGHT / 2;
+}
+
+// The balloon's outer triangle with its left edge at x, shifted by dx
+static triangle balloon_at(float x, float dx)
+{
+    float y = SCREEN_HEIGHT / 2 - BALLOON_HEIGHT / 2;
+    return triangle_from(x + dx, y + BALLOON_HEIGHT / 2,
+                         x + dx + BALLOON_WIDTH / 2, y,
+                         x + dx + BALLOON_WIDTH, y + BALLOON_HEIGHT / 2);
+}
+
+// Plays a game to its first hit; returns the ticks survived
+static int play(int policy, uint32_t seed)
+{
+    DDRandom rng, playerRng;
+    DDAutopilotView view;
+    point2d darts[DARTS];
+    float x = SCREEN_WIDTH / 2 - BALLOON_WIDTH / 2;
+    int steer = 0, holdFor = 0, held = 0;
+
+    dd_random_seed(&rng, seed);
+    dd_random_seed(&playerRng, ~seed);
+    // Spread the first darts out as far as the ones that follow will be
+    for (int i = 0; i < DARTS; i++)
+    {
+        respawn(&rng, &darts[i]);
+        darts[i].y -= dd_random_upto(&rng, SCREEN_HEIGHT + DART_HEIGHT);
+    }
+
+    for (int tick = 0; tick < MAX_TICKS; tick++)
+    {
+        // Pick a way to move, as DDController would from the keys
+        if (policy == POLICY_BOT)
+        {
+            view.balloon        = balloon_at(x, 0);
+            view.speed          = SPEED;
+            view.screenWidth    = SCREEN_WIDTH;
+            view.hasHealth      = 0;
+            view.dartCount      = DARTS;
+            for (int i = 0; i < DARTS; i++) { view.darts[i] = darts[i]; }
+            steer = dd_autopilot_steer(&view, steer);
+        }
+        else if (policy == POLICY_RANDOM)
+        {
+            if (--holdFor <= 0)
+            {
+                held    = dd_random_upto(&playerRng, 3) - 1;
+                holdFor = 10 + dd_random_upto(&playerRng, 50);
+            }
+            steer = held;
+        }
+
+        // Move, wrapping around the screen
+        x += steer * SPEED;
+        if (x < 0)             { x += SCREEN_WIDTH; }
+        if (x >= SCREEN_WIDTH) { x -= SCREEN_WIDTH; }
+
+        // Test every dart against the balloon and its duplicate...
+        triangle shown[3] = { balloon_at(x, 0), balloon_at(x, -SCREEN_WIDTH),
+                              balloon_at(x, SCREEN_WIDTH) };
+        for (int i = 0; i < DARTS; i++)
+        {
+            for (int t = 0; t < 3; t++)
+            {
+                if (point_in_triangle(&darts[i], &shown[t])) { return tick; }
+            }
+        }
+
+        // ...then let them fall
+        for (int i = 0; i < DARTS; i++)
+        {
+            darts[i].y += SPEED;
+            if (darts[i].y > SCREEN_HEIGHT + DART_HEIGHT) { respawn(&rng, &darts[i]); }
+        }
+    }
+    return MAX_TICKS;
+}
+
+int main()
+{
+    static const char *names[] = { "autopilot", "random", "idle" };
+    double mean[3];
+
+    for (int policy = POLICY_BOT; policy <= POLICY_IDLE; policy++)
+    {
+        uint64_t ticks = 0, start = bench_now();
+        int longest = 0;
+        for (uint32_t seed = 1; seed <= GAMES; seed++)
+        {
+            int survived = play(policy, seed);
+            ticks += survived;
+            if (survived > longest) { longest = survived; }
+        }
+        uint64_t elapsed = bench_now() - start;
+
+        char name[64];
+        snprintf(name, sizeof name, "tick, %s", names[policy]);
+        bench_report(name, ticks, elapsed);
+        mean[policy] = (double)ticks / GAMES;
+        printf("  survived %.1f s on average, %.1f s at most (of %d s)\n",
+               mean[policy] / 60, longest / 60.0, MAX_TICKS / 60);
+    }
+
+    // A full screen of darts, spread over the balloon's path
+    DDAutopilotView view;
+    DDRandom rng;
+    dd_random_seed(&rng, 1);
+    view.balloon        = balloon_at(SCREEN_WIDTH / 2 - BALLOON_WIDTH / 2, 0);
+    view.speed          = SPEED;
+    view.screenWidth    = SCREEN_WIDTH;
+    view.hasHealth      = 0;
+    view.dartCount      = DARTS;
+    for (int i = 0; i < DARTS; i++)
+    {
+        view.darts[i].x = (float)dd_random_upto(&rng, SCREEN_WIDTH);
+        view.darts[i].y = (float)dd_random_upto(&rng, SCREEN_HEIGHT / 2) - 100;
+    }
+
+    int steer = 0;
+    uint64_t start = bench_now();
+    for (int i = 0; i < STEERS; i++)
+    {
+        steer = dd_autopilot_steer(&view, steer);
+        bench_sink += steer + 1;
+    }
+    bench_report("dd_autopilot_steer, 30 darts", STEERS, bench_now() - start);
+
+    return mean[POLICY_BOT] > mean[POLICY_RANDOM] ? 0 : 1;
+}
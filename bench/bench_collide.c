@@ -0,0 +1,252 @@
+//----------------------------------------------------------------------------
+// bench_collide.c
+//----------------------------------------------------------------------------
+//
+//  Tests a field of darts against the balloon's two triangle masks and a
+//  health kit, first one dart at a time through the SwinGame geometry
+//  calls (what DDDart and DDBalloon collideWithSprite: do) and then in
+//  one pass with the DDCollisionKernel batch tests, through each kernel
+//  the CPU supports. Every pass is checked against the per-dart answers.
+//
+//  Then points on each edge and vertex of a few triangles (and of some
+//  random ones), and a float step either side, are tested through each
+//  kernel and checked against both point_in_triangle and a model of the
+//  native library's PointInTriangle. Any mismatch fails the bench.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Geometry.h"
+#include "Utils.h"
+#include "SGHeadless.h"
+#include "DDCollisionKernel.h"
+
+#define ROUNDS      20000
+#define DARTS       256
+#define EDGE_STEPS  64
+#define EDGE_TRIS   100
+
+// Per-dart path: centre bottom of each dart against the balloon, and the
+// health kit's centre bottom against each dart
+static void per_dart(const rectangle *darts, int count, const triangle *inner,
+                     const triangle *outer, const rectangle *health,
+                     uint64_t *balloonHits, uint64_t *healthHits)
+{
+    point2d healthPoint = rectangle_center_bottom(health);
+
+    for (int i = 0; i < count; i++)
+    {
+        point2d dartPoint = rectangle_center_bottom(&darts[i]);
+        if (point_in_triangle(&dartPoint, inner) || point_in_triangle(&dartPoint, outer))
+            balloonHits[i / 64] |= 1ull << (i % 64);
+        if (point_in_rect(&healthPoint, &darts[i]))
+            healthHits[i / 64] |= 1ull << (i % 64);
+    }
+}
+
+// Batch path, through whichever kernel is in use
+static void batch(const DDRectBatch *darts, const triangle *inner, const triangle *outer,
+                  const point2d *healthPoint, uint64_t *balloonHits, uint64_t *healthHits)
+{
+    dd_rect_batch_bottoms_in_triangle(darts, darts->count, inner, balloonHits);
+    dd_rect_batch_bottoms_in_triangle(darts, darts->count, outer, balloonHits);
+    dd_rect_batch_containing_point(darts, darts->count, healthPoint, healthHits);
+}
+
+// SwinGame's native PointInTriangle as the i386 SGSDK library computes it:
+// the dot products are floats, but the denominator, the numerators and u + v
+// stay in x87 extended precision, and only 1 / denom, u and v are rounded to
+// float. long double is x87 extended on x86; elsewhere this checks less.
+typedef long double extended;
+
+static int native_point_in_triangle(const point2d *pt, const triangle *tri)
+{
+    float v0x = tri->points[2].x - tri->points[0].x, v0y = tri->points[2].y - tri->points[0].y;
+    float v1x = tri->points[1].x - tri->points[0].x, v1y = tri->points[1].y - tri->points[0].y;
+    float v2x = pt->x - tri->points[0].x, v2y = pt->y - tri->points[0].y;
+
+    float a = v0x * v0x + v0y * v0y, b = v0x * v1x + v0y * v1y, c = v0x * v2x + v0y * v2y;
+    float d = v1x * v1x + v1y * v1y, e = v1x * v2x + v1y * v2y;
+    float inverse = (float)(1 / ((extended)a * d - (extended)b * b));
+    float u = (float)(((extended)d * c - (extended)b * e) * inverse);
+    float v = (float)(((extended)a * e - (extended)b * c) * inverse);
+    return u > 0 && v > 0 && (extended)u + v < 1;
+}
+
+// Point on the edge from p to q at step k of EDGE_STEPS, then nudged a float
+// step toward -x/+x and -y/+y by dx and dy (-1, 0 or 1)
+static point2d edge_point(point2d p, point2d q, int k, int dx, int dy)
+{
+    float s = (float)k / EDGE_STEPS;
+    point2d pt = { p.x + s * (q.x - p.x), p.y + s * (q.y - p.y) };
+    if (dx) pt.x = nextafterf(pt.x, dx * INFINITY);
+    if (dy) pt.y = nextafterf(pt.y, dy * INFINITY);
+    return pt;
+}
+
+// Tests the edge points of tri through the kernel in use, a batch at a time,
+// counting the points at which it, point_in_triangle and the native formula
+// don't all agree
+static int edge_mismatches(const triangle *tri, int *points)
+{
+    static DDRectBatch  edgeBatch;
+    static point2d      pts[DD_RECT_BATCH_CAPACITY];
+    uint64_t            hits[DD_HIT_MASK_WORDS];
+    int                 mismatched = 0;
+
+    dd_rect_batch_clear(&edgeBatch);
+    for (int edge = 0; edge < 3; edge++)
+    {
+        for (int k = 0; k <= EDGE_STEPS; k++)
+        {
+            for (int n = 0; n < 9; n++)
+            {
+                // A dart with no width or height has the point as its centre bottom
+                int i = edgeBatch.count;
+                pts[i] = edge_point(tri->points[edge], tri->points[(edge + 1) % 3], k,
+                                    n % 3 - 1, n / 3 - 1);
+                rectangle dart = { pts[i].x, pts[i].y, 0, 0 };
+                dd_rect_batch_add(&edgeBatch, &dart);
+
+                int last = edge == 2 && k == EDGE_STEPS && n == 8;
+                if (edgeBatch.count < DD_RECT_BATCH_CAPACITY && !last) continue;
+
+                dd_hit_mask_clear(hits, edgeBatch.count);
+                dd_rect_batch_bottoms_in_triangle(&edgeBatch, edgeBatch.count, tri, hits);
+                for (int j = 0; j < edgeBatch.count; j++)
+                {
+                    int expected = point_in_triangle(&pts[j], tri);
+                    if (dd_hit_mask_test(hits, j) != expected ||
+                        native_point_in_triangle(&pts[j], tri) != expected) mismatched++;
+                }
+                *points += edgeBatch.count;
+                dd_rect_batch_clear(&edgeBatch);
+            }
+        }
+    }
+    return mismatched;
+}
+
+int main()
+{
+    static rectangle    darts[DARTS];
+    static DDRectBatch  dartBatch;
+    uint64_t            expectBalloon[DD_HIT_MASK_WORDS] = { 0 };
+    uint64_t            expectHealth[DD_HIT_MASK_WORDS]  = { 0 };
+    uint64_t            balloonHits[DD_HIT_MASK_WORDS];
+    uint64_t            healthHits[DD_HIT_MASK_WORDS];
+
+    sg_Headless_SeedRandom(7);
+
+    // Balloon masks as DDBalloon builds them for a 66x100 balloon at (167, 400)
+    float bx = 167, by = 400, bw = 66, bh = 100;
+    triangle inner = { { { bx + 17, by + bh / 2 }, { bx + bw / 2, by + 17 * 1.7f },
+                         { bx + bw - 17, by + bh / 2 } } };
+    triangle outer = { { { bx, by + bh / 2 }, { bx + bw / 2, by }, { bx + bw, by + bh / 2 } } };
+    rectangle health = rectangle_from(180, 380, 30, 30);
+    point2d healthPoint = rectangle_center_bottom(&health);
+
+    // Darts bunched around the balloon so that both paths see hits and misses
+    dd_rect_batch_clear(&dartBatch);
+    for (int i = 0; i < DARTS; i++)
+    {
+        darts[i] = rectangle_from(120 + rnd_upto(160), 300 + rnd_upto(200), 9, 40);
+        dd_rect_batch_add(&dartBatch, &darts[i]);
+    }
+
+    per_dart(darts, DARTS, &inner, &outer, &health, expectBalloon, expectHealth);
+
+    uint64_t checksum = 0;
+    uint64_t start = bench_now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        memset(balloonHits, 0, sizeof(balloonHits));
+        memset(healthHits, 0, sizeof(healthHits));
+        per_dart(darts, DARTS, &inner, &outer, &health, balloonHits, healthHits);
+        checksum += balloonHits[r % DD_HIT_MASK_WORDS] ^ healthHits[r % DD_HIT_MASK_WORDS];
+    }
+    bench_report("per-dart (256 darts, 3 tests)", ROUNDS, bench_now() - start);
+
+    // Edge cases: the balloon's masks, a right triangle, a skewed one at
+    // fractional coordinates and a tiny one
+    triangle edgeTris[] = {
+        inner,
+        outer,
+        { { { 0, 0 }, { 0, 100 }, { 100, 0 } } },
+        { { { 10.5f, 3.25f }, { 300.75f, 47.5f }, { -20.125f, 210 } } },
+        { { { 0.1f, 0.2f }, { 0.7f, 0.3f }, { 0.3f, 0.9f } } },
+    };
+    int edgeTriCount = (int)(sizeof edgeTris / sizeof edgeTris[0]);
+
+    // Random triangles on the screen, at whole and fractional coordinates
+    static triangle randomTris[EDGE_TRIS];
+    for (int t = 0; t < EDGE_TRIS; t++)
+    {
+        for (int p = 0; p < 3; p++)
+        {
+            randomTris[t].points[p].x = rnd_upto(3200) / 4.0f + (rnd_upto(2) ? 0.1f : 0);
+            randomTris[t].points[p].y = rnd_upto(2400) / 4.0f + (rnd_upto(2) ? 0.3f : 0);
+        }
+    }
+
+    DDCollisionKernel best = dd_collision_kernel();
+    int mismatched = 0, edgePoints = 0;
+    for (int k = DDCOLLISION_SCALAR; k <= DDCOLLISION_AVX; k++)
+    {
+        if (dd_collision_use_kernel((DDCollisionKernel)k) != 0) continue;
+
+        start = bench_now();
+        for (int r = 0; r < ROUNDS; r++)
+        {
+            dd_hit_mask_clear(balloonHits, DARTS);
+            dd_hit_mask_clear(healthHits, DARTS);
+            batch(&dartBatch, &inner, &outer, &healthPoint, balloonHits, healthHits);
+            checksum += balloonHits[r % DD_HIT_MASK_WORDS] ^ healthHits[r % DD_HIT_MASK_WORDS];
+        }
+        char name[64];
+        snprintf(name, sizeof name, "batch, %s (256 darts, 3 tests)",
+                 dd_collision_kernel_name(k));
+        bench_report(name, ROUNDS, bench_now() - start);
+
+        if (memcmp(balloonHits, expectBalloon, sizeof(balloonHits)) ||
+            memcmp(healthHits, expectHealth, sizeof(healthHits)))
+        {
+            fprintf(stderr, "bench_collide: %s kernel disagrees with the per-dart path\n",
+                    dd_collision_kernel_name(k));
+            mismatched++;
+        }
+
+        int edgeMismatched = 0;
+        edgePoints = 0;
+        for (int t = 0; t < edgeTriCount; t++)
+            edgeMismatched += edge_mismatches(&edgeTris[t], &edgePoints);
+        for (int t = 0; t < EDGE_TRIS; t++)
+            edgeMismatched += edge_mismatches(&randomTris[t], &edgePoints);
+        if (edgeMismatched)
+        {
+            fprintf(stderr, "bench_collide: %s kernel, point_in_triangle and the native "
+                    "formula disagree at %d of %d edge points\n", dd_collision_kernel_name(k),
+                    edgeMismatched, edgePoints);
+            mismatched++;
+        }
+    }
+    dd_collision_use_kernel(best);
+    if (mismatched) return 1;
+
+    int balloonCount = 0, healthCount = 0;
+    for (int i = 0; i < DARTS; i++)
+    {
+        balloonCount += dd_hit_mask_test(expectBalloon, i);
+        healthCount  += dd_hit_mask_test(expectHealth, i);
+    }
+    printf("  %d of %d darts hit the balloon, %d the health kit; dispatches to %s; "
+           "kernels agree, and with the native formula at %d edge points\n",
+           balloonCount, DARTS, healthCount, dd_collision_kernel_name(best), edgePoints);
+    bench_sink = checksum;
+    return 0;
+}
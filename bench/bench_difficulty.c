@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------------
+// bench_difficulty.c
+//----------------------------------------------------------------------------
+//
+//  Looks up the difficulty round for a climbing score three ways: the
+//  nine-branch if/else chain DDGame updateDifficulty used to run every
+//  tick, the compiled DDDifficulty lookup every tick, and the lookup only
+//  when the score leaves the current round (what DDGame does now). The
+//  shipped Resources/difficulty.txt must compile to the built-in rounds,
+//  and every lookup must agree with the chain, or the bench fails.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "DDDifficulty.h"
+
+#define ROUNDS      2000
+#define SCORES      200
+
+// The chain DDGame updateDifficulty used to run
+static DDRound chain(int score)
+{
+    DDRound r;
+    if      (score >= 0  && score <= 9)  { r = (DDRound){ 0,  3,  3, 0.00f, 0.00f }; }
+    else if (score >= 10 && score <= 19) { r = (DDRound){ 10, 4,  3, 0.50f, 0.00f }; }
+    else if (score >= 20 && score <= 29) { r = (DDRound){ 20, 5,  4, 0.10f, 0.10f }; }
+    else if (score >= 30 && score <= 39) { r = (DDRound){ 30, 8,  4, 0.20f, 0.20f }; }
+    else if (score >= 40 && score <= 49) { r = (DDRound){ 40, 10, 5, 0.30f, 0.30f }; }
+    else if (score >= 50 && score <= 59) { r = (DDRound){ 50, 12, 5, 0.50f, 0.50f }; }
+    else if (score >= 60 && score <= 69) { r = (DDRound){ 60, 14, 6, 0.20f, 0.60f }; }
+    else if (score >= 70 && score <= 79) { r = (DDRound){ 70, 18, 7, 0.20f, 0.65f }; }
+    else                                 { r = (DDRound){ 80, 30, 7, 0.20f, 0.65f }; }
+    return r;
+}
+
+static int same_round(const DDRound *a, const DDRound *b)
+{
+    return a->maxDarts == b->maxDarts && a->speed == b->speed &&
+           a->healthChance == b->healthChance && a->cloudChance == b->cloudChance;
+}
+
+int main()
+{
+    static DDDifficulty builtIn, loaded;
+    uint64_t            checksum = 0;
+    int                 low, high;
+
+    dd_difficulty_init(&builtIn);
+    dd_difficulty_init(&loaded);
+    int result = dd_difficulty_load(&loaded, "Resources/difficulty.txt");
+    if (result != DD_DIFFICULTY_LOADED)
+    {
+        fprintf(stderr, "bench_difficulty: Resources/difficulty.txt did not load (%d)\n", result);
+        return 1;
+    }
+    if (loaded.roundCount != builtIn.roundCount ||
+        memcmp(loaded.rounds, builtIn.rounds, builtIn.roundCount * sizeof(DDRound)))
+    {
+        fprintf(stderr, "bench_difficulty: Resources/difficulty.txt differs from the built-in rounds\n");
+        return 1;
+    }
+    for (int score = 0; score < SCORES; score++)
+    {
+        DDRound expect = chain(score);
+        const DDRound *round = dd_difficulty_round_at(&loaded, score, &low, &high);
+        if (!same_round(round, &expect) || score < low || score >= high)
+        {
+            fprintf(stderr, "bench_difficulty: score %d looks up the wrong round\n", score);
+            return 1;
+        }
+    }
+
+    uint64_t start = bench_now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int score = 0; score < SCORES; score++)
+        {
+            DDRound round = chain(score);
+            checksum += round.maxDarts + round.speed;
+        }
+    }
+    bench_report("if/else chain (200 ticks)", ROUNDS, bench_now() - start);
+
+    start = bench_now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int score = 0; score < SCORES; score++)
+        {
+            const DDRound *round = dd_difficulty_round_at(&loaded, score, &low, &high);
+            checksum += round->maxDarts + round->speed;
+        }
+    }
+    bench_report("dense lookup every tick (200 ticks)", ROUNDS, bench_now() - start);
+
+    int lookups = 0;
+    start = bench_now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        DDRound round = { 0 };
+        low = high = 0;
+        for (int score = 0; score < SCORES; score++)
+        {
+            if (score < low || score >= high)
+            {
+                round = *dd_difficulty_round_at(&loaded, score, &low, &high);
+                lookups++;
+            }
+            checksum += round.maxDarts + round.speed;
+        }
+    }
+    bench_report("lookup on round change (200 ticks)", ROUNDS, bench_now() - start);
+
+    printf("  table matches the built-in rounds; %d lookups per 200 ticks\n", lookups / ROUNDS);
+    bench_sink = checksum;
+    return 0;
+}
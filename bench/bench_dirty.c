@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------------
+// bench_dirty.c
+//----------------------------------------------------------------------------
+//
+//  Draws a canvas of the background, a balloon and a few drifting clouds
+//  for a run of frames, first redrawing every sprite each frame, then as
+//  DDCanvas does with a DDDirtyRegion: only the sprites over the rectangles
+//  that changed, each under a clip. Both are run with the background still
+//  (as behind the menu) and scrolling (as in game), where the region goes
+//  over its threshold and every frame falls back to a full redraw.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <string.h>
+
+#include "Geometry.h"
+#include "Graphics.h"
+#include "Images.h"
+#include "SGHeadless.h"
+
+#include "DDDirtyRegion.h"
+
+#define FRAMES      2000
+#define CLOUDS      3
+#define SPRITES     (2 + CLOUDS)
+
+// A sprite as DDCanvas sees it
+typedef struct canvas_sprite
+{
+    bitmap      bmp;
+    float       x, y;
+    rectangle   drawn;
+} canvas_sprite;
+
+static canvas_sprite sprites[SPRITES];
+
+// Moves the clouds (and the background, if scrolling) on one frame
+static void step(int frame, int scrolling)
+{
+    if (scrolling) { sprites[0].y = -600 + (frame * 5) % 600; }
+    for (int i = 2; i < SPRITES; i++)
+    {
+        sprites[i].x = (float)((frame * (i - 1) + i * 97) % 490) - 90;
+    }
+}
+
+static void draw_full()
+{
+    for (int i = 0; i < SPRITES; i++) draw_bitmap(sprites[i].bmp, sprites[i].x, sprites[i].y);
+}
+
+// Returns whether the whole canvas was redrawn
+static int draw_dirty(DDDirtyRegion *dirty)
+{
+    for (int i = 0; i < SPRITES; i++)
+    {
+        rectangle now = rectangle_from(sprites[i].x, sprites[i].y,
+                                       bitmap_width(sprites[i].bmp), bitmap_height(sprites[i].bmp));
+        if (memcmp(&now, &sprites[i].drawn, sizeof(rectangle)) != 0)
+        {
+            dd_dirty_add(dirty, sprites[i].drawn);
+            dd_dirty_add(dirty, now);
+            sprites[i].drawn = now;
+        }
+    }
+
+    int full = dd_dirty_is_full(dirty);
+    if (full) { draw_full(); }
+    else
+    {
+        for (int r = 0; r < dirty->count; r++)
+        {
+            push_clip_rect(&dirty->rects[r]);
+            for (int i = 0; i < SPRITES; i++)
+                if (rectangles_intersect(&sprites[i].drawn, &dirty->rects[r]))
+                    draw_bitmap(sprites[i].bmp, sprites[i].x, sprites[i].y);
+            pop_clip_screen();
+        }
+    }
+    dd_dirty_clear(dirty);
+    return full;
+}
+
+static void run(const char *name, int scrolling, int dirtyRects)
+{
+    DDDirtyRegion dirty;
+    dd_dirty_reset(&dirty, 400, 600);
+    sprites[0].y = -600;
+    for (int i = 0; i < SPRITES; i++) sprites[i].drawn = (rectangle){ 0, 0, 0, 0 };
+
+    int fullFrames = 0;
+    headless_stats before = sg_Headless_Stats();
+    uint64_t start = bench_now();
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        step(frame, scrolling);
+        if (dirtyRects) { fullFrames += draw_dirty(&dirty); }
+        else { draw_full(); fullFrames++; }
+        refresh_screen();
+    }
+    uint64_t elapsed = bench_now() - start;
+    headless_stats after = sg_Headless_Stats();
+    bench_report(name, FRAMES, elapsed);
+    printf("  pixels/frame %llu, full redraws %d\n",
+           (unsigned long long)((after.pixels_written - before.pixels_written) / FRAMES), fullFrames);
+}
+
+int main()
+{
+    sg_Headless_SetResourcePath("Resources");
+    open_graphics_window("Dart Dodger", 400, 600);
+
+    sprites[0] = (canvas_sprite){ load_bitmap_named("background", "background.png"), 0, -600 };
+    sprites[1] = (canvas_sprite){ load_bitmap_named("balloon", "balloon.png"), 163, 440 };
+    for (int i = 2; i < SPRITES; i++)
+    {
+        sprites[i] = (canvas_sprite){ load_bitmap_named("cloud", "cloud.png"), 0, 80.0f + 120 * i };
+    }
+
+    run("full redraw, still background", 0, 0);
+    run("dirty rects, still background", 0, 1);
+    run("full redraw, scrolling background", 1, 0);
+    run("dirty rects, scrolling background", 1, 1);
+    return 0;
+}
@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------------
+// bench_farm.c
+//----------------------------------------------------------------------------
+//
+//  Runs the simulation farm's scheduler over stand-in games of very
+//  uneven length (each a loop of random draws that dies at random, so a
+//  few run far longer than the rest), on one worker and then on every
+//  core, checking that each game was played exactly once. The uneven
+//  lengths are what the workers' stealing evens out. The farm's report
+//  is printed for the run on every core (at least four workers, so the
+//  stealing is exercised even on a single core).
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "DDFarm.h"
+#include "DDRandom.h"
+
+#define GAMES       2000
+
+// A stand-in game: every tick draws some darts, and ends at random
+static void play(uint32_t job, int worker, void *result, void *context)
+{
+    DDFarmGame *game = result;
+    DDRandom rng;
+    uint64_t start = bench_now();
+
+    dd_random_seed(&rng, job + 1);
+    game->seed = job + 1;
+    while (game->ticks < 200000 && dd_random_upto(&rng, 4000) != 0)
+    {
+        int darts = 5 + game->ticks / 600;
+        for (int i = 0; i < darts; i++) bench_sink += dd_random_next(&rng);
+        game->darts += darts;
+        game->ticks++;
+        if (game->ticks % 60 == 0) game->peakScore++;
+    }
+    game->over          = game->ticks < 200000;
+    game->nanoseconds   = bench_now() - start;
+}
+
+static int check(const DDFarmGame *games)
+{
+    for (uint32_t i = 0; i < GAMES; i++)
+        if (games[i].seed != i + 1) return 0;
+    return 1;
+}
+
+int main()
+{
+    DDFarmGame *games = malloc(sizeof(DDFarmGame) * GAMES);
+    DDFarmStats stats;
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores < 4) cores = 4;
+
+    uint64_t start = bench_now();
+    int failed = dd_farm_run(1, GAMES, play, NULL, games, sizeof(DDFarmGame), &stats);
+    bench_report("farm, 1 worker", GAMES, bench_now() - start);
+    printf("  every game played once: %s\n", !failed && check(games) ? "yes" : "NO");
+
+    memset(games, 0xff, sizeof(DDFarmGame) * GAMES);
+    start = bench_now();
+    failed |= dd_farm_run(cores, GAMES, play, NULL, games, sizeof(DDFarmGame), &stats);
+    bench_report("farm, every core", GAMES, bench_now() - start);
+    printf("  every game played once: %s\n", !failed && check(games) ? "yes" : "NO");
+    for (int i = 0; i < stats.workers; i++)
+        printf("  worker %2d: %4u games, %u steals\n", i, stats.jobs[i], stats.steals[i]);
+    dd_farm_report(stdout, games, GAMES, 1000.0f / 60, &stats);
+
+    failed |= !check(games);
+    free(games);
+    return failed ? 1 : 0;
+}
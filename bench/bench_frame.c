@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------
+// bench_frame.c
+//----------------------------------------------------------------------------
+//
+//  Replays the SwinGame calls of one Dart Dodger frame through the C
+//  wrappers: events, background, darts, balloon, collision tests and the
+//  HUD, then a refresh. Reports the cost of a frame and the backend's
+//  counters so later changes can be compared against this baseline.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include "Colors.h"
+#include "Geometry.h"
+#include "Graphics.h"
+#include "Images.h"
+#include "Input.h"
+#include "Text.h"
+#include "Utils.h"
+#include "SGHeadless.h"
+
+#define FRAMES      2000
+#define DARTS       30
+
+int main()
+{
+    point2d darts[DARTS];
+
+    sg_Headless_SetResourcePath("Resources");
+    load_default_colors();
+    open_graphics_window("Dart Dodger", 400, 600);
+
+    bitmap background   = load_bitmap_named("background", "background.png");
+    bitmap balloon      = load_bitmap_named("balloon", "balloon.png");
+    bitmap dart         = load_bitmap_named("dart", "dart.png");
+    font hudFont        = load_font("BitxMap.ttf", 20);
+
+    for (int i = 0; i < DARTS; i++)
+    {
+        darts[i] = point_at(rnd_upto(400), -100 - rnd_upto(600));
+    }
+
+    point2d balloonAt   = point_at(180, 440);
+    uint64_t hits       = 0;
+    uint64_t start      = bench_now();
+
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        process_events();
+        clear_screen();
+        draw_bitmap_at_point_on_screen(background, &(point2d){ 0, 0 });
+
+        rectangle balloonBox = rectangle_from(balloonAt.x, balloonAt.y,
+                                              bitmap_width(balloon), bitmap_height(balloon));
+        triangle balloonTri = triangle_from(balloonAt.x, balloonAt.y + 20,
+                                            balloonAt.x + 40, balloonAt.y + 20,
+                                            balloonAt.x + 20, balloonAt.y + 70);
+
+        for (int i = 0; i < DARTS; i++)
+        {
+            darts[i].y += 4;
+            if (darts[i].y > 600) darts[i] = point_at(rnd_upto(400), -100 - rnd_upto(200));
+
+            rectangle dartBox = rectangle_from(darts[i].x, darts[i].y,
+                                               bitmap_width(dart), bitmap_height(dart));
+            point2d tip = point_at(darts[i].x + bitmap_width(dart) / 2, darts[i].y + bitmap_height(dart));
+            if (point_in_rect(&tip, &balloonBox) && triangle_rectangle_intersect(&balloonTri, &dartBox))
+                hits++;
+
+            draw_bitmap_at_point_on_screen(dart, &darts[i]);
+        }
+
+        draw_bitmap_at_point_on_screen(balloon, &balloonAt);
+        draw_text_on_screen_at_point("SCORE 0000123", ColorWhite, hudFont, &(point2d){ 10, 10 });
+        draw_text_on_screen_at_point("BEST 0004567", ColorWhite, hudFont, &(point2d){ 250, 10 });
+        refresh_screen();
+    }
+
+    uint64_t elapsed = bench_now() - start;
+    headless_stats stats = sg_Headless_Stats();
+
+    bench_report("frame (30 darts, 400x600)", FRAMES, elapsed);
+    printf("  hits %llu, blits %llu, text %llu, pixels/frame %llu, stubs hit %llu\n",
+           (unsigned long long)hits, (unsigned long long)stats.bitmap_draws,
+           (unsigned long long)stats.text_draws,
+           (unsigned long long)(stats.pixels_written / FRAMES),
+           (unsigned long long)stats.unimplemented_calls);
+    bench_sink = hits;
+    return 0;
+}
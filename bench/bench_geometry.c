@@ -0,0 +1,279 @@
+//----------------------------------------------------------------------------
+// bench_geometry.c
+//----------------------------------------------------------------------------
+//
+//  Checks every function in GeometryInline.h against its Geometry.h
+//  counterpart (and so the sgGeometry routine behind it) over random and
+//  awkward inputs (zeros of both signs, tiny and huge values, infinities
+//  and NaNs, negative rectangle sizes, degenerate triangles), requiring
+//  the results to match bit for bit. As the library here may be the
+//  headless backend rather than SGSDK itself, the rectangle builders are
+//  also checked both ways against answers worked out from the native
+//  library's code. Then times a few of them each way. Fails if any
+//  result differs.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Geometry.h"
+#include "GeometryInline.h"
+
+#define CASES       200000
+#define TIMED       1000000
+#define SHOWN       8
+
+static uint64_t checked, mismatched;
+
+static void check_against(const char *name, const char *reference, int same)
+{
+    checked++;
+    if (same) return;
+    if (mismatched++ < SHOWN) printf("  %s differs from %s\n", name, reference);
+}
+
+static void check(const char *name, int same) { check_against(name, "the library", same); }
+
+#define SAME(a, b) (memcmp(&(a), &(b), sizeof(a)) == 0)
+
+#define CHECK(name, inlined, native) \
+    do { __typeof__(inlined) a_ = (inlined), b_ = (native); check(name, SAME(a_, b_)); } while (0)
+
+static float random_unit() { return (float)rand() / (float)RAND_MAX; }
+
+// Mostly ordinary coordinates, sometimes something awkward; finite only
+// where the library casts the result to an integer
+static float coordinate(int finite)
+{
+    static const float awkward[] = { 0.0f, -0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 1e-30f, -1e-30f,
+                                     1e-40f, 3e4f, -3e4f, INFINITY, -INFINITY, NAN };
+    int n = sizeof awkward / sizeof awkward[0] - (finite ? 3 : 0);
+    if (rand() % 8 == 0) return awkward[rand() % n];
+    return (random_unit() - 0.5f) * 2000.0f;
+}
+
+static int32_t size() { return rand() % 8 == 0 ? 0 : rand() % 401 - 200; }
+
+static point2d point(int finite)        { return point_at_inline(coordinate(finite), coordinate(finite)); }
+static vector some_vector(int finite)   { return vector_to_inline(coordinate(finite), coordinate(finite)); }
+
+static rectangle rect(int finite)
+{
+    return rectangle_from_inline(coordinate(finite), coordinate(finite), size(), size());
+}
+
+static triangle tri(int finite)
+{
+    triangle t = {{ point(finite), point(finite), point(finite) }};
+    if (rand() % 8 == 0) t.points[2] = t.points[rand() % 2];    // Degenerate
+    return t;
+}
+
+static matrix2d matrix()
+{
+    matrix2d m;
+    for (int i = 0; i < 9; i++) m.elements[i / 3][i % 3] = coordinate(0);
+    return m;
+}
+
+static void verify()
+{
+    for (int i = 0; i < CASES; i++)
+    {
+        int finite = i % 2;
+        float x = coordinate(finite), y = coordinate(finite), w = coordinate(finite),
+              h = coordinate(finite), s = coordinate(finite);
+        point2d p1 = point(finite), p2 = point(finite);
+        vector v1 = some_vector(finite), v2 = some_vector(finite);
+        rectangle r1 = rect(finite), r2 = rect(finite);
+        triangle t = tri(finite);
+        matrix2d m1 = matrix(), m2 = matrix();
+        int32_t iw = size(), ih = size();
+        bool invert = rand() % 2;
+
+        CHECK("point_at", point_at_inline(x, y), point_at(x, y));
+        CHECK("point_add", point_add_inline(&p1, &p2), point_add(&p1, &p2));
+        CHECK("point_at_start_with_offset", point_at_start_with_offset_inline(&p1, &v1),
+              point_at_start_with_offset(&p1, &v1));
+        CHECK("point_on_point", point_on_point_inline(&p1, &p2), point_on_point(&p1, &p2));
+        CHECK("point_point_distance", point_point_distance_inline(&p1, &p2),
+              point_point_distance(&p1, &p2));
+
+        CHECK("vector_to", vector_to_inline(x, y), vector_to(x, y));
+        CHECK("vector_to_with_invert_y", vector_to_with_invert_y_inline(x, y, invert),
+              vector_to_with_invert_y(x, y, invert));
+        CHECK("vector_to_point", vector_to_point_inline(&p1), vector_to_point(&p1));
+        CHECK("vector_from_points", vector_from_points_inline(&p1, &p2),
+              vector_from_points(&p1, &p2));
+        CHECK("add_vectors", add_vectors_inline(&v1, &v2), add_vectors(&v1, &v2));
+        CHECK("subtract_vectors", subtract_vectors_inline(&v1, &v2), subtract_vectors(&v1, &v2));
+        CHECK("vector_multiply", vector_multiply_inline(&v1, s), vector_multiply(&v1, s));
+        CHECK("invert_vector", invert_vector_inline(&v1), invert_vector(&v1));
+        CHECK("vector_magnitude_sq", vector_magnitude_sq_inline(&v1), vector_magnitude_sq(&v1));
+        CHECK("vector_magnitude", vector_magnitude_inline(&v1), vector_magnitude(&v1));
+        CHECK("dot_product", dot_product_inline(&v1, &v2), dot_product(&v1, &v2));
+        CHECK("vector_is_zero", vector_is_zero_inline(&v1), vector_is_zero(&v1));
+        CHECK("vectors_equal", vectors_equal_inline(&v1, &v2), vectors_equal(&v1, &v2));
+        CHECK("unit_vector", unit_vector_inline(&v1), unit_vector(&v1));
+        CHECK("limit_vector", limit_vector_inline(&v1, fabsf(s)), limit_vector(&v1, fabsf(s)));
+        CHECK("vector_normal", vector_normal_inline(&v1), vector_normal(&v1));
+
+        CHECK("rectangle_from", rectangle_from_inline(x, y, iw, ih), rectangle_from(x, y, iw, ih));
+        CHECK("rectangle_at_point", rectangle_at_point_inline(&p1, iw, ih),
+              rectangle_at_point(&p1, iw, ih));
+        CHECK("rectangle_top", rectangle_top_inline(&r1), rectangle_top(&r1));
+        CHECK("rectangle_bottom", rectangle_bottom_inline(&r1), rectangle_bottom(&r1));
+        CHECK("rectangle_left", rectangle_left_inline(&r1), rectangle_left(&r1));
+        CHECK("rectangle_right", rectangle_right_inline(&r1), rectangle_right(&r1));
+        CHECK("rectangle_center", rectangle_center_inline(&r1), rectangle_center(&r1));
+        CHECK("rectangle_center_top", rectangle_center_top_inline(&r1), rectangle_center_top(&r1));
+        CHECK("rectangle_center_bottom", rectangle_center_bottom_inline(&r1),
+              rectangle_center_bottom(&r1));
+        CHECK("rectangle_center_left", rectangle_center_left_inline(&r1), rectangle_center_left(&r1));
+        CHECK("rectangle_center_right", rectangle_center_right_inline(&r1),
+              rectangle_center_right(&r1));
+        CHECK("rectangle_offset", rectangle_offset_inline(&r1, &v1), rectangle_offset(&r1, &v1));
+        CHECK("rectangles_intersect", rectangles_intersect_inline(&r1, &r2),
+              rectangles_intersect(&r1, &r2));
+        CHECK("point_xyin_rect_xy", point_xyin_rect_xy_inline(p1.x, p1.y, x, y, w, h),
+              point_xyin_rect_xy(p1.x, p1.y, x, y, w, h));
+        CHECK("point_in_rect_xy", point_in_rect_xy_inline(&p1, x, y, w, h),
+              point_in_rect_xy(&p1, x, y, w, h));
+        CHECK("point_xyin_rect", point_xyin_rect_inline(p1.x, p1.y, &r1),
+              point_xyin_rect(p1.x, p1.y, &r1));
+        CHECK("point_in_rect", point_in_rect_inline(&p1, &r1), point_in_rect(&p1, &r1));
+
+        // These cast to integers, which is only defined for finite input
+        if (finite)
+        {
+            CHECK("rectangle_for_points", rectangle_for_points_inline(&p1, &p2),
+                  rectangle_for_points(&p1, &p2));
+            CHECK("rectangle_from_triangle", rectangle_from_triangle_inline(&t),
+                  rectangle_from_triangle(&t));
+            CHECK("intersection", intersection_inline(&r1, &r2), intersection(&r1, &r2));
+        }
+
+        CHECK("triangle_from", triangle_from_inline(x, y, w, h, p1.x, p1.y),
+              triangle_from(x, y, w, h, p1.x, p1.y));
+        CHECK("triangle_from_points", triangle_from_points_inline(&p1, &p2, &t.points[0]),
+              triangle_from_points(&p1, &p2, &t.points[0]));
+        CHECK("triangle_barycenter", triangle_barycenter_inline(&t), triangle_barycenter(&t));
+        CHECK("point_in_triangle", point_in_triangle_inline(&p1, &t), point_in_triangle(&p1, &t));
+        // Its barycentre (inside) and a corner (on an edge, so outside)
+        point2d inside = triangle_barycenter_inline(&t);
+        CHECK("point_in_triangle", point_in_triangle_inline(&inside, &t),
+              point_in_triangle(&inside, &t));
+        CHECK("point_in_triangle", point_in_triangle_inline(&t.points[1], &t),
+              point_in_triangle(&t.points[1], &t));
+
+        CHECK("identity_matrix", identity_matrix_inline(), identity_matrix());
+        CHECK("translation_matrix", translation_matrix_inline(x, y), translation_matrix(x, y));
+        CHECK("translation_matrix_pt", translation_matrix_pt_inline(&p1), translation_matrix_pt(&p1));
+        CHECK("scale_matrix_by_point", scale_matrix_by_point_inline(&p1), scale_matrix_by_point(&p1));
+        CHECK("scale_matrix", scale_matrix_inline(s), scale_matrix(s));
+        CHECK("matrix_multiply", matrix_multiply_inline(&m1, &m2), matrix_multiply(&m1, &m2));
+        CHECK("matrix_multiply_vector", matrix_multiply_vector_inline(&m1, &v1),
+              matrix_multiply_vector(&m1, &v1));
+
+        triangle a = t, b = t;
+        apply_matrix_inline(&m1, &a);
+        apply_matrix(&m1, &b);
+        check("apply_matrix", SAME(a, b));
+        apply_matrix_to_points_inline(&m2, a.points, 3);
+        apply_matrix_to_points(&m2, b.points, 3);
+        check("apply_matrix_to_points", SAME(a, b));
+    }
+    printf("  %llu results compared, %llu differ\n", (unsigned long long)checked,
+           (unsigned long long)mismatched);
+}
+
+// Answers from SGSDK's own RectangleFrom(pt1, pt2) and RectangleFrom(tri):
+// anchored at pt1 and at the triangle's bounds, each size rounded up
+static void verify_known_answers()
+{
+    static const struct { point2d pt1, pt2; rectangle expected; } forPoints[] = {
+        { { 10, 20 },       { 22.3f, 25 },      { 10, 20, 13, 5 } },
+        { { 22.3f, 25 },    { 10, 20 },         { 22.3f, 25, -12, -5 } },   // Reversed
+        { { 0, 0 },         { 12, 7 },          { 0, 0, 12, 7 } },
+        { { 0, 0 },         { 12.5f, -0.5f },   { 0, 0, 13, 0 } },
+        { { -4.25f, 3 },    { -4.25f, 3.01f },  { -4.25f, 3, 0, 1 } },
+    };
+    static const struct { triangle tri; rectangle expected; } fromTriangle[] = {
+        { {{ { 0, 0 }, { 12.3f, 4 }, { 5, -2.5f } }},           { 0, -2.5f, 13, 7 } },
+        { {{ { -3.75f, 10 }, { -0.25f, 2.5f }, { 1, 7 } }},     { -3.75f, 2.5f, 5, 8 } },
+        // The balloon's outer and inner masks, as DDBalloon builds them at (167, 400)
+        { {{ { 167, 450 }, { 200, 400 }, { 233, 450 } }},       { 167, 400, 66, 50 } },
+        { {{ { 184, 450 }, { 200, 400 + 17 * 1.7f }, { 216, 450 } }},
+                                                                { 184, 400 + 17 * 1.7f, 32, 22 } },
+    };
+
+    for (size_t i = 0; i < sizeof forPoints / sizeof forPoints[0]; i++)
+    {
+        rectangle inlined = rectangle_for_points_inline(&forPoints[i].pt1, &forPoints[i].pt2);
+        rectangle native = rectangle_for_points(&forPoints[i].pt1, &forPoints[i].pt2);
+        check_against("rectangle_for_points_inline", "SGSDK", SAME(inlined, forPoints[i].expected));
+        check_against("rectangle_for_points", "SGSDK", SAME(native, forPoints[i].expected));
+    }
+    for (size_t i = 0; i < sizeof fromTriangle / sizeof fromTriangle[0]; i++)
+    {
+        rectangle inlined = rectangle_from_triangle_inline(&fromTriangle[i].tri);
+        rectangle native = rectangle_from_triangle(&fromTriangle[i].tri);
+        check_against("rectangle_from_triangle_inline", "SGSDK",
+                      SAME(inlined, fromTriangle[i].expected));
+        check_against("rectangle_from_triangle", "SGSDK", SAME(native, fromTriangle[i].expected));
+    }
+}
+
+// Times a call each way over the same inputs
+#define TIME(name, setup, inlined, native)                                          \
+    do {                                                                            \
+        setup;                                                                      \
+        uint64_t start = bench_now();                                               \
+        for (int i = 0; i < TIMED; i++) { inlined; }                                \
+        bench_report(name ", inline", TIMED, bench_now() - start);                  \
+        start = bench_now();                                                        \
+        for (int i = 0; i < TIMED; i++) { native; }                                 \
+        bench_report(name ", library", TIMED, bench_now() - start);                 \
+    } while (0)
+
+#define INPUTS  1024
+
+int main()
+{
+    static rectangle rects[INPUTS];
+    static point2d points[INPUTS];
+    static triangle tris[INPUTS];
+    static matrix2d matrices[INPUTS];
+
+    verify_known_answers();
+    verify();
+
+    for (int i = 0; i < INPUTS; i++)
+    {
+        rects[i]    = rect(1);
+        points[i]   = point(1);
+        tris[i]     = tri(1);
+        matrices[i] = matrix();
+    }
+
+    float sum = 0;
+    TIME("rectangle_center", ,
+         sum += rectangle_center_inline(&rects[i % INPUTS]).x,
+         sum += rectangle_center(&rects[i % INPUTS]).x);
+    TIME("point_in_rect", ,
+         sum += point_in_rect_inline(&points[i % INPUTS], &rects[(i + 1) % INPUTS]),
+         sum += point_in_rect(&points[i % INPUTS], &rects[(i + 1) % INPUTS]));
+    TIME("point_in_triangle", ,
+         sum += point_in_triangle_inline(&points[i % INPUTS], &tris[i % INPUTS]),
+         sum += point_in_triangle(&points[i % INPUTS], &tris[i % INPUTS]));
+    TIME("matrix_multiply", matrix2d acc = identity_matrix_inline(),
+         acc = matrix_multiply_inline(&acc, &matrices[i % INPUTS]); sum += acc.elements[0][0],
+         acc = matrix_multiply(&acc, &matrices[i % INPUTS]); sum += acc.elements[0][0]);
+
+    bench_sink += (uint64_t)(sum != sum);
+    return mismatched == 0 ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+//----------------------------------------------------------------------------
+// bench_hud.c
+//----------------------------------------------------------------------------
+//
+//  Draws the in-game HUD (the status bar, score and patches) for a run of
+//  frames where the score goes up about once a second: first formatting
+//  and drawing both strings as text every frame, as DDHud drawWithItems:
+//  does, then as DDHudLabel does, rendering a label's text to a bitmap
+//  only when its value changes and blitting that bitmap every frame.
+//
+//  The headless backend draws text as a flat box per glyph, far cheaper
+//  than a font engine, so the times here understate what re-rendering
+//  costs natively; the number of text renders is the figure to compare.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <stdio.h>
+
+#include "Colors.h"
+#include "Graphics.h"
+#include "Images.h"
+#include "Text.h"
+#include "SGHeadless.h"
+
+#define FRAMES      6000
+#define FRAME_RATE  60
+
+// A retained label as DDHudLabel keeps it
+typedef struct label
+{
+    const char *format;
+    int         value;
+    int         rendered;
+    bitmap      text;
+    float       x, y;
+} label;
+
+static int renders = 0;
+
+static void label_draw(label *l, int value, font fnt)
+{
+    if (!l->rendered || value != l->value)
+    {
+        char text[64];
+        snprintf(text, sizeof(text), l->format, value);
+        if (l->text) free_bitmap(&l->text);
+        l->text     = draw_text_to_bitmap_at_point_with_font_named_and_size(fnt, text, ColorWhite,
+                                                                           ColorTransparent);
+        l->value    = value;
+        l->rendered = 1;
+        renders++;
+    }
+    draw_bitmap(l->text, l->x, l->y);
+}
+
+int main()
+{
+    char text[64];
+
+    sg_Headless_SetResourcePath("Resources");
+    load_default_colors();
+    open_graphics_window("Dart Dodger", 400, 600);
+    font hudFont = load_font("BitxMap.ttf", 20);
+
+    headless_stats before = sg_Headless_Stats();
+    uint64_t start = bench_now();
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        int score = frame / FRAME_RATE, patches = 3 - frame / (FRAMES / 3);
+
+        fill_rectangle_on_screen(ColorBlack, 0, 600 - 35, 400, 35);
+        snprintf(text, sizeof(text), "%d metres", score);
+        draw_text(text, ColorWhite, hudFont, 30, 600 - 30);
+        snprintf(text, sizeof(text), "Patches: %d", patches);
+        draw_text(text, ColorWhite, hudFont, 400 - 120, 600 - 30);
+    }
+    uint64_t elapsed = bench_now() - start;
+    headless_stats after = sg_Headless_Stats();
+    bench_report("text every frame", FRAMES, elapsed);
+    printf("  text draws %llu, pixels/frame %llu\n",
+           (unsigned long long)(after.text_draws - before.text_draws),
+           (unsigned long long)((after.pixels_written - before.pixels_written) / FRAMES));
+
+    label scoreLabel    = { "%d metres",   0, 0, NULL, 30,        600 - 30 };
+    label patchesLabel  = { "Patches: %d", 0, 0, NULL, 400 - 120, 600 - 30 };
+
+    before = sg_Headless_Stats();
+    start = bench_now();
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        int score = frame / FRAME_RATE, patches = 3 - frame / (FRAMES / 3);
+
+        fill_rectangle_on_screen(ColorBlack, 0, 600 - 35, 400, 35);
+        label_draw(&scoreLabel, score, hudFont);
+        label_draw(&patchesLabel, patches, hudFont);
+    }
+    elapsed = bench_now() - start;
+    after = sg_Headless_Stats();
+    bench_report("retained labels (render on change)", FRAMES, elapsed);
+    printf("  text renders %d for %d frames, pixels/frame %llu\n", renders, FRAMES,
+           (unsigned long long)((after.pixels_written - before.pixels_written) / FRAMES));
+
+    bench_sink = renders;
+    return 0;
+}
@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------
+// bench_memory.c
+//----------------------------------------------------------------------------
+//
+//  Plays frames that each allocate a few hundred small temporaries (as the
+//  framework's autoreleased points and rectangles are), freed at the end
+//  of every frame as under a per-frame pool, then kept until the end of
+//  the run as under a single pool around the main loop, and shows what
+//  DDMemoryMonitor makes of each: the high-water mark staying flat in the
+//  first, and climbing in the second. Also times reading the heap's
+//  use, which the monitor does twice a frame.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "DDMemory.h"
+
+#define FRAMES          600
+#define TEMPORARIES     400
+#define TEMPORARY_SIZE  48
+#define READS           100000
+
+// Plays the frames; frees each frame's temporaries with it if scoped
+static void play(DDMemoryMonitor *monitor, int scoped, const char *name)
+{
+    static void *kept[FRAMES * TEMPORARIES];
+    void *frame[TEMPORARIES];
+    int highWaters = 0, count = 0;
+
+    dd_memory_init(monitor, DD_MEMORY_FRAME_BUDGET);
+    size_t base = monitor->highWater;
+    uint64_t start = bench_now();
+    for (int f = 0; f < FRAMES; f++)
+    {
+        int events = dd_memory_frame_begin(monitor);
+        for (int i = 0; i < TEMPORARIES; i++)
+        {
+            void *p = malloc(TEMPORARY_SIZE);
+            bench_sink += (uintptr_t)p;
+            if (scoped) { frame[i] = p; } else { kept[count++] = p; }
+        }
+        events |= dd_memory_frame_end(monitor);
+        if (scoped) { for (int i = 0; i < TEMPORARIES; i++) free(frame[i]); }
+
+        highWaters += (events & DD_MEMORY_HIGH_WATER) != 0;
+    }
+    bench_report(name, FRAMES, bench_now() - start);
+    printf("  high water %zu bytes over the start (%d reports), worst frame %zu bytes "
+           "(%llu over budget)\n", monitor->highWater - base, highWaters, monitor->worstFrame,
+           (unsigned long long)monitor->overBudget);
+
+    for (int i = 0; i < count; i++) free(kept[i]);
+}
+
+int main()
+{
+    DDMemoryMonitor single, scoped;
+    size_t before = dd_memory_in_use();
+
+    uint64_t start = bench_now();
+    for (int i = 0; i < READS; i++) bench_sink += dd_memory_in_use();
+    bench_report("dd_memory_in_use", READS, bench_now() - start);
+
+    // Scoped first, as freeing the kept temporaries all at once leaves
+    // the heap with long free lists for the allocator to count up
+    play(&scoped, 1, "frame, a pool each frame");
+    play(&single, 0, "frame, one pool for the run");
+    size_t singleGrowth = single.highWater - before, scopedGrowth = scoped.highWater - before;
+
+    if (single.highWater == 0)
+    {
+        printf("  the allocator can't say what is in use here\n");
+        return 0;
+    }
+    return singleGrowth > scopedGrowth + DD_MEMORY_HIGH_WATER_STEP ? 0 : 1;
+}
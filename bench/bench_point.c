@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+// bench_point.c
+//----------------------------------------------------------------------------
+//
+//  What reading a wrapped point's x (as [[sprite position] x] does) costs
+//  down each path SGWrappedPoint2D has had, modelled in C since the bench
+//  has no Objective-C runtime:
+//
+//    invocation    the old path: a method signature and an NSInvocation
+//                  allocated per access, the delegate's read method called
+//                  through them, returning a new (autoreleased) SGPoint2D
+//    cached IMP    the read method looked up once and called directly,
+//                  still returning a new SGPoint2D
+//    C callback    SGSprite's path: a plain function and context, the
+//                  point2d returned by value
+//
+//  against reading the field directly.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Types.h"
+
+#define ACCESSES    5000000
+
+// Sizes of the objects each path allocates (roughly, on 64-bit)
+#define SIGNATURE_SIZE  64
+#define INVOCATION_SIZE 96
+#define POINT_SIZE      24
+
+// The owner of the point (a sprite), and its accessor
+typedef struct owner { point2d position; } owner;
+
+static point2d read_position(void *context)
+{
+    return ((owner *)context)->position;
+}
+
+// Returns a new object holding the point, as -pri_position does
+static point2d *read_position_object(void *context)
+{
+    point2d *result = malloc(POINT_SIZE);
+    *result = ((owner *)context)->position;
+    return result;
+}
+
+typedef point2d *(*object_reader)(void *);
+typedef point2d (*value_reader)(void *);
+
+// Keeps the optimiser from resolving the calls at compile time
+static object_reader volatile objectReader = read_position_object;
+static value_reader volatile valueReader = read_position;
+
+static float via_invocation(owner *o)
+{
+    void *signature = malloc(SIGNATURE_SIZE);
+    void *invocation = malloc(INVOCATION_SIZE);
+    memset(invocation, 0, INVOCATION_SIZE);
+    object_reader method = objectReader;        // Looked up per access
+    point2d *returned = method(o);
+    float x = returned->x;
+    free(returned);                             // When the pool drains
+    free(invocation);
+    free(signature);
+    return x;
+}
+
+static float via_imp(owner *o, object_reader imp)
+{
+    point2d *returned = imp(o);
+    float x = returned->x;
+    free(returned);
+    return x;
+}
+
+static float via_callback(owner *o, value_reader fn)
+{
+    return fn(o).x;
+}
+
+int main()
+{
+    owner o = { { 12.0f, 34.0f } };
+    float sum = 0;
+
+    uint64_t start = bench_now();
+    for (int i = 0; i < ACCESSES; i++) { o.position.x = (float)i; sum += via_invocation(&o); }
+    bench_report("x, invocation per access (model)", ACCESSES, bench_now() - start);
+
+    object_reader imp = objectReader;
+    start = bench_now();
+    for (int i = 0; i < ACCESSES; i++) { o.position.x = (float)i; sum += via_imp(&o, imp); }
+    bench_report("x, cached IMP (model)", ACCESSES, bench_now() - start);
+
+    value_reader fn = valueReader;
+    start = bench_now();
+    for (int i = 0; i < ACCESSES; i++) { o.position.x = (float)i; sum += via_callback(&o, fn); }
+    bench_report("x, C callback", ACCESSES, bench_now() - start);
+
+    start = bench_now();
+    for (int i = 0; i < ACCESSES; i++) { o.position.x = (float)i; sum += o.position.x; }
+    bench_report("x, direct", ACCESSES, bench_now() - start);
+
+    bench_sink += (uint64_t)sum;
+    return 0;
+}
@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------------
+// bench_profiler.c
+//----------------------------------------------------------------------------
+//
+//  Times a run of empty phases through DDProfiler, as DDGame updateGame
+//  times its phases, against the same loop without a profiler, to show
+//  what a timer costs; then the percentiles the debug view works out
+//  every frame, and writing the CSV and Chrome trace exports.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include "DDProfiler.h"
+
+#define PHASES      1000000
+#define FRAMES      1000
+
+int main()
+{
+    static DDProfiler profiler;
+    float p50 = 0, p95 = 0, p99 = 0;
+
+    dd_profile_init(&profiler);
+
+    uint64_t start = bench_now();
+    for (int i = 0; i < PHASES; i++)
+    {
+        uint64_t t = dd_profile_begin(NULL);
+        bench_sink += i;
+        dd_profile_end(NULL, (DDPhase)(i % DDPHASE_COUNT), t);
+    }
+    bench_report("phase, no profiler", PHASES, bench_now() - start);
+
+    start = bench_now();
+    for (int i = 0; i < PHASES; i++)
+    {
+        uint64_t t = dd_profile_begin(&profiler);
+        bench_sink += i;
+        dd_profile_end(&profiler, (DDPhase)(i % DDPHASE_COUNT), t);
+    }
+    bench_report("phase, timed into the ring buffer", PHASES, bench_now() - start);
+
+    start = bench_now();
+    for (int f = 0; f < FRAMES; f++)
+    {
+        for (int phase = 0; phase < DDPHASE_COUNT; phase++)
+            dd_profile_percentiles(&profiler, phase, &p50, &p95, &p99);
+    }
+    bench_report("percentiles of every phase", FRAMES, bench_now() - start);
+    printf("  %s: p50 %.3f p95 %.3f p99 %.3f us\n",
+           dd_profile_phase_name(DDPHASE_DRAW), p50, p95, p99);
+
+    start = bench_now();
+    int written = dd_profile_write_csv(&profiler, "build/bench_profile.csv");
+    bench_report("write csv", 1, bench_now() - start);
+    start = bench_now();
+    written += dd_profile_write_trace(&profiler, "build/bench_profile.json");
+    bench_report("write chrome trace", 1, bench_now() - start);
+    printf("  %d samples written\n", written);
+
+    return written == 2 * DD_PROFILE_CAPACITY ? 0 : 1;
+}
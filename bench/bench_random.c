@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------------
+// bench_random.c
+//----------------------------------------------------------------------------
+//
+//  Draws dart spawn positions the way DDDart used to (two rnd_upto calls
+//  into SwinGame's shared generator per dart) and from a game's own
+//  DDRandom, one dart at a time and a pool's worth in bulk. Also checks
+//  that two generators given the same seed agree, and that a different
+//  seed does not, since record/replay depends on it.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <string.h>
+
+#include "Utils.h"
+#include "SGHeadless.h"
+#include "DDRandom.h"
+
+#define ROUNDS      20000
+#define POINTS      64
+#define WIDTH       400
+
+int main()
+{
+    static point2d  points[POINTS];
+    static point2d  again[POINTS];
+    DDRandom        rng, other;
+    uint64_t        checksum = 0;
+
+    sg_Headless_SeedRandom(7);
+    uint64_t start = bench_now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < POINTS; i++)
+        {
+            points[i].y = -100 - rnd_upto(200);
+            points[i].x = rnd_upto(WIDTH);
+        }
+        checksum += (uint64_t)points[r % POINTS].x;
+    }
+    bench_report("rnd_upto (64 spawn points)", ROUNDS, bench_now() - start);
+
+    dd_random_seed(&rng, 7);
+    start = bench_now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < POINTS; i++)
+        {
+            points[i].y = -100 - dd_random_upto(&rng, 200);
+            points[i].x = dd_random_upto(&rng, WIDTH);
+        }
+        checksum += (uint64_t)points[r % POINTS].x;
+    }
+    bench_report("dd_random_upto (64 spawn points)", ROUNDS, bench_now() - start);
+
+    start = bench_now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        dd_random_spawn_points(&rng, points, POINTS, WIDTH, -100, 200);
+        checksum += (uint64_t)points[r % POINTS].x;
+    }
+    bench_report("dd_random_spawn_points (64, bulk)", ROUNDS, bench_now() - start);
+
+    // Same seed, same spawns; every point in range
+    dd_random_seed(&rng, 1234);
+    dd_random_seed(&other, 1234);
+    dd_random_spawn_points(&rng, points, POINTS, WIDTH, -100, 200);
+    dd_random_spawn_points(&other, again, POINTS, WIDTH, -100, 200);
+    if (memcmp(points, again, sizeof(points)))
+    {
+        fprintf(stderr, "bench_random: the same seed gave different spawn points\n");
+        return 1;
+    }
+    for (int i = 0; i < POINTS; i++)
+    {
+        if (points[i].x < 0 || points[i].x >= WIDTH || points[i].y > -100 || points[i].y <= -300)
+        {
+            fprintf(stderr, "bench_random: spawn point %d out of range\n", i);
+            return 1;
+        }
+    }
+
+    dd_random_seed(&other, 1235);
+    dd_random_spawn_points(&other, again, POINTS, WIDTH, -100, 200);
+    if (!memcmp(points, again, sizeof(points)))
+    {
+        fprintf(stderr, "bench_random: neighbouring seeds gave the same spawn points\n");
+        return 1;
+    }
+
+    printf("  same seed gives the same %d spawn points; neighbouring seeds differ\n", POINTS);
+    bench_sink = checksum;
+    return 0;
+}
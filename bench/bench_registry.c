@@ -0,0 +1,274 @@
+//----------------------------------------------------------------------------
+// bench_registry.c
+//----------------------------------------------------------------------------
+//
+//  Registers, looks up and removes 100k SwinGame-style pointers in the
+//  pointer registry PointerManager keeps, against a model of the
+//  NSMutableDictionary it replaced: every call boxes the pointer in a
+//  freshly allocated key (as [NSValue valueWithPointer:] does), hashes and
+//  compares it through a function pointer (the -hash and -isEqual:
+//  message sends) and walks a chained bucket. Then looks pointers up from
+//  several threads at once while the main thread keeps registering and
+//  removing others, checking that every lookup finds the right object,
+//  and retains the ones being removed, checking that none is retained
+//  once the writer has let it go.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "PointerRegistry.h"
+
+#define ENTRIES     100000
+#define BUCKETS     131072
+#define CHURN       1000
+#define MAX_THREADS 4
+#define LOOKUPS     2000000
+
+// The dictionary model: boxed keys in chained buckets
+typedef struct boxed_key { const void *pointer; } boxed_key;
+typedef struct boxed_entry { boxed_key *key; void *value; struct boxed_entry *next; } boxed_entry;
+typedef struct boxed_map
+{
+    boxed_entry *buckets[BUCKETS];
+    size_t      (*hash)(const boxed_key *);
+    int         (*equal)(const boxed_key *, const boxed_key *);
+} boxed_map;
+
+static size_t boxed_hash(const boxed_key *key) { return (uintptr_t)key->pointer >> 4; }
+static int boxed_equal(const boxed_key *a, const boxed_key *b) { return a->pointer == b->pointer; }
+
+static boxed_key *box(const void *pointer)
+{
+    boxed_key *key = malloc(sizeof(boxed_key));
+    key->pointer = pointer;
+    return key;
+}
+
+static void boxed_put(boxed_map *map, const void *pointer, void *value)
+{
+    boxed_key *key = box(pointer);
+    boxed_entry **bucket = &map->buckets[map->hash(key) % BUCKETS];
+    for (boxed_entry *e = *bucket; e; e = e->next)
+    {
+        if (map->equal(e->key, key)) { e->value = value; free(key); return; }
+    }
+    boxed_entry *e = malloc(sizeof(boxed_entry));
+    e->key = key; e->value = value; e->next = *bucket;
+    *bucket = e;
+}
+
+static void *boxed_get(boxed_map *map, const void *pointer)
+{
+    boxed_key *key = box(pointer);
+    void *value = NULL;
+    for (boxed_entry *e = map->buckets[map->hash(key) % BUCKETS]; e; e = e->next)
+    {
+        if (map->equal(e->key, key)) { value = e->value; break; }
+    }
+    free(key);
+    return value;
+}
+
+static void boxed_remove(boxed_map *map, const void *pointer)
+{
+    boxed_key *key = box(pointer);
+    for (boxed_entry **e = &map->buckets[map->hash(key) % BUCKETS]; *e; e = &(*e)->next)
+    {
+        if (map->equal((*e)->key, key))
+        {
+            boxed_entry *gone = *e;
+            *e = gone->next;
+            free(gone->key);
+            free(gone);
+            break;
+        }
+    }
+    free(key);
+}
+
+// Stand-ins for SwinGame's pointers and their wrappers
+static char *pointers[ENTRIES + CHURN];
+static int wrappers[ENTRIES + CHURN];
+
+static int order[ENTRIES];
+
+// Reference counts of the churned wrappers, 0 once freed
+static int refs[CHURN];
+static int freed_retains;
+
+static pointer_registry registry;
+static int finished;
+
+static void retain_wrapper(void *value)
+{
+    int n = (int *)value - &wrappers[ENTRIES];
+    if (__atomic_fetch_add(&refs[n], 1, __ATOMIC_ACQ_REL) == 0)
+        __atomic_add_fetch(&freed_retains, 1, __ATOMIC_RELAXED);
+}
+
+static void release_wrapper(void *value)
+{
+    __atomic_sub_fetch(&refs[(int *)value - &wrappers[ENTRIES]], 1, __ATOMIC_ACQ_REL);
+}
+
+// Looks up and retains the churned pointers, as they come and go
+static void *lookup_retained(void *arg)
+{
+    uint64_t *result = arg, found = 0, missing = 0;
+    uint32_t i = (uint32_t)(uintptr_t)result * 2654435761u;
+    while (found + missing < LOOKUPS / 4)
+    {
+        i = i * 1664525u + 1013904223u;
+        void *value = pointer_registry_get_retained(&registry, pointers[ENTRIES + i % CHURN],
+                                                    retain_wrapper);
+        if (value) { release_wrapper(value); found++; }
+        else missing++;
+    }
+    result[0] = found;
+    result[1] = missing;
+    __atomic_add_fetch(&finished, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+// Looks up the registered (never removed) pointers in a random order
+static void *lookup(void *arg)
+{
+    uint64_t *result = arg, found = 0, wrong = 0;
+    uint32_t i = (uint32_t)(uintptr_t)result * 2654435761u;
+    while (found + wrong < LOOKUPS)
+    {
+        i = i * 1664525u + 1013904223u;
+        uint32_t n = i % ENTRIES;
+        if (pointer_registry_get(&registry, pointers[n]) == &wrappers[n]) found++;
+        else wrong++;
+    }
+    result[0] = found;
+    result[1] = wrong;
+    __atomic_add_fetch(&finished, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+int main()
+{
+    static boxed_map map;
+    map.hash    = boxed_hash;
+    map.equal   = boxed_equal;
+
+    // Pointers as malloc hands them out, like SwinGame's, looked up in
+    // a shuffled order (as wrappers are asked for, not as they were made)
+    for (int i = 0; i < ENTRIES + CHURN; i++) pointers[i] = malloc(24);
+    for (int i = 0; i < ENTRIES; i++) order[i] = i;
+    for (int i = ENTRIES - 1; i > 0; i--)
+    {
+        int j = rand() % (i + 1), t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+
+    uint64_t start = bench_now();
+    for (int i = 0; i < ENTRIES; i++) boxed_put(&map, pointers[i], &wrappers[i]);
+    bench_report("register, boxed dictionary model", ENTRIES, bench_now() - start);
+    start = bench_now();
+    for (int i = 0; i < ENTRIES; i++) bench_sink += (uintptr_t)boxed_get(&map, pointers[order[i]]);
+    bench_report("look up, boxed dictionary model", ENTRIES, bench_now() - start);
+    start = bench_now();
+    for (int i = 0; i < ENTRIES; i++) boxed_remove(&map, pointers[order[i]]);
+    bench_report("remove, boxed dictionary model", ENTRIES, bench_now() - start);
+
+    pointer_registry_init(&registry, 1024);
+    start = bench_now();
+    for (int i = 0; i < ENTRIES; i++) pointer_registry_put(&registry, pointers[i], &wrappers[i]);
+    bench_report("register, pointer registry", ENTRIES, bench_now() - start);
+    start = bench_now();
+    for (int i = 0; i < ENTRIES; i++)
+        bench_sink += (uintptr_t)pointer_registry_get(&registry, pointers[order[i]]);
+    bench_report("look up, pointer registry", ENTRIES, bench_now() - start);
+    start = bench_now();
+    for (int i = 0; i < ENTRIES; i++) pointer_registry_remove(&registry, pointers[order[i]]);
+    bench_report("remove, pointer registry", ENTRIES, bench_now() - start);
+
+    // Lookups from other threads while this one registers and removes
+    for (int i = 0; i < ENTRIES; i++) pointer_registry_put(&registry, pointers[i], &wrappers[i]);
+    uint64_t wrong = 0;
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2)
+    {
+        pthread_t workers[MAX_THREADS];
+        uint64_t results[MAX_THREADS][2];
+        uint64_t churned = 0, lookups = 0;
+
+        finished    = 0;
+        start       = bench_now();
+        for (int t = 0; t < threads; t++) pthread_create(&workers[t], NULL, lookup, results[t]);
+        while (__atomic_load_n(&finished, __ATOMIC_ACQUIRE) < threads)
+        {
+            for (int i = ENTRIES; i < ENTRIES + CHURN; i++)
+                pointer_registry_put(&registry, pointers[i], &wrappers[i]);
+            for (int i = ENTRIES; i < ENTRIES + CHURN; i++)
+                pointer_registry_remove(&registry, pointers[i]);
+            churned += 2 * CHURN;
+        }
+        for (int t = 0; t < threads; t++)
+        {
+            pthread_join(workers[t], NULL);
+            lookups += results[t][0] + results[t][1];
+            wrong   += results[t][1];
+        }
+        uint64_t elapsed = bench_now() - start;
+
+        char name[64];
+        snprintf(name, sizeof name, "look up, %d thread%s, writer churning", threads,
+                 threads == 1 ? "" : "s");
+        bench_report(name, lookups, elapsed);
+        printf("  %llu registers and removes alongside\n", (unsigned long long)churned);
+    }
+    printf("  %llu lookups found the wrong object\n", (unsigned long long)wrong);
+
+    // Retained lookups of the pointers this thread registers and removes,
+    // each wrapper freed (registered again) only once every retain is let go
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2)
+    {
+        pthread_t workers[MAX_THREADS];
+        uint64_t results[MAX_THREADS][2];
+        uint64_t lookups = 0;
+
+        finished    = 0;
+        start       = bench_now();
+        for (int t = 0; t < threads; t++)
+            pthread_create(&workers[t], NULL, lookup_retained, results[t]);
+        while (__atomic_load_n(&finished, __ATOMIC_ACQUIRE) < threads)
+        {
+            for (int i = 0; i < CHURN; i++)
+            {
+                if (__atomic_load_n(&refs[i], __ATOMIC_ACQUIRE) != 0) continue;
+                __atomic_store_n(&refs[i], 1, __ATOMIC_RELEASE);
+                pointer_registry_put(&registry, pointers[ENTRIES + i], &wrappers[ENTRIES + i]);
+            }
+            for (int i = 0; i < CHURN; i++)
+            {
+                void *value = pointer_registry_remove(&registry, pointers[ENTRIES + i]);
+                if (value) release_wrapper(value);
+            }
+        }
+        for (int t = 0; t < threads; t++)
+        {
+            pthread_join(workers[t], NULL);
+            lookups += results[t][0] + results[t][1];
+        }
+        uint64_t elapsed = bench_now() - start;
+
+        char name[64];
+        snprintf(name, sizeof name, "retained look up, %d thread%s, churning", threads,
+                 threads == 1 ? "" : "s");
+        bench_report(name, lookups, elapsed);
+    }
+    printf("  %d objects retained after they were freed\n", freed_retains);
+
+    int ok = wrong == 0 && freed_retains == 0 && pointer_registry_count(&registry) == ENTRIES;
+    pointer_registry_free(&registry);
+    for (int i = 0; i < ENTRIES + CHURN; i++) free(pointers[i]);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+// bench_sfx.c
+//----------------------------------------------------------------------------
+//
+//  Runs the sound effect calls of a dying balloon's ticks (is the dying
+//  sound playing? if not, play it; stop it on recovery) plus a jiggle
+//  sound, first as the game used to make them (a load by name for every
+//  play, and a name lookup to poll and stop) and then through handles
+//  loaded once up front, as DDSoundBank does. The backend hands back the
+//  record it already has for a name it has loaded, so the cost by name is
+//  the marshalling and lookups rather than decoding.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include "Audio.h"
+#include "Utils.h"
+#include "SGHeadless.h"
+
+#define TICKS       200000
+
+int main()
+{
+    uint64_t checksum = 0;
+
+    sg_Headless_SetResourcePath("Resources");
+    open_audio();
+
+    uint64_t loaderCalls = 0;
+    uint64_t start  = bench_now();
+    for (int t = 0; t < TICKS; t++)
+    {
+        if (!sound_effect_named_playing("dying"))
+        {
+            play_sound_effect(load_sound_effect_named("dying", "die-1.ogg"));
+            loaderCalls++;
+        }
+        if (t % 64 == 0)
+        {
+            play_sound_effect(load_sound_effect("slidepast-1.ogg"));
+            loaderCalls++;
+        }
+        if (t % 1024 == 0)
+            stop_sound_effect_named("dying");
+        checksum += t;
+        delay(0);
+    }
+    bench_report("by name (load per play)", TICKS, bench_now() - start);
+
+    release_all_sound_effects();
+
+    sound_effect dying      = load_sound_effect_named("die-1.ogg", "die-1.ogg");
+    sound_effect slidepast  = load_sound_effect_named("slidepast-1.ogg", "slidepast-1.ogg");
+    start = bench_now();
+    for (int t = 0; t < TICKS; t++)
+    {
+        if (!sound_effect_playing(dying))
+            play_sound_effect(dying);
+        if (t % 64 == 0)
+            play_sound_effect(slidepast);
+        if (t % 1024 == 0)
+            stop_sound_effect(dying);
+        checksum += t;
+        delay(0);
+    }
+    bench_report("by handle (preloaded)", TICKS, bench_now() - start);
+
+    printf("  loader calls: %llu by name, 2 (up front) by handle\n",
+           (unsigned long long)loaderCalls);
+    bench_sink = checksum;
+    return 0;
+}
@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------------
+// bench_transform.c
+//----------------------------------------------------------------------------
+//
+//  Rotates and scales a set of collision masks (triangles and rectangles)
+//  about a point, first one shape at a time through the library's
+//  apply_matrix and apply_matrix_to_points (what a loop over the masks
+//  would do, rectangles ending up as the rectangle around their corners),
+//  then through dd_transform_triangles and dd_transform_rectangles (what
+//  applyMatrix:toMasks: does), and then in one DDTransformKernel batch
+//  through each kernel the CPU supports, to show whether a batch pays for
+//  copying the shapes in and out. Then transforms long runs of loose
+//  points held as separate x and y arrays, to show what each kernel
+//  manages once the calls are out of the way. Every result is checked
+//  against the library's, so a mismatch fails the bench.
+//
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Geometry.h"
+#include "DDTransformKernel.h"
+
+#define TRIANGLES   128
+#define RECTANGLES  128
+#define ROUNDS      2000
+#define POINTS      (1 << 16)
+#define PASSES      200
+
+static float coordinate() { return ((float)rand() / (float)RAND_MAX - 0.5f) * 1600.0f; }
+
+// The rectangle around four corners, each size rounded up as
+// RectangleFromTriangle rounds
+static rectangle rectangle_around(const point2d *pts)
+{
+    float minX = pts[0].x, maxX = pts[0].x, minY = pts[0].y, maxY = pts[0].y;
+    for (int p = 1; p < 4; p++)
+    {
+        minX = pts[p].x < minX ? pts[p].x : minX;   maxX = pts[p].x > maxX ? pts[p].x : maxX;
+        minY = pts[p].y < minY ? pts[p].y : minY;   maxY = pts[p].y > maxY ? pts[p].y : maxY;
+    }
+    return rectangle_from(minX, minY, (int32_t)ceilf(maxX - minX), (int32_t)ceilf(maxY - minY));
+}
+
+int main()
+{
+    static triangle tris[TRIANGLES], triResults[TRIANGLES], triExpected[TRIANGLES];
+    static rectangle rects[RECTANGLES], rectResults[RECTANGLES], rectExpected[RECTANGLES];
+    static point2d corners[RECTANGLES][4];
+    static float x[POINTS], y[POINTS];
+    static point2d expected[POINTS];
+    static DDPointBatch batch;
+    int mismatched = 0;
+
+    for (int i = 0; i < TRIANGLES; i++)
+        tris[i] = triangle_from(coordinate(), coordinate(), coordinate(), coordinate(),
+                                coordinate(), coordinate());
+    for (int i = 0; i < RECTANGLES; i++)
+    {
+        rects[i] = rectangle_from(coordinate(), coordinate(), rand() % 201 - 100,
+                                  rand() % 201 - 100);
+        points_from_rect(&rects[i], corners[i], 4);
+    }
+
+    // Rotate 3 degrees and scale by 1.01 about the screen's centre
+    point2d scale = { 1.01f, 1.01f }, centre = { 400, 300 }, back = { -400, -300 };
+    matrix2d toOrigin = translation_matrix_pt(&back);
+    matrix2d srt = scale_rotate_translate_matrix(&scale, 3, &centre);
+    matrix2d m = matrix_multiply(&srt, &toOrigin);
+
+    // One shape at a time through the library, as a loop over the masks would
+    uint64_t start = bench_now();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        memcpy(triResults, tris, sizeof tris);
+        for (int i = 0; i < TRIANGLES; i++) apply_matrix(&m, &triResults[i]);
+        for (int i = 0; i < RECTANGLES; i++)
+        {
+            point2d pts[4];
+            points_from_rect(&rects[i], pts, 4);
+            apply_matrix_to_points(&m, pts, 4);
+            rectResults[i] = rectangle_around(pts);
+        }
+        bench_sink += (uint64_t)rectResults[RECTANGLES - 1].x;
+    }
+    bench_report("masks, apply_matrix per shape", ROUNDS, bench_now() - start);
+    memcpy(triExpected, triResults, sizeof tris);
+    memcpy(rectExpected, rectResults, sizeof rects);
+
+    // One shape at a time through the kernel's own per shape transforms
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        memcpy(triResults, tris, sizeof tris);
+        memcpy(rectResults, rects, sizeof rects);
+        dd_transform_triangles(&m, triResults, TRIANGLES);
+        dd_transform_rectangles(&m, rectResults, RECTANGLES);
+        bench_sink += (uint64_t)rectResults[RECTANGLES - 1].x;
+    }
+    bench_report("masks, per shape (applyMatrix:toMasks:)", ROUNDS, bench_now() - start);
+    if (memcmp(triResults, triExpected, sizeof tris) != 0) mismatched++;
+    if (memcmp(rectResults, rectExpected, sizeof rects) != 0) mismatched++;
+
+    // In one batch, through each kernel
+    DDTransformKernel best = dd_transform_kernel();
+    for (int k = DDTRANSFORM_SCALAR; k <= DDTRANSFORM_AVX; k++)
+    {
+        if (dd_transform_use_kernel((DDTransformKernel)k) != 0) continue;
+
+        start = bench_now();
+        for (int round = 0; round < ROUNDS; round++)
+        {
+            dd_point_batch_clear(&batch);
+            int firstTri = dd_point_batch_add_triangles(&batch, tris, TRIANGLES);
+            int firstRect = dd_point_batch_add_rectangles(&batch, rects, RECTANGLES);
+            dd_point_batch_transform(&batch, &m);
+            dd_point_batch_get_triangles(&batch, firstTri, triResults, TRIANGLES);
+            dd_point_batch_get_rectangles(&batch, firstRect, rectResults, RECTANGLES);
+            bench_sink += (uint64_t)rectResults[RECTANGLES - 1].x;
+        }
+        char name[64];
+        snprintf(name, sizeof name, "masks, one batch (%s)", dd_transform_kernel_name(k));
+        bench_report(name, ROUNDS, bench_now() - start);
+
+        if (memcmp(triResults, triExpected, sizeof tris) != 0) mismatched++;
+        if (memcmp(rectResults, rectExpected, sizeof rects) != 0) mismatched++;
+        for (int i = 0; i < RECTANGLES; i++)
+        {
+            point2d pts[4], got[4];
+            memcpy(pts, corners[i], sizeof pts);
+            apply_matrix_to_points(&m, pts, 4);
+            dd_point_batch_get_points(&batch, TRIANGLES * 3 + 4 * i, got, 4);
+            if (memcmp(pts, got, sizeof pts) != 0) mismatched++;
+        }
+    }
+
+    // Long runs of loose points, including some awkward values
+    static const float awkward[] = { 0.0f, -0.0f, 1e-40f, 3e38f, -3e38f, INFINITY, NAN };
+    for (int i = 0; i < POINTS; i++)
+    {
+        expected[i].x = rand() % 16 ? coordinate() : awkward[rand() % 7];
+        expected[i].y = rand() % 16 ? coordinate() : awkward[rand() % 7];
+    }
+    for (int k = DDTRANSFORM_SCALAR; k <= DDTRANSFORM_AVX; k++)
+    {
+        if (dd_transform_use_kernel((DDTransformKernel)k) != 0) continue;
+
+        for (int i = 0; i < POINTS; i++) { x[i] = expected[i].x; y[i] = expected[i].y; }
+        start = bench_now();
+        for (int pass = 0; pass < PASSES; pass++) dd_transform_points(&m, x, y, POINTS);
+        char name[64];
+        snprintf(name, sizeof name, "points, %s", dd_transform_kernel_name(k));
+        uint64_t elapsed = bench_now() - start;
+        bench_report(name, (uint64_t)PASSES * POINTS, elapsed);
+        printf("  %.1f GB/s read and written\n",
+               (double)PASSES * POINTS * 4 * sizeof(float) / (double)elapsed);
+
+        // One more pass from the start, against the library
+        for (int i = 0; i < POINTS; i++) { x[i] = expected[i].x; y[i] = expected[i].y; }
+        dd_transform_points(&m, x, y, POINTS);
+        static point2d reference[POINTS];
+        memcpy(reference, expected, sizeof reference);
+        apply_matrix_to_points(&m, reference, POINTS);
+        for (int i = 0; i < POINTS; i++)
+        {
+            if (memcmp(&x[i], &reference[i].x, sizeof(float)) ||
+                memcmp(&y[i], &reference[i].y, sizeof(float))) { mismatched++; break; }
+        }
+    }
+    dd_transform_use_kernel(best);
+
+    printf("  dispatches to %s; %d kernel runs differ from apply_matrix\n",
+           dd_transform_kernel_name(best), mismatched);
+    return mismatched == 0 ? 0 : 1;
+}
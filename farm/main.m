@@ -0,0 +1,221 @@
+/**
+ * @file    main.m
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   The simulation farm: plays thousands of headless games, each
+ *          with its own seed and an input policy standing in for the
+ *          player, across every core, then reports how they went. Use
+ *          it to try out a difficulty table, or to catch a slowdown in
+ *          the sprite and collision code, without playing by hand.
+ *
+ *              ddfarm [-n games] [-j workers] [-p idle|random|sweep|bot]
+ *                     [-s first seed] [-t tick limit] [-d difficulty.txt] [-v]
+ */
+
+#import <Foundation/Foundation.h>
+#import <unistd.h>
+#import "SwinGame.h"
+#import "DDGame.h"
+#import "DDDartPool.h"
+#import "DDSoundBank.h"
+#import "DDFarm.h"
+
+/**
+ * @typedef DDFarmPolicy
+ * @brief   Defines the input policies a farm game can be played with
+ */
+typedef enum DDFarmPolicy
+{
+    DDPOLICY_IDLE,      //!< Never moves
+    DDPOLICY_RANDOM,    //!< Holds left, right or nothing for a random while, over and over
+    DDPOLICY_SWEEP,     //!< Sweeps from side to side
+    DDPOLICY_BOT        //!< Steered by the autopilot
+} DDFarmPolicy;
+
+/**
+ * @brief   Names of the input policies, as given to -p
+ */
+static const char* _policyNames[] = { "idle", "random", "sweep", "bot" };
+
+/**
+ * @struct  DDFarmContext
+ * @brief   What every game of the farm is played with
+ */
+typedef struct DDFarmContext
+{
+    DDFarmPolicy    policy;     //!< Input policy of every game
+    uint32_t        firstSeed;  //!< Seed of the first game; each game takes the next
+    uint32_t        maxTicks;   //!< Ticks after which a game is stopped
+    float           tickLength; //!< Length of a tick in ms
+    DDDifficulty    difficulty; //!< Difficulty curve every game follows
+} DDFarmContext;
+
+/**
+ * @struct  DDFarmPlayer
+ * @brief   The state of an input policy through one game
+ */
+typedef struct DDFarmPlayer
+{
+    DDRandom        rng;        //!< The policy's own random numbers (apart from the game's)
+    DDKeys          held;       //!< Keys held
+    int             holdFor;    //!< Ticks to go before the policy picks again
+} DDFarmPlayer;
+
+/**
+ * @brief   Picks the keys held on a tick of a game
+ * @param   policy
+ *          The input policy
+ * @param   player
+ *          The policy's state through the game
+ * @param   game
+ *          The game being played
+ * @param   tick
+ *          Ticks played so far
+ * @return  The keys held
+ */
+static DDKeys policyKeys(DDFarmPolicy policy, DDFarmPlayer* player, DDGame* game,
+                         uint32_t tick)
+{
+    switch (policy)
+    {
+        case DDPOLICY_BOT:
+            return [game autopilotKeys];
+        case DDPOLICY_RANDOM:
+            if (--player->holdFor <= 0)
+            {
+                static const DDKeys choices[] = { 0, DDKEY_LEFT, DDKEY_RIGHT };
+                player->held    = choices[dd_random_upto(&player->rng, 3)];
+                player->holdFor = 10 + dd_random_upto(&player->rng, 50);
+            }
+            return player->held;
+        case DDPOLICY_SWEEP:
+            return (tick / 90) % 2 ? DDKEY_RIGHT : DDKEY_LEFT;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief   Plays one game of the farm to game over (or the tick limit),
+ *          holding the policy's keys on each tick as DDController does
+ * @param   job
+ *          Index of the game
+ * @param   worker
+ *          Index of the worker playing it
+ * @param   result
+ *          The DDFarmGame to fill in
+ * @param   context
+ *          The DDFarmContext
+ */
+static void playGame(uint32_t job, int worker, void* result, void* context)
+{
+    DDFarmContext*  farm    = context;
+    DDFarmGame*     played  = result;
+    DDFarmPlayer    player  = { .held = 0, .holdFor = 0 };
+
+    @autoreleasepool
+    {
+        played->seed = farm->firstSeed + job;
+        dd_random_seed(&player.rng, ~played->seed);
+
+        DDGame* game = [[DDGame alloc] initWithSeed:played->seed difficulty:&farm->difficulty];
+        game.tickLength = farm->tickLength;
+
+        while (!game.over && played->ticks < farm->maxTicks)
+        {
+            // Drain each tick's temporaries, as the game proper does each frame
+            @autoreleasepool
+            {
+                DDKeys keys = policyKeys(farm->policy, &player, game, played->ticks);
+                game.keys   = keys;
+
+                uint64_t start = dd_profile_now();
+                [game updateGame];
+                played->nanoseconds += dd_profile_now() - start;
+
+                played->darts += game.darts.count;
+                if (game.score > played->peakScore) { played->peakScore = game.score; }
+                played->ticks++;
+            }
+        }
+        played->over = game.over;
+        [game release];
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    @autoreleasepool {
+
+        DDFarmContext farm;
+        uint32_t    games       = 1000;
+        int         workers     = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        const char* table       = NULL;
+        BOOL        verbose     = NO;
+        int         option;
+
+        farm.policy     = DDPOLICY_RANDOM;
+        farm.firstSeed  = 1;
+        farm.maxTicks   = 60 * 60 * 10;     // Ten minutes a game
+        farm.tickLength = 1000.0f / 60;
+
+        while ((option = getopt(argc, argv, "n:j:p:s:t:d:v")) != -1)
+        {
+            switch (option)
+            {
+                case 'n': games          = (uint32_t)strtoul(optarg, NULL, 10); break;
+                case 'j': workers        = atoi(optarg);                        break;
+                case 's': farm.firstSeed = (uint32_t)strtoul(optarg, NULL, 10); break;
+                case 't': farm.maxTicks  = (uint32_t)strtoul(optarg, NULL, 10); break;
+                case 'd': table          = optarg;                              break;
+                case 'v': verbose        = YES;                                 break;
+                case 'p':
+                    for (farm.policy = DDPOLICY_IDLE; farm.policy <= DDPOLICY_BOT; farm.policy++)
+                        if (strcmp(optarg, _policyNames[farm.policy]) == 0) break;
+                    if (farm.policy <= DDPOLICY_BOT) break;
+                    // Fall through on an unknown policy
+                default:
+                    fprintf(stderr, "usage: %s [-n games] [-j workers] [-p idle|random|sweep|bot] "
+                                    "[-s first seed] [-t tick limit] [-d difficulty.txt] [-v]\n",
+                            argv[0]);
+                    return 2;
+            }
+        }
+
+        [SGGraphics openGraphicsWindow:@"Dart Dodger" width:400 height:600];
+        [SGColors loadDefaultColors];
+
+        // The table the game ships with, unless given another to try
+        dd_difficulty_init(&farm.difficulty);
+        NSString* path = table ? [NSString stringWithUTF8String:table]
+                               : [SGResources pathToResourceFilename:@"difficulty.txt"];
+        int loaded = dd_difficulty_load(&farm.difficulty, [path UTF8String]);
+        if (table && loaded != DD_DIFFICULTY_LOADED)
+        {
+            fprintf(stderr, "Could not load %s (line %d)\n", table, loaded);
+            return 1;
+        }
+
+        // Load everything shared before the workers fork, so each starts
+        // with it; then keep the games' per-sprite logging quiet
+        [DDSoundBank preload];
+        [[[DDGame alloc] initWithSeed:0 difficulty:&farm.difficulty] release];
+        if (!verbose) { freopen("/dev/null", "w", stderr); }
+
+        printf("Playing %u games (seeds %u to %u, policy %s, at most %u ticks each)\n",
+               games, farm.firstSeed, farm.firstSeed + games - 1, _policyNames[farm.policy],
+               farm.maxTicks);
+        fflush(stdout);
+
+        DDFarmGame* results = calloc(games, sizeof(DDFarmGame));
+        DDFarmStats stats;
+        int failed = dd_farm_run(workers, games, playGame, &farm, results, sizeof(DDFarmGame),
+                                 &stats);
+        dd_farm_report(stdout, results, games, farm.tickLength, &stats);
+        if (failed) { printf("Some games did not finish (a worker failed)\n"); }
+
+        free(results);
+        [SGResources releaseAllResources];
+        return failed ? 1 : 0;
+    }
+}
@@ -0,0 +1,405 @@
+//----------------------------------------------------------------------------
+// GeometryInline.h
+//----------------------------------------------------------------------------
+//
+//  The stateless part of Geometry.h (points, vectors, rectangles,
+//  triangles and matrices; no trigonometry, no sprites, no screen) as
+//  header-only inline functions, named as in Geometry.h with an _inline
+//  suffix. Each does the same float operations in the same order as the
+//  sgGeometry routine it stands in for, so the results match bit for bit,
+//  but the compiler can inline (and vectorise) them where every
+//  Geometry.h call is an indirect call into the native library.
+//  bench/bench_geometry.c checks the two against each other.
+//
+//  Results match as long as both sides are compiled without contracting
+//  a * b + c into a fused multiply-add (the default on x86-64 without
+//  -mfma; pass -ffp-contract=off on targets that have one).
+//
+//----------------------------------------------------------------------------
+
+#ifndef GeometryInline_h
+#define GeometryInline_h
+
+#include <math.h>
+#include <stdint.h>
+
+#ifndef __cplusplus
+  #include <stdbool.h>
+#endif
+
+#include "Types.h"
+
+// Functions with no library calls are constant expressions in C++14
+#if defined(__cplusplus) && __cplusplus >= 201402L
+  #define SG_GEOMETRY_CONSTEXPR constexpr inline
+#else
+  #define SG_GEOMETRY_CONSTEXPR static inline
+#endif
+#define SG_GEOMETRY_INLINE static inline
+
+//----------------------------------------------------------------------------
+// Points and vectors
+//----------------------------------------------------------------------------
+
+SG_GEOMETRY_CONSTEXPR point2d point_at_inline(float x, float y)
+{
+    point2d result = { x, y };
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR point2d point_add_inline(const point2d *pt1, const point2d *pt2)
+{
+    return point_at_inline(pt1->x + pt2->x, pt1->y + pt2->y);
+}
+
+SG_GEOMETRY_CONSTEXPR point2d point_at_start_with_offset_inline(const point2d *startPoint,
+                                                                const vector *offset)
+{
+    return point_at_inline(startPoint->x + offset->x, startPoint->y + offset->y);
+}
+
+SG_GEOMETRY_CONSTEXPR bool point_on_point_inline(const point2d *pt1, const point2d *pt2)
+{
+    return pt1->x == pt2->x && pt1->y == pt2->y;
+}
+
+SG_GEOMETRY_INLINE float point_point_distance_inline(const point2d *pt1, const point2d *pt2)
+{
+    float dx = pt2->x - pt1->x, dy = pt2->y - pt1->y;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+SG_GEOMETRY_CONSTEXPR vector vector_to_with_invert_y_inline(float x, float y, bool invertY)
+{
+    vector result = { x, invertY ? -y : y };
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR vector vector_to_inline(float x, float y)
+{
+    return vector_to_with_invert_y_inline(x, y, false);
+}
+
+SG_GEOMETRY_CONSTEXPR vector vector_to_point_inline(const point2d *p1)
+{
+    return vector_to_inline(p1->x, p1->y);
+}
+
+SG_GEOMETRY_CONSTEXPR vector vector_from_points_inline(const point2d *p1, const point2d *p2)
+{
+    return vector_to_inline(p2->x - p1->x, p2->y - p1->y);
+}
+
+SG_GEOMETRY_CONSTEXPR vector add_vectors_inline(const vector *v1, const vector *v2)
+{
+    return vector_to_inline(v1->x + v2->x, v1->y + v2->y);
+}
+
+SG_GEOMETRY_CONSTEXPR vector subtract_vectors_inline(const vector *v1, const vector *v2)
+{
+    return vector_to_inline(v1->x - v2->x, v1->y - v2->y);
+}
+
+SG_GEOMETRY_CONSTEXPR vector vector_multiply_inline(const vector *v, float s)
+{
+    return vector_to_inline(v->x * s, v->y * s);
+}
+
+SG_GEOMETRY_CONSTEXPR vector invert_vector_inline(const vector *v)
+{
+    return vector_to_inline(-v->x, -v->y);
+}
+
+SG_GEOMETRY_CONSTEXPR float vector_magnitude_sq_inline(const vector *v)
+{
+    return v->x * v->x + v->y * v->y;
+}
+
+SG_GEOMETRY_INLINE float vector_magnitude_inline(const vector *v)
+{
+    return sqrtf(vector_magnitude_sq_inline(v));
+}
+
+SG_GEOMETRY_CONSTEXPR float dot_product_inline(const vector *v1, const vector *v2)
+{
+    return v1->x * v2->x + v1->y * v2->y;
+}
+
+SG_GEOMETRY_CONSTEXPR bool vector_is_zero_inline(const vector *v)
+{
+    return v->x == 0 && v->y == 0;
+}
+
+SG_GEOMETRY_CONSTEXPR bool vectors_equal_inline(const vector *v1, const vector *v2)
+{
+    return v1->x == v2->x && v1->y == v2->y;
+}
+
+SG_GEOMETRY_INLINE vector unit_vector_inline(const vector *v)
+{
+    float mag = vector_magnitude_inline(v);
+    if (mag == 0) return vector_to_inline(0, 0);
+    return vector_to_inline(v->x / mag, v->y / mag);
+}
+
+SG_GEOMETRY_INLINE vector limit_vector_inline(const vector *v, float limit)
+{
+    float mag = vector_magnitude_inline(v);
+    if (mag <= limit) return *v;
+    vector unit = unit_vector_inline(v);
+    return vector_multiply_inline(&unit, limit);
+}
+
+SG_GEOMETRY_INLINE vector vector_normal_inline(const vector *v)
+{
+    float mag = vector_magnitude_inline(v);
+    if (mag == 0) return vector_to_inline(0, 0);
+    return vector_to_inline(-v->y / mag, v->x / mag);
+}
+
+//----------------------------------------------------------------------------
+// Rectangles
+//----------------------------------------------------------------------------
+
+SG_GEOMETRY_CONSTEXPR rectangle rectangle_from_inline(float x, float y, int32_t w, int32_t h)
+{
+    rectangle result = { x, y, w, h };
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR rectangle rectangle_at_point_inline(const point2d *pt, int32_t width,
+                                                          int32_t height)
+{
+    return rectangle_from_inline(pt->x, pt->y, width, height);
+}
+
+// Anchored at pt1 and sized with Ceiling, as SwinGame's RectangleFrom(pt1, pt2)
+SG_GEOMETRY_INLINE rectangle rectangle_for_points_inline(const point2d *pt1, const point2d *pt2)
+{
+    return rectangle_from_inline(pt1->x, pt1->y, (int32_t)ceilf(pt2->x - pt1->x),
+                                 (int32_t)ceilf(pt2->y - pt1->y));
+}
+
+// The bounds of the points, sized with Ceiling so as to cover the triangle
+SG_GEOMETRY_INLINE rectangle rectangle_from_triangle_inline(const triangle *tri)
+{
+    const point2d *p = tri->points;
+    float minX = p[0].x, maxX = p[0].x, minY = p[0].y, maxY = p[0].y;
+    for (int i = 1; i < 3; i++)
+    {
+        if (p[i].x < minX) minX = p[i].x; else if (p[i].x > maxX) maxX = p[i].x;
+        if (p[i].y < minY) minY = p[i].y; else if (p[i].y > maxY) maxY = p[i].y;
+    }
+    return rectangle_from_inline(minX, minY, (int32_t)ceilf(maxX - minX),
+                                 (int32_t)ceilf(maxY - minY));
+}
+
+SG_GEOMETRY_CONSTEXPR float rectangle_top_inline(const rectangle *rect)
+{
+    return rect->height > 0 ? rect->y : rect->y + rect->height;
+}
+
+SG_GEOMETRY_CONSTEXPR float rectangle_bottom_inline(const rectangle *rect)
+{
+    return rect->height > 0 ? rect->y + rect->height : rect->y;
+}
+
+SG_GEOMETRY_CONSTEXPR float rectangle_left_inline(const rectangle *rect)
+{
+    return rect->width > 0 ? rect->x : rect->x + rect->width;
+}
+
+SG_GEOMETRY_CONSTEXPR float rectangle_right_inline(const rectangle *rect)
+{
+    return rect->width > 0 ? rect->x + rect->width : rect->x;
+}
+
+SG_GEOMETRY_CONSTEXPR point2d rectangle_center_inline(const rectangle *rect)
+{
+    return point_at_inline(rect->x + rect->width / 2.0f, rect->y + rect->height / 2.0f);
+}
+
+SG_GEOMETRY_CONSTEXPR point2d rectangle_center_top_inline(const rectangle *rect)
+{
+    return point_at_inline(rect->x + rect->width / 2.0f, rectangle_top_inline(rect));
+}
+
+SG_GEOMETRY_CONSTEXPR point2d rectangle_center_bottom_inline(const rectangle *rect)
+{
+    return point_at_inline(rect->x + rect->width / 2.0f, rectangle_bottom_inline(rect));
+}
+
+SG_GEOMETRY_CONSTEXPR point2d rectangle_center_left_inline(const rectangle *rect)
+{
+    return point_at_inline(rectangle_left_inline(rect), rect->y + rect->height / 2.0f);
+}
+
+SG_GEOMETRY_CONSTEXPR point2d rectangle_center_right_inline(const rectangle *rect)
+{
+    return point_at_inline(rectangle_right_inline(rect), rect->y + rect->height / 2.0f);
+}
+
+SG_GEOMETRY_CONSTEXPR rectangle rectangle_offset_inline(const rectangle *rect, const vector *vec)
+{
+    return rectangle_from_inline(rect->x + vec->x, rect->y + vec->y, rect->width, rect->height);
+}
+
+SG_GEOMETRY_CONSTEXPR bool rectangles_intersect_inline(const rectangle *rect1,
+                                                       const rectangle *rect2)
+{
+    return !(rectangle_bottom_inline(rect1) < rectangle_top_inline(rect2)    ||
+             rectangle_top_inline(rect1)    > rectangle_bottom_inline(rect2) ||
+             rectangle_right_inline(rect1)  < rectangle_left_inline(rect2)   ||
+             rectangle_left_inline(rect1)   > rectangle_right_inline(rect2));
+}
+
+SG_GEOMETRY_INLINE rectangle intersection_inline(const rectangle *rect1, const rectangle *rect2)
+{
+    float l = fmaxf(rectangle_left_inline(rect1),   rectangle_left_inline(rect2));
+    float t = fmaxf(rectangle_top_inline(rect1),    rectangle_top_inline(rect2));
+    float r = fminf(rectangle_right_inline(rect1),  rectangle_right_inline(rect2));
+    float b = fminf(rectangle_bottom_inline(rect1), rectangle_bottom_inline(rect2));
+
+    if (r < l || b < t) return rectangle_from_inline(0, 0, 0, 0);
+    return rectangle_from_inline(l, t, (int32_t)(r - l), (int32_t)(b - t));
+}
+
+// Inclusive of every edge, as in SwinGame
+SG_GEOMETRY_CONSTEXPR bool point_xyin_rect_xy_inline(float ptX, float ptY, float x, float y,
+                                                     float w, float h)
+{
+    return !(ptX < x || ptX > x + w || ptY < y || ptY > y + h);
+}
+
+SG_GEOMETRY_CONSTEXPR bool point_in_rect_xy_inline(const point2d *pt, float x, float y,
+                                                   float w, float h)
+{
+    return point_xyin_rect_xy_inline(pt->x, pt->y, x, y, w, h);
+}
+
+SG_GEOMETRY_CONSTEXPR bool point_xyin_rect_inline(float x, float y, const rectangle *rect)
+{
+    return point_xyin_rect_xy_inline(x, y, rect->x, rect->y, rect->width, rect->height);
+}
+
+SG_GEOMETRY_CONSTEXPR bool point_in_rect_inline(const point2d *pt, const rectangle *rect)
+{
+    return point_xyin_rect_xy_inline(pt->x, pt->y, rect->x, rect->y, rect->width, rect->height);
+}
+
+//----------------------------------------------------------------------------
+// Triangles
+//----------------------------------------------------------------------------
+
+SG_GEOMETRY_CONSTEXPR triangle triangle_from_inline(float ax, float ay, float bx, float by,
+                                                    float cx, float cy)
+{
+    triangle result = {{ { ax, ay }, { bx, by }, { cx, cy } }};
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR triangle triangle_from_points_inline(const point2d *a, const point2d *b,
+                                                           const point2d *c)
+{
+    return triangle_from_inline(a->x, a->y, b->x, b->y, c->x, c->y);
+}
+
+SG_GEOMETRY_CONSTEXPR point2d triangle_barycenter_inline(const triangle *tri)
+{
+    return point_at_inline((tri->points[0].x + tri->points[1].x + tri->points[2].x) / 3,
+                           (tri->points[0].y + tri->points[1].y + tri->points[2].y) / 3);
+}
+
+// Barycentric, exclusive of the edges, as in SwinGame
+SG_GEOMETRY_CONSTEXPR bool point_in_triangle_inline(const point2d *pt, const triangle *tri)
+{
+    vector v0 = vector_from_points_inline(&tri->points[0], &tri->points[2]);
+    vector v1 = vector_from_points_inline(&tri->points[0], &tri->points[1]);
+    vector v2 = vector_from_points_inline(&tri->points[0], pt);
+
+    float a = dot_product_inline(&v0, &v0);
+    float b = dot_product_inline(&v0, &v1);
+    float c = dot_product_inline(&v0, &v2);
+    float d = dot_product_inline(&v1, &v1);
+    float e = dot_product_inline(&v1, &v2);
+
+    // SwinGame keeps the denominator, the numerators and u + v in x87
+    // extended precision, rounding only 1 / denom, u and v to float. The
+    // products of floats are exact in double, so double stands in for it
+    // (bench_collide checks the two agree on points along triangle edges).
+    double denom = (double)a * d - (double)b * b;
+
+    if (denom == 0) return false;
+    float inverse = (float)(1 / denom);
+    float u = (float)(((double)d * c - (double)b * e) * inverse);
+    float v = (float)(((double)a * e - (double)b * c) * inverse);
+    return u > 0 && v > 0 && (double)u + v < 1;
+}
+
+//----------------------------------------------------------------------------
+// Matrices (row-major, applied as m * [x y 1])
+//----------------------------------------------------------------------------
+
+SG_GEOMETRY_CONSTEXPR matrix2d identity_matrix_inline()
+{
+    matrix2d result = {{ { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } }};
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR matrix2d translation_matrix_inline(float dx, float dy)
+{
+    matrix2d result = {{ { 1, 0, dx }, { 0, 1, dy }, { 0, 0, 1 } }};
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR matrix2d translation_matrix_pt_inline(const point2d *pt)
+{
+    return translation_matrix_inline(pt->x, pt->y);
+}
+
+SG_GEOMETRY_CONSTEXPR matrix2d scale_matrix_by_point_inline(const point2d *scale)
+{
+    matrix2d result = {{ { scale->x, 0, 0 }, { 0, scale->y, 0 }, { 0, 0, 1 } }};
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR matrix2d scale_matrix_inline(float scale)
+{
+    matrix2d result = {{ { scale, 0, 0 }, { 0, scale, 0 }, { 0, 0, 1 } }};
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR matrix2d matrix_multiply_inline(const matrix2d *m1, const matrix2d *m2)
+{
+    matrix2d result = {{ { 0 } }};
+    for (int32_t row = 0; row < 3; row++)
+        for (int32_t col = 0; col < 3; col++)
+            result.elements[row][col] = m1->elements[row][0] * m2->elements[0][col] +
+                                        m1->elements[row][1] * m2->elements[1][col] +
+                                        m1->elements[row][2] * m2->elements[2][col];
+    return result;
+}
+
+SG_GEOMETRY_CONSTEXPR vector matrix_multiply_vector_inline(const matrix2d *m, const vector *v)
+{
+    return vector_to_inline(v->x * m->elements[0][0] + v->y * m->elements[0][1] + m->elements[0][2],
+                            v->x * m->elements[1][0] + v->y * m->elements[1][1] + m->elements[1][2]);
+}
+
+SG_GEOMETRY_INLINE void apply_matrix_to_points_inline(const matrix2d *m, point2d *pts,
+                                                      int32_t pts_len)
+{
+    for (int32_t i = 0; i < pts_len; i++)
+    {
+        float x = pts[i].x, y = pts[i].y;
+        pts[i].x = x * m->elements[0][0] + y * m->elements[0][1] + m->elements[0][2];
+        pts[i].y = x * m->elements[1][0] + y * m->elements[1][1] + m->elements[1][2];
+    }
+}
+
+SG_GEOMETRY_INLINE void apply_matrix_inline(const matrix2d *m, triangle *tri)
+{
+    apply_matrix_to_points_inline(m, tri->points, 3);
+}
+
+#endif
@@ -7,23 +7,28 @@
 //----------------------------------------------------------------------------
 
 // The ptrRegistry is responsible for maintaining copies of all wrapped SwinGame pointers.
-#import <Foundation/NSValue.h>
+// It is keyed on the pointers themselves (see PointerRegistry.h), and retains each
+// object registered, as the dictionary it replaces did.
 #import "PointerManager.h"
+#import "PointerRegistry.h"
 #import "SGSDK.h"
 
-static NSMutableDictionary *_ptrRegister;
+static pointer_registry _ptrRegister;
+
+static void retainObject(void *obj)
+{
+    [(id)obj retain];
+}
 
 void removeObject(void *ptr)
 {
-    id key = [NSValue valueWithPointer:ptr];
-    
-//    NSLog(@"Freeing '%p'-'%@'", ptr, key);
+//    NSLog(@"Freeing '%p'", ptr);
     
-    id <PointerWrapper> obj = [_ptrRegister objectForKey:key];
+    id <PointerWrapper> obj = pointer_registry_get(&_ptrRegister, ptr);
     if (obj != nil)
     {
         [obj releasePointer];
-        [_ptrRegister removeObjectForKey: key];
+        [(id)pointer_registry_remove(&_ptrRegister, ptr) release];
     }
 }
 
@@ -32,18 +37,21 @@ void removeObject(void *ptr)
 + (void)initialize
 {
     //NSLog(@"Created register");
-    _ptrRegister = [[NSMutableDictionary alloc] initWithCapacity: 100000];
+    if (self != [PointerManager class]) return;
+    pointer_registry_init(&_ptrRegister, 1024);
     sg_Resources_RegisterFreeNotifier(removeObject);
 }
 
 + (void)registerObject:(id)obj withKey:(void *)key
 {
-    [_ptrRegister setObject:obj forKey:[NSValue valueWithPointer:key]];
+    [(id)pointer_registry_put(&_ptrRegister, key, [obj retain]) release];
 }
 
+// Retained while the registry is locked, so another thread freeing the
+// pointer cannot release the object before this one is done with it
 + (id)objectForKey:(void *)key
 {
-    return [_ptrRegister objectForKey:[NSValue valueWithPointer:key]];
+    return [(id)pointer_registry_get_retained(&_ptrRegister, key, retainObject) autorelease];
 }
 
 @end
\ No newline at end of file
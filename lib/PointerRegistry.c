@@ -0,0 +1,210 @@
+//----------------------------------------------------------------------------
+// PointerRegistry.c
+//----------------------------------------------------------------------------
+//
+//  Maps SwinGame pointers to the objects wrapping them; see
+//  PointerRegistry.h.
+//
+//  A slot's key is written after its value, so a lookup that finds the key
+//  finds the value with it. Removing empties the value before marking the
+//  key removed, and a lookup checks the key again after reading the value,
+//  so it never returns the value of a different pointer that reused the
+//  slot in between.
+//
+//----------------------------------------------------------------------------
+
+#include <stdlib.h>
+
+#include "PointerRegistry.h"
+
+#define SLOT_EMPTY      ((uintptr_t)0)
+#define SLOT_REMOVED    ((uintptr_t)1)
+#define MIN_SLOTS       16
+
+// Fibonacci hashing: the high bits of the pointer times 2^64 / phi, which
+// spreads pointers that differ only in their low (aligned) bits
+static inline size_t pointer_registry_hash(uintptr_t key, int shift)
+{
+    return (size_t)(((uint64_t)key * 0x9E3779B97F4A7C15ull) >> shift);
+}
+
+// A table with room for capacity pointers under a 3/4 load
+static pointer_registry_table *pointer_registry_table_create(size_t capacity)
+{
+    size_t slots = MIN_SLOTS;
+    int bits = 4;
+    while (slots * 3 / 4 < capacity + 1)
+    {
+        slots <<= 1;
+        bits++;
+    }
+
+    pointer_registry_table *table = calloc(1, sizeof(pointer_registry_table) +
+                                              slots * sizeof(pointer_registry_slot));
+    if (!table) return NULL;
+    table->mask     = slots - 1;
+    table->shift    = 64 - bits;
+    return table;
+}
+
+int pointer_registry_init(pointer_registry *registry, size_t capacity)
+{
+    registry->table     = pointer_registry_table_create(capacity);
+    registry->count     = 0;
+    registry->removed   = 0;
+    if (!registry->table) return -1;
+    pthread_mutex_init(&registry->lock, NULL);
+    return 0;
+}
+
+void pointer_registry_free(pointer_registry *registry)
+{
+    pointer_registry_table *table = registry->table;
+    while (table)
+    {
+        pointer_registry_table *retired = table->retired;
+        free(table);
+        table = retired;
+    }
+    registry->table = NULL;
+    pthread_mutex_destroy(&registry->lock);
+}
+
+void *pointer_registry_get(const pointer_registry *registry, const void *key)
+{
+    const pointer_registry_table *table = __atomic_load_n(&registry->table, __ATOMIC_ACQUIRE);
+    uintptr_t k = (uintptr_t)key;
+
+    for (size_t i = pointer_registry_hash(k, table->shift); ; i = (i + 1) & table->mask)
+    {
+        uintptr_t slotKey = __atomic_load_n(&table->slots[i].key, __ATOMIC_ACQUIRE);
+        if (slotKey == SLOT_EMPTY) return NULL;
+        if (slotKey != k) continue;
+
+        void *value = __atomic_load_n(&table->slots[i].value, __ATOMIC_ACQUIRE);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        return __atomic_load_n(&table->slots[i].key, __ATOMIC_RELAXED) == k ? value : NULL;
+    }
+}
+
+void *pointer_registry_get_retained(pointer_registry *registry, const void *key,
+                                    void (*retain)(void *value))
+{
+    // Not registered? No lock needed to say so
+    if (!pointer_registry_get(registry, key)) return NULL;
+
+    // Otherwise retain it while no writer can remove it
+    pthread_mutex_lock(&registry->lock);
+    void *value = pointer_registry_get(registry, key);
+    if (value) retain(value);
+    pthread_mutex_unlock(&registry->lock);
+    return value;
+}
+
+// Finds a pointer's slot in a table, or where it would go; writers only
+static pointer_registry_slot *pointer_registry_find(pointer_registry_table *table, uintptr_t k,
+                                                    int *found)
+{
+    pointer_registry_slot *reusable = NULL;
+
+    for (size_t i = pointer_registry_hash(k, table->shift); ; i = (i + 1) & table->mask)
+    {
+        pointer_registry_slot *slot = &table->slots[i];
+        if (slot->key == k)
+        {
+            *found = 1;
+            return slot;
+        }
+        if (slot->key == SLOT_REMOVED && !reusable) reusable = slot;
+        if (slot->key == SLOT_EMPTY)
+        {
+            *found = 0;
+            return reusable ? reusable : slot;
+        }
+    }
+}
+
+// Moves every registered pointer into a new table sized for them, which
+// lookups see from then on; writers only
+static int pointer_registry_resize(pointer_registry *registry, size_t capacity)
+{
+    pointer_registry_table *old = registry->table;
+    pointer_registry_table *table = pointer_registry_table_create(capacity);
+    if (!table) return -1;
+
+    for (size_t i = 0; i <= old->mask; i++)
+    {
+        if (old->slots[i].key <= SLOT_REMOVED) continue;
+
+        int found;
+        pointer_registry_slot *slot = pointer_registry_find(table, old->slots[i].key, &found);
+        *slot = old->slots[i];
+    }
+    table->retired      = old;
+    registry->removed   = 0;
+    __atomic_store_n(&registry->table, table, __ATOMIC_RELEASE);
+    return 0;
+}
+
+void *pointer_registry_put(pointer_registry *registry, const void *key, void *value)
+{
+    uintptr_t k = (uintptr_t)key;
+    void *previous = NULL;
+    int found;
+
+    pthread_mutex_lock(&registry->lock);
+
+    // Keep at least a quarter of the slots empty, so probes stay short
+    // (and always end), by moving into a table with room for twice as
+    // many pointers as are registered (which clears out removed slots)
+    pointer_registry_table *table = registry->table;
+    if ((registry->count + registry->removed + 1) * 4 > (table->mask + 1) * 3)
+    {
+        if (pointer_registry_resize(registry, registry->count * 2) == 0) table = registry->table;
+    }
+
+    pointer_registry_slot *slot = pointer_registry_find(table, k, &found);
+    if (found)
+    {
+        previous = slot->value;
+        __atomic_store_n(&slot->value, value, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        // Released, so a lookup that still sees the slot's old key but
+        // this value also sees that the old key was removed
+        if (slot->key == SLOT_REMOVED) registry->removed--;
+        __atomic_store_n(&slot->value, value, __ATOMIC_RELEASE);
+        __atomic_store_n(&slot->key, k, __ATOMIC_RELEASE);
+        __atomic_store_n(&registry->count, registry->count + 1, __ATOMIC_RELAXED);
+    }
+
+    pthread_mutex_unlock(&registry->lock);
+    return previous;
+}
+
+void *pointer_registry_remove(pointer_registry *registry, const void *key)
+{
+    void *previous = NULL;
+    int found;
+
+    pthread_mutex_lock(&registry->lock);
+
+    pointer_registry_slot *slot = pointer_registry_find(registry->table, (uintptr_t)key, &found);
+    if (found)
+    {
+        previous = slot->value;
+        __atomic_store_n(&slot->value, NULL, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->key, SLOT_REMOVED, __ATOMIC_RELEASE);
+        __atomic_store_n(&registry->count, registry->count - 1, __ATOMIC_RELAXED);
+        registry->removed++;
+    }
+
+    pthread_mutex_unlock(&registry->lock);
+    return previous;
+}
+
+size_t pointer_registry_count(const pointer_registry *registry)
+{
+    return __atomic_load_n(&registry->count, __ATOMIC_RELAXED);
+}
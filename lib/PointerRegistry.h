@@ -0,0 +1,54 @@
+//----------------------------------------------------------------------------
+// PointerRegistry.h
+//----------------------------------------------------------------------------
+//
+//  Maps SwinGame pointers to the objects wrapping them, for PointerManager.
+//  An open-addressing hash table keyed on the pointer itself (no boxing),
+//  probed linearly. Lookups take no lock and may run on any thread while
+//  one thread at a time registers or removes (writers are serialised by a
+//  mutex). A table outgrown by a resize is kept until the registry is
+//  freed, as a lookup may still be probing it. A plain lookup does not
+//  keep the object it finds alive; pointer_registry_get_retained retains
+//  it under the lock, so that it cannot be removed (and freed) first.
+//
+//----------------------------------------------------------------------------
+
+#ifndef PointerRegistry_h
+#define PointerRegistry_h
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct pointer_registry_slot
+{
+    uintptr_t   key;    // The pointer, or 0 (never used) or 1 (removed)
+    void        *value; // The object registered for it
+} pointer_registry_slot;
+
+typedef struct pointer_registry_table
+{
+    size_t                          mask;       // Number of slots - 1 (a power of two)
+    int                             shift;      // 64 - log2(number of slots), for hashing
+    struct pointer_registry_table   *retired;   // The table this one replaced
+    pointer_registry_slot           slots[];
+} pointer_registry_table;
+
+typedef struct pointer_registry
+{
+    pointer_registry_table  *table;     // The current table, swapped whole on resize
+    size_t                  count;      // Pointers registered
+    size_t                  removed;    // Slots marked removed, until the next resize
+    pthread_mutex_t         lock;       // Held by whichever thread is writing
+} pointer_registry;
+
+int     pointer_registry_init(pointer_registry *registry, size_t capacity);
+void    pointer_registry_free(pointer_registry *registry);
+void    *pointer_registry_get(const pointer_registry *registry, const void *key);
+void    *pointer_registry_get_retained(pointer_registry *registry, const void *key,
+                                       void (*retain)(void *value));
+void    *pointer_registry_put(pointer_registry *registry, const void *key, void *value);
+void    *pointer_registry_remove(pointer_registry *registry, const void *key);
+size_t  pointer_registry_count(const pointer_registry *registry);
+
+#endif
@@ -216,3 +216,25 @@
 
 @end
 
+
+// The geometry and collision predicates above, taking and returning the
+// Types.h structs by value instead of wrapper objects, so they allocate
+// nothing and need no autorelease pool. Those GeometryInline.h covers are
+// worked out inline rather than in the native library
+@interface SGGeometry (SGGeometryData)
+
++ (point2d)pointDataAtX:(float)x  y:(float)y;
++ (point2d)pointData:(point2d)pt1  plusPointData:(point2d)pt2;
++ (BOOL)pointData:(point2d)pt  inRectData:(rectangle)rect;
++ (BOOL)pointData:(point2d)pt  inRectX:(float)x  y:(float)y  width:(float)w  height:(float)h;
++ (BOOL)pointData:(point2d)pt  inTriangleData:(triangle)tri;
++ (rectangle)rectangleDataAtX:(float)x  y:(float)y  width:(int)w  height:(int)h;
++ (rectangle)rectangleDataFrom:(point2d)pt1  to:(point2d)pt2;
++ (rectangle)rectangleDataFromTriangle:(triangle)tri;
++ (point2d)rectangleCenterData:(rectangle)rect;
++ (BOOL)rectangleData:(rectangle)rect1  intersectsRectangleData:(rectangle)rect2;
++ (triangle)triangleDataFromPtA:(point2d)a  ptB:(point2d)b  ptC:(point2d)c;
++ (point2d)triangleBarycenterData:(triangle)tri;
++ (BOOL)triangleData:(triangle)tri  intersectsRectangleData:(rectangle)rect;
+
+@end
@@ -5,6 +5,7 @@
 #import "SGGeometry.h"
 #import "SGSDK.h"
 #import "SwinGame.h"
+#import "GeometryInline.h"
 
 #import <stdlib.h>
 
@@ -1203,4 +1204,73 @@
 
 
 
+@end
+
+@implementation SGGeometry (SGGeometryData)
+
++ (point2d)pointDataAtX:(float)x  y:(float)y
+{
+    return point_at_inline(x, y);
+}
+
++ (point2d)pointData:(point2d)pt1  plusPointData:(point2d)pt2
+{
+    return point_add_inline(&pt1, &pt2);
+}
+
++ (BOOL)pointData:(point2d)pt  inRectData:(rectangle)rect
+{
+    return point_in_rect_inline(&pt, &rect);
+}
+
++ (BOOL)pointData:(point2d)pt  inRectX:(float)x  y:(float)y  width:(float)w  height:(float)h
+{
+    return point_in_rect_xy_inline(&pt, x, y, w, h);
+}
+
++ (BOOL)pointData:(point2d)pt  inTriangleData:(triangle)tri
+{
+    return point_in_triangle_inline(&pt, &tri);
+}
+
++ (rectangle)rectangleDataAtX:(float)x  y:(float)y  width:(int)w  height:(int)h
+{
+    return rectangle_from_inline(x, y, w, h);
+}
+
++ (rectangle)rectangleDataFrom:(point2d)pt1  to:(point2d)pt2
+{
+    return rectangle_for_points_inline(&pt1, &pt2);
+}
+
++ (rectangle)rectangleDataFromTriangle:(triangle)tri
+{
+    return rectangle_from_triangle_inline(&tri);
+}
+
++ (point2d)rectangleCenterData:(rectangle)rect
+{
+    return rectangle_center_inline(&rect);
+}
+
++ (BOOL)rectangleData:(rectangle)rect1  intersectsRectangleData:(rectangle)rect2
+{
+    return rectangles_intersect_inline(&rect1, &rect2);
+}
+
++ (triangle)triangleDataFromPtA:(point2d)a  ptB:(point2d)b  ptC:(point2d)c
+{
+    return triangle_from_points_inline(&a, &b, &c);
+}
+
++ (point2d)triangleBarycenterData:(triangle)tri
+{
+    return triangle_barycenter_inline(&tri);
+}
+
++ (BOOL)triangleData:(triangle)tri  intersectsRectangleData:(rectangle)rect
+{
+    return sg_Geometry_TriangleRectangleIntersect(&tri, &rect) != 0;
+}
+
 @end
@@ -67,16 +67,28 @@
 
 @end
 
+// Plain C callbacks a wrapped point reads and updates its owner through,
+// given the context it was created with
+typedef point2d (*SGPoint2DReadFn)(void *context);
+typedef void (*SGPoint2DUpdateFn)(void *context, const point2d *value);
+
 @interface SGWrappedPoint2D : SGPoint2D
 {
 @package
-    id       delegate;
-    SEL      call_on_update;
-    SEL      call_on_read;
+    id                  delegate;
+    SEL                 call_on_update;
+    SEL                 call_on_read;
+    IMP                 update_imp;     // Resolved once, from call_on_update
+    IMP                 read_imp;       // Resolved once, from call_on_read
+    SGPoint2DUpdateFn   update_fn;      // Called in place of the selectors, if set
+    SGPoint2DReadFn     read_fn;
+    void                *context;
 }
 
 + (SGWrappedPoint2D *) point2DWithDelegate:(id)del update:(SEL)sel1 andRead:(SEL)sel2;
++ (SGWrappedPoint2D *) point2DWithDelegate:(id)del context:(void *)ctx update:(SGPoint2DUpdateFn)fn1 andRead:(SGPoint2DReadFn)fn2;
 - (id) initPoint2DWithDelegate:(id)del update:(SEL)sel1 andRead:(SEL)sel2;
+- (id) initPoint2DWithDelegate:(id)del context:(void *)ctx update:(SGPoint2DUpdateFn)fn1 andRead:(SGPoint2DReadFn)fn2;
 
 @end
 
@@ -1,7 +1,5 @@
 #import "SGPoint2D.h"
 
-#import <Foundation/NSInvocation.h>
-
 #import "PointerManager.h"
 #import "SGSDK.h"
 #import "SwinGame.h"
@@ -15,6 +13,13 @@
     return ret;
 }
 
++ (SGWrappedPoint2D *) point2DWithDelegate:(id)del context:(void *)ctx update:(SGPoint2DUpdateFn)fn1 andRead:(SGPoint2DReadFn)fn2
+{
+    SGWrappedPoint2D *ret = [[SGWrappedPoint2D alloc] initPoint2DWithDelegate:del context:ctx update:fn1 andRead:fn2];
+    [ret autorelease];
+    return ret;
+}
+
 - (id)initPoint2DWithDelegate:(id)del update:(SEL)sel1 andRead:(SEL)sel2
 {
     self = [super init];
@@ -25,6 +30,26 @@
         call_on_read   = sel2;
         delegate       = del;
         
+        //Look the methods up once, rather than on every access
+        update_imp     = sel1 ? [delegate methodForSelector:sel1] : NULL;
+        read_imp       = sel2 ? [delegate methodForSelector:sel2] : NULL;
+        
+        [delegate retain];
+    }
+    return self;
+}
+
+- (id)initPoint2DWithDelegate:(id)del context:(void *)ctx update:(SGPoint2DUpdateFn)fn1 andRead:(SGPoint2DReadFn)fn2
+{
+    self = [super init];
+    if (self != nil)
+    {
+        //The delegate is retained so that the context stays valid
+        update_fn      = fn1;
+        read_fn        = fn2;
+        context        = ctx;
+        delegate       = del;
+        
         [delegate retain];
     }
     return self;
@@ -38,25 +63,27 @@
 
 - (void) callUpdate
 {
-    if (delegate == nil || call_on_update == nil) return;
-    
-    NSMethodSignature *sig = [self methodSignatureForSelector:call_on_update];
-    NSInvocation *inv = [NSInvocation invocationWithMethodSignature: sig];
-    [inv setArgument:&self atIndex:2]; //first arg after self + _cmd (for call)
-    [inv invokeWithTarget: delegate]; //call on the delegate
+    if (update_fn)
+    {
+        update_fn(context, &data);
+    }
+    else if (update_imp)
+    {
+        ((void (*)(id, SEL, SGPoint2D *))update_imp)(delegate, call_on_update, self);
+    }
 }
 
 - (void) callRead
 {
-    if (delegate == nil || call_on_read == nil) return;
-    
-    NSMethodSignature *sig = [self methodSignatureForSelector:call_on_read];
-    NSInvocation *inv = [NSInvocation invocationWithMethodSignature: sig];
-    [inv invokeWithTarget: delegate]; //call on the delegate
-    
-    SGPoint2D *ret;
-    [inv getReturnValue: &ret];
-    data = ret->data;
+    if (read_fn)
+    {
+        data = read_fn(context);
+    }
+    else if (read_imp)
+    {
+        SGPoint2D *ret = ((SGPoint2D *(*)(id, SEL))read_imp)(delegate, call_on_read);
+        data = ret->data;
+    }
 }
 
 
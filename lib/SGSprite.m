@@ -465,10 +465,20 @@
     sg_Sprites_SpriteSetPosition(self->pointer, &value->data);
 }
 
+static point2d readPosition(void *ctx)
+{
+    return sg_Sprites_SpritePosition(((SGSprite *)ctx)->pointer);
+}
+
+static void updatePosition(void *ctx, const point2d *value)
+{
+    sg_Sprites_SpriteSetPosition(((SGSprite *)ctx)->pointer, value);
+}
+
 - (SGPoint2D *)position
 {
     SGWrappedPoint2D *result;
-    result = [SGWrappedPoint2D point2DWithDelegate:self update:@selector(setPosition:) andRead: @selector(pri_position)];
+    result = [SGWrappedPoint2D point2DWithDelegate:self context:self update:updatePosition andRead:readPosition];
     return result;
 }
 
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------
+// SGHeadless.h
+//----------------------------------------------------------------------------
+//
+//  Headless stand-in for the SGSDK native library. Implements the sg_*
+//  entry points used by Dart Dodger without a window, audio device or
+//  image decoder so the game and the C/Obj-C wrappers can be run and
+//  benchmarked on machines without SGSDK.framework (e.g. Linux CI).
+//
+//  The functions below are extras that only exist in the headless
+//  backend; they let a driver control the clock, the keyboard and the
+//  window lifetime that the native library would normally own.
+//
+//----------------------------------------------------------------------------
+
+#ifndef SGHeadless
+#define SGHeadless
+
+#include <stdint.h>
+
+#ifndef __cplusplus
+  #include <stdbool.h>
+#endif
+
+#include "Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counters updated by the backend, read with sg_Headless_Stats()
+typedef struct _headless_stats {
+    uint64_t frames;                //!< Calls to sg_Input_ProcessEvents
+    uint64_t refreshes;             //!< Calls to sg_Graphics_RefreshScreen
+    uint64_t bitmap_loads;          //!< Bitmaps actually created by a load call
+    uint64_t bitmap_load_calls;     //!< All calls into a bitmap load entry point
+    uint64_t bitmap_bytes;          //!< Bytes currently held by bitmap surfaces
+    uint64_t bitmap_draws;          //!< Bitmap blits (screen or bitmap target)
+    uint64_t text_draws;            //!< Text draw calls
+    uint64_t sound_loads;           //!< Sound effects created by a load call
+    uint64_t sound_plays;           //!< Sound effect play calls
+    uint64_t pixels_written;        //!< Pixels written to any surface
+    uint64_t unimplemented_calls;   //!< Calls into generated stub entry points
+} headless_stats;
+
+// Clock: ticks are virtual milliseconds unless the real clock is selected
+void     sg_Headless_UseRealClock(bool realClock);
+void     sg_Headless_SetTicks(uint32_t ticks);
+void     sg_Headless_AdvanceTicks(uint32_t ms);
+void     sg_Headless_SetFrameTicks(uint32_t ms);
+
+// Window: sg_Input_WindowCloseRequested turns true after frameLimit frames
+void     sg_Headless_SetFrameLimit(uint64_t frameLimit);
+void     sg_Headless_RequestClose();
+
+// Keyboard: key state as seen by the next sg_Input_ProcessEvents
+void     sg_Headless_SetKeyDown(key_code key, bool down);
+void     sg_Headless_QueueKeyTyped(key_code key);
+void     sg_Headless_ReleaseAllKeys();
+
+// Random numbers used by sg_Utils_Rnd and sg_Utils_RndUpto
+void     sg_Headless_SeedRandom(uint32_t seed);
+
+// Resources: directory containing images/, fonts/, sounds/
+void     sg_Headless_SetResourcePath(const char *path);
+
+// Screen surface (ARGB, ScreenWidth x ScreenHeight) and counters
+bitmap   sg_Headless_Screen();
+const uint32_t *sg_Headless_Pixels(bitmap bmp);
+headless_stats sg_Headless_Stats();
+void     sg_Headless_ResetStats();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
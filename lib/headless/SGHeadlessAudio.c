@@ -0,0 +1,264 @@
+//----------------------------------------------------------------------------
+// SGHeadlessAudio.c
+//----------------------------------------------------------------------------
+//
+//  Headless SGSDK: sound effects and music. Nothing is decoded or mixed;
+//  loads create named records and plays are counted. A played effect
+//  reports itself as playing for SGH_SOUND_MS ticks per loop so callers
+//  that poll SoundEffectPlaying see the same on/off pattern as a device.
+//
+//----------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "SGHeadlessPrivate.h"
+
+#define SGH_SOUND_MS    500
+
+typedef struct _sgh_sound {
+    sound_effect_data   data;
+    uint32_t            playing_until;
+    char                name[SGH_NAME_LEN];
+    char                filename[SGH_NAME_LEN];
+    struct _sgh_sound  *next;
+} sgh_sound;
+
+typedef struct _sgh_music {
+    music_data          data;
+    char                name[SGH_NAME_LEN];
+    char                filename[SGH_NAME_LEN];
+    struct _sgh_music  *next;
+} sgh_music;
+
+static sgh_sound   *_effects        = NULL;
+static sgh_music   *_music          = NULL;
+static music        _currentMusic   = NULL;
+static bool         _musicPaused    = false;
+static float        _musicVolume    = 1.0f;
+
+//----------------------------------------------------------------------------
+// Device
+//----------------------------------------------------------------------------
+
+void sg_Audio_OpenAudio()           { }
+bool sg_Audio_TryOpenAudio()        { return true; }
+bool sg_Audio_AudioReady()          { return true; }
+
+void sg_Audio_CloseAudio()
+{
+    sg_Audio_StopMusic();
+}
+
+//----------------------------------------------------------------------------
+// Sound effects
+//----------------------------------------------------------------------------
+
+sound_effect sg_Audio_SoundEffectNamed(const char *name)
+{
+    for (sgh_sound *snd = _effects; snd; snd = snd->next)
+        if (strcmp(snd->name, name) == 0) return &snd->data;
+    return NULL;
+}
+
+bool sg_Audio_HasSoundEffect(const char *name)
+{
+    return sg_Audio_SoundEffectNamed(name) != NULL;
+}
+
+sound_effect sg_Audio_LoadSoundEffectNamed(const char *name, const char *filename)
+{
+    sound_effect existing = sg_Audio_SoundEffectNamed(name);
+    if (existing) return existing;
+
+    sgh_sound *result = calloc(1, sizeof(sgh_sound));
+    sgh_CopyName(result->name, name);
+    sgh_CopyName(result->filename, filename);
+    result->data.name       = result->name;
+    result->data.filename   = result->filename;
+    result->next            = _effects;
+    _effects = result;
+
+    sgh_stats.sound_loads++;
+    return &result->data;
+}
+
+sound_effect sg_Audio_LoadSoundEffect(const char *filename)
+{
+    return sg_Audio_LoadSoundEffectNamed(filename, filename);
+}
+
+void sg_Audio_FreeSoundEffect(sound_effect *effect)
+{
+    if (effect == NULL || *effect == NULL) return;
+
+    sgh_sound **link = &_effects;
+    while (*link && &(*link)->data != *effect) link = &(*link)->next;
+    if (*link)
+    {
+        sgh_sound *dead = *link;
+        *link = dead->next;
+        sgh_NotifyFree(dead);
+        free(dead);
+    }
+    *effect = NULL;
+}
+
+void sg_Audio_ReleaseSoundEffect(const char *name)
+{
+    sound_effect effect = sg_Audio_SoundEffectNamed(name);
+    sg_Audio_FreeSoundEffect(&effect);
+}
+
+void sg_Audio_ReleaseAllSoundEffects()
+{
+    while (_effects)
+    {
+        sound_effect effect = &_effects->data;
+        sg_Audio_FreeSoundEffect(&effect);
+    }
+}
+
+void sg_Audio_PlaySoundEffectWithLoopAndVolume(sound_effect effect, int32_t loops, float vol)
+{
+    if (effect == NULL) return;
+    ((sgh_sound *)effect)->playing_until = sg_Utils_GetTicks() + SGH_SOUND_MS * (loops > 0 ? loops : 1);
+    sgh_stats.sound_plays++;
+}
+
+void sg_Audio_PlaySoundEffectNamedWithLoopAndVolume(const char *name, int32_t loops, float vol)
+{
+    sg_Audio_PlaySoundEffectWithLoopAndVolume(sg_Audio_SoundEffectNamed(name), loops, vol);
+}
+
+bool sg_Audio_SoundEffectPlaying(sound_effect effect)
+{
+    return effect && sg_Utils_GetTicks() < ((sgh_sound *)effect)->playing_until;
+}
+
+bool sg_Audio_SoundEffectNamedPlaying(const char *name)
+{
+    return sg_Audio_SoundEffectPlaying(sg_Audio_SoundEffectNamed(name));
+}
+
+void sg_Audio_StopSoundEffect(sound_effect effect)
+{
+    if (effect) ((sgh_sound *)effect)->playing_until = 0;
+}
+
+void sg_Audio_StopSoundEffectNamed(const char *name)
+{
+    sg_Audio_StopSoundEffect(sg_Audio_SoundEffectNamed(name));
+}
+
+void sg_Audio_SoundEffectName(sound_effect effect, char *result)
+{
+    strcpy(result, effect ? effect->name : "");
+}
+
+void sg_Audio_SoundEffectFilename(sound_effect effect, char *result)
+{
+    strcpy(result, effect ? effect->filename : "");
+}
+
+//----------------------------------------------------------------------------
+// Music
+//----------------------------------------------------------------------------
+
+music sg_Audio_MusicNamed(const char *name)
+{
+    for (sgh_music *mus = _music; mus; mus = mus->next)
+        if (strcmp(mus->name, name) == 0) return &mus->data;
+    return NULL;
+}
+
+bool sg_Audio_HasMusic(const char *name)
+{
+    return sg_Audio_MusicNamed(name) != NULL;
+}
+
+music sg_Audio_LoadMusicNamed(const char *name, const char *filename)
+{
+    music existing = sg_Audio_MusicNamed(name);
+    if (existing) return existing;
+
+    sgh_music *result = calloc(1, sizeof(sgh_music));
+    sgh_CopyName(result->name, name);
+    sgh_CopyName(result->filename, filename);
+    result->data.name       = result->name;
+    result->data.filename   = result->filename;
+    result->next            = _music;
+    _music = result;
+    return &result->data;
+}
+
+music sg_Audio_LoadMusic(const char *filename)
+{
+    return sg_Audio_LoadMusicNamed(filename, filename);
+}
+
+void sg_Audio_FreeMusic(music *mus)
+{
+    if (mus == NULL || *mus == NULL) return;
+    if (*mus == _currentMusic) _currentMusic = NULL;
+
+    sgh_music **link = &_music;
+    while (*link && &(*link)->data != *mus) link = &(*link)->next;
+    if (*link)
+    {
+        sgh_music *dead = *link;
+        *link = dead->next;
+        sgh_NotifyFree(dead);
+        free(dead);
+    }
+    *mus = NULL;
+}
+
+void sg_Audio_ReleaseMusic(const char *name)
+{
+    music mus = sg_Audio_MusicNamed(name);
+    sg_Audio_FreeMusic(&mus);
+}
+
+void sg_Audio_ReleaseAllMusic()
+{
+    while (_music)
+    {
+        music mus = &_music->data;
+        sg_Audio_FreeMusic(&mus);
+    }
+}
+
+void sg_Audio_PlayMusicWithLoops(music mus, int32_t loops)
+{
+    _currentMusic   = mus;
+    _musicPaused    = false;
+}
+
+void sg_Audio_PlayMusicNamedWithLoops(const char *name, int32_t loops)
+{
+    sg_Audio_PlayMusicWithLoops(sg_Audio_MusicNamed(name), loops);
+}
+
+void sg_Audio_FadeMusicIn(music mus, int32_t ms)                            { sg_Audio_PlayMusicWithLoops(mus, 1); }
+void sg_Audio_FadeMusicInWithLoops(music mus, int32_t loops, int32_t ms)    { sg_Audio_PlayMusicWithLoops(mus, loops); }
+void sg_Audio_FadeMusicNamedIn(const char *name, int32_t ms)                { sg_Audio_PlayMusicNamedWithLoops(name, 1); }
+void sg_Audio_FadeMusicNamedInWithLoops(const char *name, int32_t loops, int32_t ms) { sg_Audio_PlayMusicNamedWithLoops(name, loops); }
+void sg_Audio_FadeMusicOut(int32_t ms)                                      { sg_Audio_StopMusic(); }
+
+void sg_Audio_StopMusic()           { _currentMusic = NULL; }
+void sg_Audio_PauseMusic()          { _musicPaused = true; }
+void sg_Audio_ResumeMusic()         { _musicPaused = false; }
+bool sg_Audio_MusicPlaying()        { return _currentMusic != NULL && !_musicPaused; }
+float sg_Audio_MusicVolume()        { return _musicVolume; }
+void sg_Audio_SetMusicVolume(float value) { _musicVolume = value; }
+
+void sg_Audio_MusicName(music mus, char *result)
+{
+    strcpy(result, mus ? mus->name : "");
+}
+
+void sg_Audio_MusicFilename(music mus, char *result)
+{
+    strcpy(result, mus ? mus->filename : "");
+}
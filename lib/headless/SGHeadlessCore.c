@@ -0,0 +1,451 @@
+//----------------------------------------------------------------------------
+// SGHeadlessCore.c
+//----------------------------------------------------------------------------
+//
+//  Headless SGSDK: clock, timers, utils, input and resource paths.
+//
+//  Ticks come from a virtual millisecond clock by default. The clock
+//  advances by the frame period on every sg_Input_ProcessEvents and by
+//  the requested amount on sg_Utils_Delay (without sleeping), so an
+//  unmodified game loop runs deterministically and as fast as the CPU
+//  allows. sg_Headless_UseRealClock switches to the monotonic clock.
+//
+//----------------------------------------------------------------------------
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "SGHeadlessPrivate.h"
+
+headless_stats sgh_stats;
+
+static bool         _realClock      = false;
+static uint32_t     _virtualTicks   = 0;
+static uint32_t     _frameTicks     = 16;
+static uint64_t     _frameLimit     = 0;
+static bool         _closeRequested = false;
+
+static bool         _keyDown[SGH_MAX_KEYS];
+static bool         _keyTyped[SGH_MAX_KEYS];
+static bool         _keyQueued[SGH_MAX_KEYS];
+static bool         _keyReleased[SGH_MAX_KEYS];
+static bool         _keyWasDown[SGH_MAX_KEYS];
+
+static uint32_t     _rndState       = 0x2545F491u;
+
+static char         _appPath[SGH_NAME_LEN]      = ".";
+static char         _resourcePath[SGH_NAME_LEN] = "";
+
+static void (*_freeNotifier)(void *ptr) = NULL;
+
+static timer_data  *_namedTimers[64];
+static int32_t      _namedTimerCount = 0;
+
+//----------------------------------------------------------------------------
+// Shared helpers
+//----------------------------------------------------------------------------
+
+void sgh_NotifyFree(void *ptr)
+{
+    if (_freeNotifier) _freeNotifier(ptr);
+}
+
+void sgh_Unimplemented(const char *name)
+{
+    fprintf(stderr, "SGHeadless: %s is not implemented headless; returning zero\n", name);
+}
+
+void sgh_CopyName(char *dest, const char *src)
+{
+    if (src == NULL) src = "";
+    strncpy(dest, src, SGH_NAME_LEN - 1);
+    dest[SGH_NAME_LEN - 1] = '\0';
+}
+
+void sgh_ResourcePath(const char *subdir, const char *filename, char *result, size_t len)
+{
+    const char *base = _resourcePath[0] ? _resourcePath : NULL;
+    char fallback[SGH_NAME_LEN * 2];
+
+    if (base == NULL)
+    {
+        const char *env = getenv("SG_HEADLESS_RESOURCES");
+        if (env && env[0]) base = env;
+        else
+        {
+            snprintf(fallback, sizeof(fallback), "%s/Resources", _appPath);
+            base = fallback;
+        }
+    }
+
+    if (subdir && subdir[0]) snprintf(result, len, "%s/%s/%s", base, subdir, filename);
+    else                     snprintf(result, len, "%s/%s", base, filename);
+}
+
+//----------------------------------------------------------------------------
+// Headless controls
+//----------------------------------------------------------------------------
+
+void sg_Headless_UseRealClock(bool realClock)
+{
+    _realClock = realClock;
+}
+
+void sg_Headless_SetTicks(uint32_t ticks)
+{
+    _virtualTicks = ticks;
+}
+
+void sg_Headless_AdvanceTicks(uint32_t ms)
+{
+    _virtualTicks += ms;
+}
+
+void sg_Headless_SetFrameTicks(uint32_t ms)
+{
+    _frameTicks = ms;
+}
+
+void sg_Headless_SetFrameLimit(uint64_t frameLimit)
+{
+    _frameLimit = frameLimit;
+}
+
+void sg_Headless_RequestClose()
+{
+    _closeRequested = true;
+}
+
+void sg_Headless_SetKeyDown(key_code key, bool down)
+{
+    if ((unsigned)key >= SGH_MAX_KEYS) return;
+    if (down && !_keyDown[key]) _keyQueued[key] = true;
+    _keyDown[key] = down;
+}
+
+void sg_Headless_QueueKeyTyped(key_code key)
+{
+    if ((unsigned)key >= SGH_MAX_KEYS) return;
+    _keyQueued[key] = true;
+}
+
+void sg_Headless_ReleaseAllKeys()
+{
+    memset(_keyDown, 0, sizeof(_keyDown));
+    memset(_keyQueued, 0, sizeof(_keyQueued));
+}
+
+void sg_Headless_SeedRandom(uint32_t seed)
+{
+    _rndState = seed ? seed : 0x2545F491u;
+}
+
+void sg_Headless_SetResourcePath(const char *path)
+{
+    sgh_CopyName(_resourcePath, path);
+}
+
+headless_stats sg_Headless_Stats()
+{
+    return sgh_stats;
+}
+
+void sg_Headless_ResetStats()
+{
+    uint64_t bytes = sgh_stats.bitmap_bytes;
+    memset(&sgh_stats, 0, sizeof(sgh_stats));
+    sgh_stats.bitmap_bytes = bytes;     // Still allocated, so keep it
+}
+
+//----------------------------------------------------------------------------
+// Utils
+//----------------------------------------------------------------------------
+
+uint32_t sg_Utils_GetTicks()
+{
+    if (_realClock)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint32_t)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000u);
+    }
+    return _virtualTicks;
+}
+
+void sg_Utils_Delay(uint32_t time)
+{
+    if (_realClock)
+    {
+        struct timespec ts = { time / 1000, (long)(time % 1000) * 1000000L };
+        nanosleep(&ts, NULL);
+    }
+    else _virtualTicks += time;
+}
+
+float sg_Utils_Rnd()
+{
+    // xorshift32; only needs to be cheap and repeatable for a given seed
+    _rndState ^= _rndState << 13;
+    _rndState ^= _rndState >> 17;
+    _rndState ^= _rndState << 5;
+    return (_rndState >> 8) * (1.0f / 16777216.0f);
+}
+
+int32_t sg_Utils_RndUpto(int32_t ubound)
+{
+    return (int32_t)(sg_Utils_Rnd() * ubound);
+}
+
+int32_t sg_Utils_GetFramerate()
+{
+    return _frameTicks ? (int32_t)(1000 / _frameTicks) : 0;
+}
+
+void sg_Utils_CalculateFramerate(char *average, char *highest, char *lowest, color *textColor)
+{
+    int32_t fps = sg_Utils_GetFramerate();
+    sprintf(average, "%d", fps);
+    sprintf(highest, "%d", fps);
+    sprintf(lowest,  "%d", fps);
+    if (textColor) *textColor = 0xff00ff00;
+}
+
+void sg_Utils_ExceptionMessage(char *result)
+{
+    result[0] = '\0';
+}
+
+bool sg_Utils_ExceptionOccured()
+{
+    return false;
+}
+
+void sg_Utils_SwinGameVersion(char *result)
+{
+    strcpy(result, "3.0 headless");
+}
+
+//----------------------------------------------------------------------------
+// Timers (same semantics as sgTimers.pas, driven by sg_Utils_GetTicks)
+//----------------------------------------------------------------------------
+
+timer sg_Timers_CreateTimer()
+{
+    timer_data *result = calloc(1, sizeof(timer_data));
+    return result;
+}
+
+timer sg_Timers_CreateTimerNamed(const char *name)
+{
+    timer_data *result = sg_Timers_CreateTimer();
+    char *nameCopy = malloc(SGH_NAME_LEN);
+    sgh_CopyName(nameCopy, name);
+    result->name = nameCopy;
+    if (_namedTimerCount < 64) _namedTimers[_namedTimerCount++] = result;
+    return result;
+}
+
+timer sg_Timers_TimerNamed(const char *name)
+{
+    for (int32_t i = 0; i < _namedTimerCount; i++)
+        if (strcmp(_namedTimers[i]->name, name) == 0) return _namedTimers[i];
+    return NULL;
+}
+
+void sg_Timers_FreeTimer(timer *toFree)
+{
+    if (toFree == NULL || *toFree == NULL) return;
+    timer tmr = *toFree;
+
+    for (int32_t i = 0; i < _namedTimerCount; i++)
+        if (_namedTimers[i] == tmr) _namedTimers[i] = _namedTimers[--_namedTimerCount];
+
+    sgh_NotifyFree(tmr);
+    free((void *)tmr->name);
+    free(tmr);
+    *toFree = NULL;
+}
+
+void sg_Timers_ReleaseTimer(const char *name)
+{
+    timer tmr = sg_Timers_TimerNamed(name);
+    sg_Timers_FreeTimer(&tmr);
+}
+
+void sg_Timers_ReleaseAllTimers()
+{
+    while (_namedTimerCount > 0)
+    {
+        timer tmr = _namedTimers[0];
+        sg_Timers_FreeTimer(&tmr);
+    }
+}
+
+void sg_Timers_StartTimer(timer toStart)
+{
+    if (toStart == NULL) return;
+    toStart->started        = true;
+    toStart->paused         = false;
+    toStart->start_ticks    = sg_Utils_GetTicks();
+}
+
+void sg_Timers_StopTimer(timer toStop)
+{
+    if (toStop == NULL) return;
+    toStop->started = false;
+    toStop->paused  = false;
+}
+
+void sg_Timers_PauseTimer(timer toPause)
+{
+    if (toPause == NULL) return;
+    if (toPause->started && !toPause->paused)
+    {
+        toPause->paused         = true;
+        toPause->paused_ticks   = sg_Utils_GetTicks() - toPause->start_ticks;
+    }
+}
+
+void sg_Timers_ResumeTimer(timer toUnpause)
+{
+    if (toUnpause == NULL) return;
+    if (toUnpause->paused)
+    {
+        toUnpause->paused       = false;
+        toUnpause->start_ticks  = sg_Utils_GetTicks() - toUnpause->paused_ticks;
+        toUnpause->paused_ticks = 0;
+    }
+}
+
+void sg_Timers_ResetTimer(timer tmr)
+{
+    if (tmr == NULL) return;
+    tmr->start_ticks    = sg_Utils_GetTicks();
+    tmr->paused_ticks   = 0;
+}
+
+uint32_t sg_Timers_TimerTicks(timer toGet)
+{
+    if (toGet == NULL || !toGet->started) return 0;
+    if (toGet->paused) return toGet->paused_ticks;
+    return sg_Utils_GetTicks() - toGet->start_ticks;
+}
+
+//----------------------------------------------------------------------------
+// Input
+//----------------------------------------------------------------------------
+
+void sg_Input_ProcessEvents()
+{
+    for (int32_t i = 0; i < SGH_MAX_KEYS; i++)
+    {
+        _keyTyped[i]    = _keyQueued[i];
+        _keyReleased[i] = _keyWasDown[i] && !_keyDown[i];
+        _keyWasDown[i]  = _keyDown[i];
+    }
+    memset(_keyQueued, 0, sizeof(_keyQueued));
+
+    sgh_stats.frames++;
+    if (!_realClock) _virtualTicks += _frameTicks;
+}
+
+bool sg_Input_WindowCloseRequested()
+{
+    return _closeRequested || (_frameLimit > 0 && sgh_stats.frames >= _frameLimit);
+}
+
+bool sg_Input_KeyDown(key_code key)
+{
+    return (unsigned)key < SGH_MAX_KEYS && _keyDown[key];
+}
+
+bool sg_Input_KeyTyped(key_code key)
+{
+    return (unsigned)key < SGH_MAX_KEYS && _keyTyped[key];
+}
+
+bool sg_Input_KeyReleased(key_code key)
+{
+    return (unsigned)key < SGH_MAX_KEYS && _keyReleased[key];
+}
+
+bool sg_Input_AnyKeyPressed()
+{
+    for (int32_t i = 0; i < SGH_MAX_KEYS; i++)
+        if (_keyDown[i] || _keyTyped[i]) return true;
+    return false;
+}
+
+//----------------------------------------------------------------------------
+// Resources
+//----------------------------------------------------------------------------
+
+void sg_Resources_RegisterFreeNotifier(free_notifier fn)
+{
+    _freeNotifier = (void (*)(void *))fn;
+}
+
+void sg_Resources_AppPath(char *result)
+{
+    strcpy(result, _appPath);
+}
+
+void sg_Resources_SetAppPath(const char *path)
+{
+    sgh_CopyName(_appPath, path);
+}
+
+void sg_Resources_SetAppPathWithExe(const char *path, bool withExe)
+{
+    sgh_CopyName(_appPath, path);
+    if (withExe)
+    {
+        char *slash = strrchr(_appPath, '/');
+        if (slash) *slash = '\0';
+    }
+}
+
+static const char *sgh_ResourceDir(resource_kind kind)
+{
+    switch (kind)
+    {
+        case BUNDLE_RESOURCE:       return "bundles";
+        case BITMAP_RESOURCE:       return "images";
+        case FONT_RESOURCE:         return "fonts";
+        case MUSIC_RESOURCE:
+        case SOUND_RESOURCE:        return "sounds";
+        case MAP_RESOURCE:          return "maps";
+        case ANIMATION_RESOURCE:    return "animations";
+        case PANEL_RESOURCE:        return "panels";
+        case CHARACTER_RESOURCE:    return "characters";
+        default:                    return "";
+    }
+}
+
+void sg_Resources_PathToResource(const char *filename, resource_kind kind, char *result)
+{
+    sgh_ResourcePath(sgh_ResourceDir(kind), filename, result, 2048);
+}
+
+void sg_Resources_PathToOtherResource(const char *filename, char *result)
+{
+    sgh_ResourcePath("", filename, result, 2048);
+}
+
+void sg_Resources_FilenameToResource(const char *name, resource_kind kind, char *result)
+{
+    sg_Resources_PathToResource(name, kind, result);
+}
+
+void sg_Resources_ReleaseAllResources()
+{
+    sg_Images_ReleaseAllBitmaps();
+    sg_Audio_ReleaseAllSoundEffects();
+    sg_Audio_ReleaseAllMusic();
+    sg_Text_ReleaseAllFonts();
+    sg_Timers_ReleaseAllTimers();
+}
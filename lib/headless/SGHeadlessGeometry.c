@@ -0,0 +1,847 @@
+//----------------------------------------------------------------------------
+// SGHeadlessGeometry.c
+//----------------------------------------------------------------------------
+//
+//  Headless SGSDK: the pure maths of sgGeometry. These follow SwinGame
+//  3's definitions (inclusive point-in-rectangle, barycentric point-in-
+//  triangle, angles in degrees, row-major matrices applied as m * [x y 1])
+//  so collision results match a native build.
+//
+//----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <math.h>
+
+#include "SGHeadlessPrivate.h"
+
+#define SGH_DEG_TO_RAD  (3.14159265358979323846f / 180.0f)
+#define SGH_ON_LINE     0.9f    // Distance treated as "on" a line, as in SwinGame
+
+static inline vector sgh_Vector(float x, float y)
+{
+    vector result = { x, y };
+    return result;
+}
+
+//----------------------------------------------------------------------------
+// Trigonometry (degrees)
+//----------------------------------------------------------------------------
+
+float sg_Geometry_Sine(float angle)     { return sinf(angle * SGH_DEG_TO_RAD); }
+float sg_Geometry_Cosine(float angle)   { return cosf(angle * SGH_DEG_TO_RAD); }
+float sg_Geometry_Tangent(float angle)  { return tanf(angle * SGH_DEG_TO_RAD); }
+
+//----------------------------------------------------------------------------
+// Points and vectors
+//----------------------------------------------------------------------------
+
+point2d sg_Geometry_PointAt(float x, float y)
+{
+    point2d result = { x, y };
+    return result;
+}
+
+point2d sg_Geometry_PointAdd(const point2d *pt1, const point2d *pt2)
+{
+    return sg_Geometry_PointAt(pt1->x + pt2->x, pt1->y + pt2->y);
+}
+
+point2d sg_Geometry_PointAtStartWithOffset(const point2d *startPoint, const vector *offset)
+{
+    return sg_Geometry_PointAt(startPoint->x + offset->x, startPoint->y + offset->y);
+}
+
+bool sg_Geometry_PointOnPoint(const point2d *pt1, const point2d *pt2)
+{
+    return pt1->x == pt2->x && pt1->y == pt2->y;
+}
+
+float sg_Geometry_PointPointDistance(const point2d *pt1, const point2d *pt2)
+{
+    float dx = pt2->x - pt1->x, dy = pt2->y - pt1->y;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+point2d sg_Geometry_RandomScreenPoint()
+{
+    return sg_Geometry_PointAt(sg_Utils_Rnd() * sg_Graphics_ScreenWidth(),
+                               sg_Utils_Rnd() * sg_Graphics_ScreenHeight());
+}
+
+void sg_Geometry_PointToString(const point2d *pt, char *result)
+{
+    sprintf(result, "Pt @%g:%g", pt->x, pt->y);
+}
+
+vector sg_Geometry_VectorTo(float x, float y, bool invertY)
+{
+    return sgh_Vector(x, invertY ? -y : y);
+}
+
+vector sg_Geometry_VectorToPoint(const point2d *p1)                 { return sgh_Vector(p1->x, p1->y); }
+vector sg_Geometry_CreateVectorToPoint(const point2d *p1)           { return sgh_Vector(p1->x, p1->y); }
+
+vector sg_Geometry_VectorFromPoints(const point2d *p1, const point2d *p2)
+{
+    return sgh_Vector(p2->x - p1->x, p2->y - p1->y);
+}
+
+vector sg_Geometry_CreateVectorFromPoints(const point2d *p1, const point2d *p2)
+{
+    return sg_Geometry_VectorFromPoints(p1, p2);
+}
+
+vector sg_Geometry_VectorFromAngle(float angle, float magnitude)
+{
+    return sgh_Vector(magnitude * sg_Geometry_Cosine(angle), magnitude * sg_Geometry_Sine(angle));
+}
+
+vector sg_Geometry_CreateVectorFromAngle(float angle, float magnitude)
+{
+    return sg_Geometry_VectorFromAngle(angle, magnitude);
+}
+
+vector sg_Geometry_AddVectors(const vector *v1, const vector *v2)
+{
+    return sgh_Vector(v1->x + v2->x, v1->y + v2->y);
+}
+
+vector sg_Geometry_SubtractVectors(const vector *v1, const vector *v2)
+{
+    return sgh_Vector(v1->x - v2->x, v1->y - v2->y);
+}
+
+vector sg_Geometry_VectorMultiply(const vector *v, float s)
+{
+    return sgh_Vector(v->x * s, v->y * s);
+}
+
+vector sg_Geometry_InvertVector(const vector *v)
+{
+    return sgh_Vector(-v->x, -v->y);
+}
+
+float sg_Geometry_VectorMagnitudeSq(const vector *v)    { return v->x * v->x + v->y * v->y; }
+float sg_Geometry_VectorMagnitude(const vector *v)      { return sqrtf(sg_Geometry_VectorMagnitudeSq(v)); }
+float sg_Geometry_DotProduct(const vector *v1, const vector *v2) { return v1->x * v2->x + v1->y * v2->y; }
+bool sg_Geometry_VectorIsZero(const vector *v)          { return v->x == 0 && v->y == 0; }
+bool sg_Geometry_VectorsEqual(const vector *v1, const vector *v2)    { return v1->x == v2->x && v1->y == v2->y; }
+bool sg_Geometry_VectorsNotEqual(const vector *v1, const vector *v2) { return !sg_Geometry_VectorsEqual(v1, v2); }
+
+vector sg_Geometry_UnitVector(const vector *v)
+{
+    float mag = sg_Geometry_VectorMagnitude(v);
+    if (mag == 0) return sgh_Vector(0, 0);
+    return sgh_Vector(v->x / mag, v->y / mag);
+}
+
+vector sg_Geometry_LimitVector(const vector *v, float limit)
+{
+    float mag = sg_Geometry_VectorMagnitude(v);
+    if (mag <= limit) return *v;
+    vector unit = sg_Geometry_UnitVector(v);
+    return sg_Geometry_VectorMultiply(&unit, limit);
+}
+
+vector sg_Geometry_VectorNormal(const vector *v)
+{
+    float mag = sg_Geometry_VectorMagnitude(v);
+    if (mag == 0) return sgh_Vector(0, 0);
+    return sgh_Vector(-v->y / mag, v->x / mag);
+}
+
+float sg_Geometry_VectorAngle(const vector *v)
+{
+    if (v->x == 0 && v->y == 0) return 0;
+    return atan2f(v->y, v->x) / SGH_DEG_TO_RAD;
+}
+
+float sg_Geometry_CalculateAngle(float x1, float y1, float x2, float y2)
+{
+    float result = (atan2f(y2, x2) - atan2f(y1, x1)) / SGH_DEG_TO_RAD;
+    if (result > 180) result -= 360;
+    else if (result < -180) result += 360;
+    return result;
+}
+
+float sg_Geometry_CalculateAngleBetween(const point2d *pt1, const point2d *pt2)
+{
+    return sg_Geometry_CalculateAngle(pt1->x, pt1->y, pt2->x, pt2->y);
+}
+
+float sg_Geometry_CalculateAngleBetweenVectors(const vector *v1, const vector *v2)
+{
+    return sg_Geometry_CalculateAngle(v1->x, v1->y, v2->x, v2->y);
+}
+
+//----------------------------------------------------------------------------
+// Rectangles
+//----------------------------------------------------------------------------
+
+rectangle sg_Geometry_RectangleFrom(float x, float y, int32_t w, int32_t h)
+{
+    rectangle result = { x, y, w, h };
+    return result;
+}
+
+rectangle sg_Geometry_CreateRectangle(float x, float y, int32_t w, int32_t h)
+{
+    return sg_Geometry_RectangleFrom(x, y, w, h);
+}
+
+rectangle sg_Geometry_RectangleAtPoint(const point2d *pt, int32_t width, int32_t height)
+{
+    return sg_Geometry_RectangleFrom(pt->x, pt->y, width, height);
+}
+
+rectangle sg_Geometry_CreateRectangleAtPoint(const point2d *pt, int32_t width, int32_t height)
+{
+    return sg_Geometry_RectangleAtPoint(pt, width, height);
+}
+
+// As SwinGame's RectangleFrom(pt1, pt2): anchored at pt1, so points given
+// right to left or bottom to top give a negative width or height, and each
+// size rounded up with Ceiling rather than to the nearest
+rectangle sg_Geometry_RectangleForPoints(const point2d *pt1, const point2d *pt2)
+{
+    return sg_Geometry_RectangleFrom(pt1->x, pt1->y, (int32_t)ceilf(pt2->x - pt1->x),
+                                     (int32_t)ceilf(pt2->y - pt1->y));
+}
+
+rectangle sg_Geometry_CreateRectangleForPoints(const point2d *pt1, const point2d *pt2)
+{
+    return sg_Geometry_RectangleForPoints(pt1, pt2);
+}
+
+// As SwinGame's RectangleFrom(tri): the bounds of the points, each size
+// rounded up with Ceiling so that the rectangle covers the whole triangle
+rectangle sg_Geometry_RectangleFromTriangle(const triangle *tri)
+{
+    const point2d *p = tri->points;
+    float minX = p[0].x, maxX = p[0].x, minY = p[0].y, maxY = p[0].y;
+    for (int i = 1; i < 3; i++)
+    {
+        if (p[i].x < minX) minX = p[i].x; else if (p[i].x > maxX) maxX = p[i].x;
+        if (p[i].y < minY) minY = p[i].y; else if (p[i].y > maxY) maxY = p[i].y;
+    }
+    return sg_Geometry_RectangleFrom(minX, minY, (int32_t)ceilf(maxX - minX),
+                                     (int32_t)ceilf(maxY - minY));
+}
+
+rectangle sg_Geometry_CreateRectangleTriangle(const triangle *tri)
+{
+    return sg_Geometry_RectangleFromTriangle(tri);
+}
+
+rectangle sg_Geometry_RectangleFromLine(const line_segment *line)
+{
+    return sg_Geometry_RectangleForPoints(&line->start_point, &line->end_point);
+}
+
+rectangle sg_Geometry_CreateRectangleLine(const line_segment *line)
+{
+    return sg_Geometry_RectangleFromLine(line);
+}
+
+rectangle sg_Geometry_RectangleFromCircle(const circle *c)
+{
+    return sg_Geometry_RectangleFrom(c->center.x - c->radius, c->center.y - c->radius,
+                                     c->radius * 2, c->radius * 2);
+}
+
+rectangle sg_Geometry_CreateRectangleCircle(const circle *c)
+{
+    return sg_Geometry_RectangleFromCircle(c);
+}
+
+float sg_Geometry_RectangleTop(const rectangle *rect)
+{
+    return rect->height > 0 ? rect->y : rect->y + rect->height;
+}
+
+float sg_Geometry_RectangleBottom(const rectangle *rect)
+{
+    return rect->height > 0 ? rect->y + rect->height : rect->y;
+}
+
+float sg_Geometry_RectangleLeft(const rectangle *rect)
+{
+    return rect->width > 0 ? rect->x : rect->x + rect->width;
+}
+
+float sg_Geometry_RectangleRight(const rectangle *rect)
+{
+    return rect->width > 0 ? rect->x + rect->width : rect->x;
+}
+
+point2d sg_Geometry_RectangleTopLeft(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(sg_Geometry_RectangleLeft(rect), sg_Geometry_RectangleTop(rect));
+}
+
+point2d sg_Geometry_RectangleTopRight(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(sg_Geometry_RectangleRight(rect), sg_Geometry_RectangleTop(rect));
+}
+
+point2d sg_Geometry_RectangleBottomLeft(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(sg_Geometry_RectangleLeft(rect), sg_Geometry_RectangleBottom(rect));
+}
+
+point2d sg_Geometry_RectangleBottomRight(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(sg_Geometry_RectangleRight(rect), sg_Geometry_RectangleBottom(rect));
+}
+
+point2d sg_Geometry_RectangleCenter(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(rect->x + rect->width / 2.0f, rect->y + rect->height / 2.0f);
+}
+
+point2d sg_Geometry_RectangleCenterTop(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(rect->x + rect->width / 2.0f, sg_Geometry_RectangleTop(rect));
+}
+
+point2d sg_Geometry_RectangleCenterBottom(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(rect->x + rect->width / 2.0f, sg_Geometry_RectangleBottom(rect));
+}
+
+point2d sg_Geometry_RectangleCenterLeft(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(sg_Geometry_RectangleLeft(rect), rect->y + rect->height / 2.0f);
+}
+
+point2d sg_Geometry_RectangleCenterRight(const rectangle *rect)
+{
+    return sg_Geometry_PointAt(sg_Geometry_RectangleRight(rect), rect->y + rect->height / 2.0f);
+}
+
+rectangle sg_Geometry_RectangleOffset(const rectangle *rect, const vector *vec)
+{
+    return sg_Geometry_RectangleFrom(rect->x + vec->x, rect->y + vec->y, rect->width, rect->height);
+}
+
+rectangle sg_Geometry_RectangleAfterMove(const rectangle *rect, const vector *mv)
+{
+    return sg_Geometry_RectangleOffset(rect, mv);
+}
+
+rectangle sg_Geometry_InsetRectangle(const rectangle *rect, int32_t insetAmount)
+{
+    return sg_Geometry_RectangleFrom(rect->x + insetAmount, rect->y + insetAmount,
+                                     rect->width - 2 * insetAmount, rect->height - 2 * insetAmount);
+}
+
+void sg_Geometry_FixRect(float *x, float *y, int32_t *width, int32_t *height)
+{
+    if (*width < 0)  { *x += *width;  *width  = -*width; }
+    if (*height < 0) { *y += *height; *height = -*height; }
+}
+
+void sg_Geometry_FixRectangle(rectangle *rect)
+{
+    sg_Geometry_FixRect(&rect->x, &rect->y, &rect->width, &rect->height);
+}
+
+rectangle sg_Geometry_Intersection(const rectangle *rect1, const rectangle *rect2)
+{
+    float l = fmaxf(sg_Geometry_RectangleLeft(rect1),   sg_Geometry_RectangleLeft(rect2));
+    float t = fmaxf(sg_Geometry_RectangleTop(rect1),    sg_Geometry_RectangleTop(rect2));
+    float r = fminf(sg_Geometry_RectangleRight(rect1),  sg_Geometry_RectangleRight(rect2));
+    float b = fminf(sg_Geometry_RectangleBottom(rect1), sg_Geometry_RectangleBottom(rect2));
+
+    if (r < l || b < t) return sg_Geometry_RectangleFrom(0, 0, 0, 0);
+    return sg_Geometry_RectangleFrom(l, t, (int32_t)(r - l), (int32_t)(b - t));
+}
+
+bool sg_Geometry_RectanglesIntersect(const rectangle *rect1, const rectangle *rect2)
+{
+    if (sg_Geometry_RectangleBottom(rect1) < sg_Geometry_RectangleTop(rect2))  return false;
+    if (sg_Geometry_RectangleTop(rect1)    > sg_Geometry_RectangleBottom(rect2)) return false;
+    if (sg_Geometry_RectangleRight(rect1)  < sg_Geometry_RectangleLeft(rect2)) return false;
+    if (sg_Geometry_RectangleLeft(rect1)   > sg_Geometry_RectangleRight(rect2)) return false;
+    return true;
+}
+
+bool sg_Geometry_PointXYInRectXY(float ptX, float ptY, float x, float y, float w, float h)
+{
+    if (ptX < x || ptX > x + w) return false;
+    if (ptY < y || ptY > y + h) return false;
+    return true;
+}
+
+bool sg_Geometry_PointInRectXY(const point2d *pt, float x, float y, float w, float h)
+{
+    return sg_Geometry_PointXYInRectXY(pt->x, pt->y, x, y, w, h);
+}
+
+bool sg_Geometry_PointXYInRect(float x, float y, const rectangle *rect)
+{
+    return sg_Geometry_PointXYInRectXY(x, y, rect->x, rect->y, rect->width, rect->height);
+}
+
+bool sg_Geometry_PointInRect(const point2d *pt, const rectangle *rect)
+{
+    return sg_Geometry_PointXYInRectXY(pt->x, pt->y, rect->x, rect->y, rect->width, rect->height);
+}
+
+bool sg_Geometry_VectorInRect(const vector *v, const rectangle *rect)
+{
+    return sg_Geometry_PointXYInRect(v->x, v->y, rect);
+}
+
+bool sg_Geometry_VectorInRectXY(const vector *v, float x, float y, float w, float h)
+{
+    return sg_Geometry_PointXYInRectXY(v->x, v->y, x, y, w, h);
+}
+
+void sg_Geometry_PointsFromRect(const rectangle *rect, point2d *result, int32_t result_len)
+{
+    if (result_len < 4) return;
+    result[0] = sg_Geometry_RectangleTopLeft(rect);
+    result[1] = sg_Geometry_RectangleTopRight(rect);
+    result[2] = sg_Geometry_RectangleBottomLeft(rect);
+    result[3] = sg_Geometry_RectangleBottomRight(rect);
+}
+
+void sg_Geometry_RectangleToString(const rectangle *rect, char *result)
+{
+    sprintf(result, "Rect @%g:%g %dx%d", rect->x, rect->y, rect->width, rect->height);
+}
+
+//----------------------------------------------------------------------------
+// Lines
+//----------------------------------------------------------------------------
+
+line_segment sg_Geometry_LineFrom(float x1, float y1, float x2, float y2)
+{
+    line_segment result = { { x1, y1 }, { x2, y2 } };
+    return result;
+}
+
+line_segment sg_Geometry_CreateLine(float x1, float y1, float x2, float y2)
+{
+    return sg_Geometry_LineFrom(x1, y1, x2, y2);
+}
+
+line_segment sg_Geometry_LineFromPointToPoint(const point2d *pt1, const point2d *pt2)
+{
+    return sg_Geometry_LineFrom(pt1->x, pt1->y, pt2->x, pt2->y);
+}
+
+line_segment sg_Geometry_CreateLinePointToPoint(const point2d *pt1, const point2d *pt2)
+{
+    return sg_Geometry_LineFromPointToPoint(pt1, pt2);
+}
+
+line_segment sg_Geometry_LineFromVectorWithStartXY(float x, float y, const vector *mv)
+{
+    return sg_Geometry_LineFrom(x, y, x + mv->x, y + mv->y);
+}
+
+line_segment sg_Geometry_LineFromVectorWithStartPoint(const point2d *pt, const vector *mv)
+{
+    return sg_Geometry_LineFromVectorWithStartXY(pt->x, pt->y, mv);
+}
+
+line_segment sg_Geometry_LineFromVector(const vector *mv)
+{
+    return sg_Geometry_LineFromVectorWithStartXY(0, 0, mv);
+}
+
+line_segment sg_Geometry_CreateLineFromVector(const vector *mv)
+{
+    return sg_Geometry_LineFromVector(mv);
+}
+
+line_segment sg_Geometry_CreateLineVectorWithStartPoint(const point2d *pt, const vector *mv)
+{
+    return sg_Geometry_LineFromVectorWithStartPoint(pt, mv);
+}
+
+line_segment sg_Geometry_CreateLineVectorWithStartXY(float x, float y, const vector *mv)
+{
+    return sg_Geometry_LineFromVectorWithStartXY(x, y, mv);
+}
+
+vector sg_Geometry_LineAsVector(const line_segment *line)
+{
+    return sg_Geometry_VectorFromPoints(&line->start_point, &line->end_point);
+}
+
+vector sg_Geometry_CreateLineAsVector(const line_segment *line)
+{
+    return sg_Geometry_LineAsVector(line);
+}
+
+vector sg_Geometry_LineNormal(const line_segment *line)
+{
+    vector v = sg_Geometry_LineAsVector(line);
+    return sg_Geometry_VectorNormal(&v);
+}
+
+float sg_Geometry_LineMagnitudeSq(float x1, float y1, float x2, float y2)
+{
+    return (x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1);
+}
+
+float sg_Geometry_LineMagnitudeSqFromLine(const line_segment *line)
+{
+    return sg_Geometry_LineMagnitudeSq(line->start_point.x, line->start_point.y,
+                                       line->end_point.x, line->end_point.y);
+}
+
+point2d sg_Geometry_LineMidPoint(const line_segment *line)
+{
+    return sg_Geometry_PointAt(line->start_point.x + (line->end_point.x - line->start_point.x) / 2,
+                               line->start_point.y + (line->end_point.y - line->start_point.y) / 2);
+}
+
+point2d sg_Geometry_ClosestPointOnLineXY(float x, float y, const line_segment *line)
+{
+    float magSq = sg_Geometry_LineMagnitudeSqFromLine(line);
+    if (magSq < 0.0001f) return line->start_point;
+
+    float u = ((x - line->start_point.x) * (line->end_point.x - line->start_point.x) +
+               (y - line->start_point.y) * (line->end_point.y - line->start_point.y)) / magSq;
+    if (u < 0) return line->start_point;
+    if (u > 1) return line->end_point;
+    return sg_Geometry_PointAt(line->start_point.x + u * (line->end_point.x - line->start_point.x),
+                               line->start_point.y + u * (line->end_point.y - line->start_point.y));
+}
+
+point2d sg_Geometry_ClosestPointOnLine(const point2d *fromPt, const line_segment *line)
+{
+    return sg_Geometry_ClosestPointOnLineXY(fromPt->x, fromPt->y, line);
+}
+
+float sg_Geometry_PointXYLineDistance(float x, float y, const line_segment *line)
+{
+    point2d pt = sg_Geometry_PointAt(x, y);
+    point2d closest = sg_Geometry_ClosestPointOnLineXY(x, y, line);
+    return sg_Geometry_PointPointDistance(&pt, &closest);
+}
+
+float sg_Geometry_PointLineDistance(const point2d *pt, const line_segment *line)
+{
+    return sg_Geometry_PointXYLineDistance(pt->x, pt->y, line);
+}
+
+bool sg_Geometry_PointOnLine(const point2d *pt, const line_segment *line)
+{
+    return sg_Geometry_PointLineDistance(pt, line) < SGH_ON_LINE;
+}
+
+bool sg_Geometry_LineIntersectionPoint(const line_segment *line1, const line_segment *line2, point2d *pt)
+{
+    float a1 = line1->end_point.y - line1->start_point.y;
+    float b1 = line1->start_point.x - line1->end_point.x;
+    float c1 = a1 * line1->start_point.x + b1 * line1->start_point.y;
+    float a2 = line2->end_point.y - line2->start_point.y;
+    float b2 = line2->start_point.x - line2->end_point.x;
+    float c2 = a2 * line2->start_point.x + b2 * line2->start_point.y;
+    float det = a1 * b2 - a2 * b1;
+
+    if (det == 0) return false;
+    pt->x = (b2 * c1 - b1 * c2) / det;
+    pt->y = (a1 * c2 - a2 * c1) / det;
+    return true;
+}
+
+bool sg_Geometry_LineSegmentsIntersect(const line_segment *line1, const line_segment *line2)
+{
+    point2d pt;
+    return sg_Geometry_LineIntersectionPoint(line1, line2, &pt) &&
+           sg_Geometry_PointOnLine(&pt, line1) && sg_Geometry_PointOnLine(&pt, line2);
+}
+
+bool sg_Geometry_LineIntersectsLines(const line_segment *line, const lines_array lines, int32_t lines_len)
+{
+    for (int32_t i = 0; i < lines_len; i++)
+        if (sg_Geometry_LineSegmentsIntersect(line, &lines[i])) return true;
+    return false;
+}
+
+void sg_Geometry_LinesFromRect(const rectangle *rect, lines_array result, int32_t result_len)
+{
+    if (result_len < 4) return;
+    point2d tl = sg_Geometry_RectangleTopLeft(rect),    tr = sg_Geometry_RectangleTopRight(rect);
+    point2d bl = sg_Geometry_RectangleBottomLeft(rect), br = sg_Geometry_RectangleBottomRight(rect);
+    result[0] = sg_Geometry_LineFromPointToPoint(&tl, &tr);
+    result[1] = sg_Geometry_LineFromPointToPoint(&tl, &bl);
+    result[2] = sg_Geometry_LineFromPointToPoint(&tr, &br);
+    result[3] = sg_Geometry_LineFromPointToPoint(&bl, &br);
+}
+
+void sg_Geometry_LinesFromTriangle(const triangle *tri, lines_array result, int32_t result_len)
+{
+    if (result_len < 3) return;
+    result[0] = sg_Geometry_LineFromPointToPoint(&tri->points[0], &tri->points[1]);
+    result[1] = sg_Geometry_LineFromPointToPoint(&tri->points[1], &tri->points[2]);
+    result[2] = sg_Geometry_LineFromPointToPoint(&tri->points[2], &tri->points[0]);
+}
+
+bool sg_Geometry_LineIntersectsRect(const line_segment *line, const rectangle *rect)
+{
+    line_segment lines[4];
+    sg_Geometry_LinesFromRect(rect, lines, 4);
+    return sg_Geometry_LineIntersectsLines(line, lines, 4);
+}
+
+bool sg_Geometry_LinesRectIntersect(const lines_array lines, const rectangle *r, int32_t lines_len)
+{
+    for (int32_t i = 0; i < lines_len; i++)
+        if (sg_Geometry_LineIntersectsRect(&lines[i], r)) return true;
+    return false;
+}
+
+void sg_Geometry_PointsFromLine(const line_segment *line, point2d *result, int32_t result_len)
+{
+    if (result_len < 2) return;
+    result[0] = line->start_point;
+    result[1] = line->end_point;
+}
+
+void sg_Geometry_LineToString(const line_segment *ln, char *result)
+{
+    sprintf(result, "From Pt @%g:%g to Pt @%g:%g",
+            ln->start_point.x, ln->start_point.y, ln->end_point.x, ln->end_point.y);
+}
+
+//----------------------------------------------------------------------------
+// Triangles
+//----------------------------------------------------------------------------
+
+triangle sg_Geometry_TriangleFrom(float ax, float ay, float bx, float by, float cx, float cy)
+{
+    triangle result = {{ { ax, ay }, { bx, by }, { cx, cy } }};
+    return result;
+}
+
+triangle sg_Geometry_CreateTriangle(float ax, float ay, float bx, float by, float cx, float cy)
+{
+    return sg_Geometry_TriangleFrom(ax, ay, bx, by, cx, cy);
+}
+
+triangle sg_Geometry_TriangleFromPoints(const point2d *a, const point2d *b, const point2d *c)
+{
+    return sg_Geometry_TriangleFrom(a->x, a->y, b->x, b->y, c->x, c->y);
+}
+
+triangle sg_Geometry_CreateTrianglePoints(const point2d *a, const point2d *b, const point2d *c)
+{
+    return sg_Geometry_TriangleFromPoints(a, b, c);
+}
+
+point2d sg_Geometry_TriangleBarycenter(const triangle *tri)
+{
+    return sg_Geometry_PointAt((tri->points[0].x + tri->points[1].x + tri->points[2].x) / 3,
+                               (tri->points[0].y + tri->points[1].y + tri->points[2].y) / 3);
+}
+
+bool sg_Geometry_PointInTriangle(const point2d *pt, const triangle *tri)
+{
+    vector v0 = sg_Geometry_VectorFromPoints(&tri->points[0], &tri->points[2]);
+    vector v1 = sg_Geometry_VectorFromPoints(&tri->points[0], &tri->points[1]);
+    vector v2 = sg_Geometry_VectorFromPoints(&tri->points[0], pt);
+
+    float a = sg_Geometry_DotProduct(&v0, &v0);
+    float b = sg_Geometry_DotProduct(&v0, &v1);
+    float c = sg_Geometry_DotProduct(&v0, &v2);
+    float d = sg_Geometry_DotProduct(&v1, &v1);
+    float e = sg_Geometry_DotProduct(&v1, &v2);
+
+    // SwinGame keeps the denominator, the numerators and u + v in x87
+    // extended precision, rounding only 1 / denom, u and v to float. The
+    // products of floats are exact in double, so double stands in for it
+    // (bench_collide checks the two agree on points along triangle edges).
+    double denom = (double)a * d - (double)b * b;
+
+    if (denom == 0) return false;
+    float inverse = (float)(1 / denom);
+    float u = (float)(((double)d * c - (double)b * e) * inverse);
+    float v = (float)(((double)a * e - (double)b * c) * inverse);
+    return u > 0 && v > 0 && (double)u + v < 1;
+}
+
+bool sg_Geometry_TriangleRectangleIntersect(const triangle *tri, const rectangle *rect)
+{
+    const point2d *p = tri->points;
+    float r = sg_Geometry_RectangleRight(rect),  l = sg_Geometry_RectangleLeft(rect);
+    float t = sg_Geometry_RectangleTop(rect),    b = sg_Geometry_RectangleBottom(rect);
+
+    // Bounding box reject first
+    if (p[0].x > r && p[1].x > r && p[2].x > r) return false;
+    if (p[0].x < l && p[1].x < l && p[2].x < l) return false;
+    if (p[0].y > b && p[1].y > b && p[2].y > b) return false;
+    if (p[0].y < t && p[1].y < t && p[2].y < t) return false;
+
+    if (sg_Geometry_PointInRect(&p[0], rect) || sg_Geometry_PointInRect(&p[1], rect) ||
+        sg_Geometry_PointInRect(&p[2], rect)) return true;
+
+    point2d corners[4];
+    sg_Geometry_PointsFromRect(rect, corners, 4);
+    for (int32_t i = 0; i < 4; i++)
+        if (sg_Geometry_PointInTriangle(&corners[i], tri)) return true;
+
+    line_segment lines[3];
+    sg_Geometry_LinesFromTriangle(tri, lines, 3);
+    return sg_Geometry_LinesRectIntersect(lines, rect, 3);
+}
+
+bool sg_Geometry_TrianglesRectangleIntersect(const triangle_array tri, const rectangle *rect, int32_t tri_len)
+{
+    for (int32_t i = 0; i < tri_len; i++)
+        if (sg_Geometry_TriangleRectangleIntersect(&tri[i], rect)) return true;
+    return false;
+}
+
+void sg_Geometry_TriangleToString(const triangle *tri, char *result)
+{
+    sprintf(result, "Triangle @Pt @%g:%g - Pt @%g:%g - Pt @%g:%g",
+            tri->points[0].x, tri->points[0].y, tri->points[1].x, tri->points[1].y,
+            tri->points[2].x, tri->points[2].y);
+}
+
+//----------------------------------------------------------------------------
+// Circles
+//----------------------------------------------------------------------------
+
+circle sg_Geometry_CircleFromXY(float x, float y, int32_t radius)
+{
+    circle result = { { x, y }, radius };
+    return result;
+}
+
+circle sg_Geometry_CircleAt(const point2d *pt, int32_t radius)
+{
+    return sg_Geometry_CircleFromXY(pt->x, pt->y, radius);
+}
+
+circle sg_Geometry_CreateCircle(const point2d *pt, int32_t radius)             { return sg_Geometry_CircleAt(pt, radius); }
+circle sg_Geometry_CreateCircleFromXY(float x, float y, int32_t radius)        { return sg_Geometry_CircleFromXY(x, y, radius); }
+point2d sg_Geometry_CircleCenterPoint(const circle *c)                         { return c->center; }
+int32_t sg_Geometry_CircleRadius(const circle *c)                              { return c->radius; }
+float sg_Geometry_CircleX(const circle *c)                                     { return c->center.x; }
+float sg_Geometry_CircleY(const circle *c)                                     { return c->center.y; }
+
+bool sg_Geometry_PointXYInCircle(float ptX, float ptY, float cX, float cY, float radius)
+{
+    return (ptX - cX) * (ptX - cX) + (ptY - cY) * (ptY - cY) <= radius * radius;
+}
+
+bool sg_Geometry_PointInCircle(const point2d *pt, const circle *c)
+{
+    return sg_Geometry_PointXYInCircle(pt->x, pt->y, c->center.x, c->center.y, c->radius);
+}
+
+bool sg_Geometry_CircleWithinRect(const circle *c, const rectangle *rect)
+{
+    return c->center.x - c->radius >= sg_Geometry_RectangleLeft(rect) &&
+           c->center.x + c->radius <= sg_Geometry_RectangleRight(rect) &&
+           c->center.y - c->radius >= sg_Geometry_RectangleTop(rect) &&
+           c->center.y + c->radius <= sg_Geometry_RectangleBottom(rect);
+}
+
+bool sg_Geometry_LineIntersectsCircle(const line_segment *l, const circle *c)
+{
+    return sg_Geometry_PointLineDistance(&c->center, l) <= c->radius;
+}
+
+//----------------------------------------------------------------------------
+// Matrices
+//----------------------------------------------------------------------------
+
+matrix2d sg_Geometry_IdentityMatrix()
+{
+    matrix2d result = {{ { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } }};
+    return result;
+}
+
+matrix2d sg_Geometry_TranslationMatrix(float dx, float dy)
+{
+    matrix2d result = sg_Geometry_IdentityMatrix();
+    result.elements[0][2] = dx;
+    result.elements[1][2] = dy;
+    return result;
+}
+
+matrix2d sg_Geometry_TranslationMatrixPt(const point2d *pt)
+{
+    return sg_Geometry_TranslationMatrix(pt->x, pt->y);
+}
+
+matrix2d sg_Geometry_ScaleMatrixByPoint(const point2d *scale)
+{
+    matrix2d result = sg_Geometry_IdentityMatrix();
+    result.elements[0][0] = scale->x;
+    result.elements[1][1] = scale->y;
+    return result;
+}
+
+matrix2d sg_Geometry_ScaleMatrix(float scale)
+{
+    point2d pt = { scale, scale };
+    return sg_Geometry_ScaleMatrixByPoint(&pt);
+}
+
+matrix2d sg_Geometry_RotationMatrix(float deg)
+{
+    float c = sg_Geometry_Cosine(deg), s = sg_Geometry_Sine(deg);
+    matrix2d result = {{ { c, -s, 0 }, { s, c, 0 }, { 0, 0, 1 } }};
+    return result;
+}
+
+matrix2d sg_Geometry_MatrixMultiply(const matrix2d *m1, const matrix2d *m2)
+{
+    matrix2d result;
+    for (int32_t row = 0; row < 3; row++)
+        for (int32_t col = 0; col < 3; col++)
+            result.elements[row][col] = m1->elements[row][0] * m2->elements[0][col] +
+                                        m1->elements[row][1] * m2->elements[1][col] +
+                                        m1->elements[row][2] * m2->elements[2][col];
+    return result;
+}
+
+matrix2d sg_Geometry_ScaleRotateTranslateMatrix(const point2d *scale, float deg, const point2d *translate)
+{
+    matrix2d s = sg_Geometry_ScaleMatrixByPoint(scale);
+    matrix2d r = sg_Geometry_RotationMatrix(deg);
+    matrix2d t = sg_Geometry_TranslationMatrixPt(translate);
+    matrix2d rs = sg_Geometry_MatrixMultiply(&r, &s);
+    return sg_Geometry_MatrixMultiply(&t, &rs);
+}
+
+vector sg_Geometry_MatrixMultiplyVector(const matrix2d *m, const vector *v)
+{
+    return sgh_Vector(v->x * m->elements[0][0] + v->y * m->elements[0][1] + m->elements[0][2],
+                               v->x * m->elements[1][0] + v->y * m->elements[1][1] + m->elements[1][2]);
+}
+
+void sg_Geometry_ApplyMatrixToPoints(const matrix2d *m, point2d *pts, int32_t pts_len)
+{
+    for (int32_t i = 0; i < pts_len; i++)
+    {
+        float x = pts[i].x, y = pts[i].y;
+        pts[i].x = x * m->elements[0][0] + y * m->elements[0][1] + m->elements[0][2];
+        pts[i].y = x * m->elements[1][0] + y * m->elements[1][1] + m->elements[1][2];
+    }
+}
+
+void sg_Geometry_ApplyMatrix(const matrix2d *m, triangle *tri)
+{
+    sg_Geometry_ApplyMatrixToPoints(m, tri->points, 3);
+}
+
+void sg_Geometry_MatrixToString(const matrix2d *m, char *result)
+{
+    sprintf(result, "-------------------------------\n"
+                    "|%9.2f %9.2f %9.2f |\n|%9.2f %9.2f %9.2f |\n|%9.2f %9.2f %9.2f |\n"
+                    "-------------------------------",
+            m->elements[0][0], m->elements[0][1], m->elements[0][2],
+            m->elements[1][0], m->elements[1][1], m->elements[1][2],
+            m->elements[2][0], m->elements[2][1], m->elements[2][2]);
+}
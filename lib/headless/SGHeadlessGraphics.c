@@ -0,0 +1,954 @@
+//----------------------------------------------------------------------------
+// SGHeadlessGraphics.c
+//----------------------------------------------------------------------------
+//
+//  Headless SGSDK: window, images, shapes and text.
+//
+//  Bitmaps are in-memory ARGB surfaces. Loading a bitmap reads only the
+//  PNG header for its size (falling back to 32x32) and fills the surface
+//  with an opaque colour, so blits and fills cost what a software
+//  renderer would without needing an image decoder. Text is drawn as one
+//  filled cell per glyph for the same reason. The screen is just another
+//  surface, with the clip stack kept in bitmap_data.clip_stack.
+//
+//----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "SGHeadlessPrivate.h"
+
+typedef struct _sgh_font {
+    font_data           data;
+    int32_t             size;
+    font_style          style;
+    char                name[SGH_NAME_LEN];
+    struct _sgh_font   *next;
+} sgh_font;
+
+static sgh_bitmap  *_screen     = NULL;
+static sgh_bitmap  *_bitmaps    = NULL;     // Every loaded/created bitmap
+static sgh_font    *_fonts      = NULL;
+static color        _clearColor = 0xff000000;
+
+//----------------------------------------------------------------------------
+// Surfaces
+//----------------------------------------------------------------------------
+
+static sgh_bitmap *sgh_NewBitmap(const char *name, const char *filename, int32_t w, int32_t h)
+{
+    sgh_bitmap *result = calloc(1, sizeof(sgh_bitmap));
+    if (w < 1) w = 1;
+    if (h < 1) h = 1;
+
+    result->pixels              = calloc((size_t)w * h, sizeof(uint32_t));
+    result->data.surface        = result->pixels;
+    result->data.width          = w;
+    result->data.height         = h;
+    result->data.cell_w         = w;
+    result->data.cell_h         = h;
+    result->data.cell_cols      = 1;
+    result->data.cell_rows      = 1;
+    result->data.cell_count     = 1;
+    result->data.texture_width_ratio  = 1.0f;
+    result->data.texture_height_ratio = 1.0f;
+    result->data.clip_stack     = result->clips;
+    sgh_CopyName(result->name, name);
+    sgh_CopyName(result->filename, filename);
+    result->data.name           = result->name;
+    result->data.filename       = result->filename;
+
+    result->next = _bitmaps;
+    _bitmaps = result;
+
+    sgh_stats.bitmap_bytes += (uint64_t)w * h * sizeof(uint32_t);
+    return result;
+}
+
+static void sgh_DeleteBitmap(sgh_bitmap *bmp)
+{
+    sgh_bitmap **link = &_bitmaps;
+    while (*link && *link != bmp) link = &(*link)->next;
+    if (*link) *link = bmp->next;
+
+    sgh_NotifyFree(bmp);
+    sgh_stats.bitmap_bytes -= (uint64_t)bmp->data.width * bmp->data.height * sizeof(uint32_t);
+    free(bmp->pixels);
+    free(bmp);
+}
+
+sgh_bitmap *sgh_Screen()
+{
+    if (_screen == NULL)
+    {
+        sg_Graphics_OpenGraphicsWindow("SwinGame", 800, 600);
+    }
+    return _screen;
+}
+
+// Current drawable area of a surface: the top of its clip stack, or all of it
+static rectangle sgh_ClipOf(sgh_bitmap *bmp)
+{
+    if (bmp->clip_count > 0) return bmp->clips[bmp->clip_count - 1];
+    rectangle all = { 0, 0, bmp->data.width, bmp->data.height };
+    return all;
+}
+
+static bool sgh_ClipSpan(sgh_bitmap *dest, int32_t *x, int32_t *y, int32_t *w, int32_t *h,
+                         int32_t *skipX, int32_t *skipY)
+{
+    rectangle clip = sgh_ClipOf(dest);
+    int32_t cx0 = (int32_t)clip.x, cy0 = (int32_t)clip.y;
+    int32_t cx1 = cx0 + clip.width, cy1 = cy0 + clip.height;
+
+    if (cx0 < 0) cx0 = 0;
+    if (cy0 < 0) cy0 = 0;
+    if (cx1 > dest->data.width)  cx1 = dest->data.width;
+    if (cy1 > dest->data.height) cy1 = dest->data.height;
+
+    int32_t x0 = *x, y0 = *y, x1 = *x + *w, y1 = *y + *h;
+    *skipX = x0 < cx0 ? cx0 - x0 : 0;
+    *skipY = y0 < cy0 ? cy0 - y0 : 0;
+    if (x0 < cx0) x0 = cx0;
+    if (y0 < cy0) y0 = cy0;
+    if (x1 > cx1) x1 = cx1;
+    if (y1 > cy1) y1 = cy1;
+
+    if (x1 <= x0 || y1 <= y0) return false;
+    *x = x0; *y = y0; *w = x1 - x0; *h = y1 - y0;
+    return true;
+}
+
+void sgh_FillRect(sgh_bitmap *dest, color clr, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    int32_t skipX, skipY;
+    if (dest == NULL || !sgh_ClipSpan(dest, &x, &y, &w, &h, &skipX, &skipY)) return;
+
+    for (int32_t row = 0; row < h; row++)
+    {
+        uint32_t *line = dest->pixels + (size_t)(y + row) * dest->data.width + x;
+        for (int32_t col = 0; col < w; col++) line[col] = clr;
+    }
+    sgh_stats.pixels_written += (uint64_t)w * h;
+}
+
+void sgh_Blit(sgh_bitmap *dest, sgh_bitmap *src, int32_t srcX, int32_t srcY,
+              int32_t srcW, int32_t srcH, int32_t x, int32_t y)
+{
+    int32_t skipX, skipY, w = srcW, h = srcH;
+    if (dest == NULL || src == NULL) return;
+    sgh_stats.bitmap_draws++;
+    if (!sgh_ClipSpan(dest, &x, &y, &w, &h, &skipX, &skipY)) return;
+
+    // Also clip against the source surface
+    if (srcX + skipX + w > src->data.width)  w = src->data.width  - srcX - skipX;
+    if (srcY + skipY + h > src->data.height) h = src->data.height - srcY - skipY;
+    if (w <= 0 || h <= 0) return;
+
+    for (int32_t row = 0; row < h; row++)
+    {
+        const uint32_t *from = src->pixels + (size_t)(srcY + skipY + row) * src->data.width
+                                           + srcX + skipX;
+        uint32_t *to = dest->pixels + (size_t)(y + row) * dest->data.width + x;
+        for (int32_t col = 0; col < w; col++)
+        {
+            if (from[col] >> 24) to[col] = from[col];   // Alpha test, as colour keyed
+        }
+    }
+    sgh_stats.pixels_written += (uint64_t)w * h;
+}
+
+static void sgh_PutPixel(sgh_bitmap *dest, color clr, int32_t x, int32_t y)
+{
+    rectangle clip = sgh_ClipOf(dest);
+    if (x < 0 || y < 0 || x >= dest->data.width || y >= dest->data.height) return;
+    if (x < clip.x || y < clip.y || x >= clip.x + clip.width || y >= clip.y + clip.height) return;
+    dest->pixels[(size_t)y * dest->data.width + x] = clr;
+    sgh_stats.pixels_written++;
+}
+
+static void sgh_Line(sgh_bitmap *dest, color clr, float fx0, float fy0, float fx1, float fy1)
+{
+    int32_t x0 = (int32_t)fx0, y0 = (int32_t)fy0, x1 = (int32_t)fx1, y1 = (int32_t)fy1;
+    int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int32_t err = dx + dy;
+
+    for (;;)
+    {
+        sgh_PutPixel(dest, clr, x0, y0);
+        if (x0 == x1 && y0 == y1) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+static void sgh_Rect(sgh_bitmap *dest, color clr, bool filled, float x, float y, int32_t w, int32_t h)
+{
+    if (filled) { sgh_FillRect(dest, clr, (int32_t)x, (int32_t)y, w, h); return; }
+    sgh_FillRect(dest, clr, (int32_t)x,         (int32_t)y,         w, 1);
+    sgh_FillRect(dest, clr, (int32_t)x,         (int32_t)y + h - 1, w, 1);
+    sgh_FillRect(dest, clr, (int32_t)x,         (int32_t)y,         1, h);
+    sgh_FillRect(dest, clr, (int32_t)x + w - 1, (int32_t)y,         1, h);
+}
+
+static void sgh_Triangle(sgh_bitmap *dest, color clr, bool filled, const triangle *tri)
+{
+    const point2d *p = tri->points;
+    if (!filled)
+    {
+        sgh_Line(dest, clr, p[0].x, p[0].y, p[1].x, p[1].y);
+        sgh_Line(dest, clr, p[1].x, p[1].y, p[2].x, p[2].y);
+        sgh_Line(dest, clr, p[2].x, p[2].y, p[0].x, p[0].y);
+        return;
+    }
+
+    int32_t minX = (int32_t)fminf(p[0].x, fminf(p[1].x, p[2].x));
+    int32_t maxX = (int32_t)fmaxf(p[0].x, fmaxf(p[1].x, p[2].x));
+    int32_t minY = (int32_t)fminf(p[0].y, fminf(p[1].y, p[2].y));
+    int32_t maxY = (int32_t)fmaxf(p[0].y, fmaxf(p[1].y, p[2].y));
+
+    for (int32_t y = minY; y <= maxY; y++)
+        for (int32_t x = minX; x <= maxX; x++)
+        {
+            point2d pt = { (float)x, (float)y };
+            if (sg_Geometry_PointInTriangle(&pt, tri)) sgh_PutPixel(dest, clr, x, y);
+        }
+}
+
+//----------------------------------------------------------------------------
+// Window
+//----------------------------------------------------------------------------
+
+void sg_Graphics_OpenGraphicsWindow(const char *caption, int32_t width, int32_t height)
+{
+    if (_screen != NULL) sgh_DeleteBitmap(_screen);
+    _screen = sgh_NewBitmap(caption, "", width, height);
+
+    // Let an unmodified game loop run for a fixed number of frames
+    const char *frames = getenv("SG_HEADLESS_FRAMES");
+    if (frames && frames[0]) sg_Headless_SetFrameLimit(strtoull(frames, NULL, 10));
+}
+
+void sg_Graphics_ChangeScreenSize(int32_t width, int32_t height)
+{
+    sg_Graphics_OpenGraphicsWindow(sgh_Screen()->name, width, height);
+}
+
+int32_t sg_Graphics_ScreenWidth()
+{
+    return sgh_Screen()->data.width;
+}
+
+int32_t sg_Graphics_ScreenHeight()
+{
+    return sgh_Screen()->data.height;
+}
+
+void sg_Graphics_RefreshScreen()
+{
+    sgh_stats.refreshes++;
+}
+
+void sg_Graphics_RefreshScreenRestrictFPS(uint32_t TargetFPS)
+{
+    sgh_stats.refreshes++;
+}
+
+void sg_Graphics_ClearScreen()
+{
+    sg_Graphics_ClearScreenTo(_clearColor);
+}
+
+void sg_Graphics_ClearScreenTo(color toColor)
+{
+    sgh_bitmap *screen = sgh_Screen();
+    sgh_FillRect(screen, toColor, 0, 0, screen->data.width, screen->data.height);
+}
+
+void sg_Graphics_SetIcon(const char *filename)                  { }
+void sg_Graphics_ShowSwinGameSplashScreen()                     { }
+void sg_Graphics_ToggleFullScreen()                             { }
+void sg_Graphics_ToggleWindowBorder()                           { }
+void sg_Graphics_TakeScreenshot(const char *basename)           { }
+
+bitmap sg_Headless_Screen()
+{
+    return &sgh_Screen()->data;
+}
+
+const uint32_t *sg_Headless_Pixels(bitmap bmp)
+{
+    return bmp ? ((sgh_bitmap *)bmp)->pixels : NULL;
+}
+
+//----------------------------------------------------------------------------
+// Colours
+//----------------------------------------------------------------------------
+
+color sg_Graphics_RGBAColor(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha)
+{
+    return ((color)alpha << 24) | ((color)red << 16) | ((color)green << 8) | blue;
+}
+
+color sg_Graphics_RGBAFloatColor(float r, float g, float b, float a)
+{
+    return sg_Graphics_RGBAColor(r * 255, g * 255, b * 255, a * 255);
+}
+
+color sg_Graphics_RGBFloatColor(float r, float g, float b)
+{
+    return sg_Graphics_RGBAFloatColor(r, g, b, 1.0f);
+}
+
+color sg_Graphics_RandomColor()
+{
+    return sg_Graphics_RGBAFloatColor(sg_Utils_Rnd(), sg_Utils_Rnd(), sg_Utils_Rnd(), sg_Utils_Rnd());
+}
+
+color sg_Graphics_RandomRGBColor(unsigned char alpha)
+{
+    return sg_Graphics_RGBAColor(sg_Utils_RndUpto(256), sg_Utils_RndUpto(256),
+                                 sg_Utils_RndUpto(256), alpha);
+}
+
+unsigned char sg_Graphics_TransparencyOf(color c)   { return (c >> 24) & 0xff; }
+unsigned char sg_Graphics_RedOf(color c)            { return (c >> 16) & 0xff; }
+unsigned char sg_Graphics_GreenOf(color c)          { return (c >> 8)  & 0xff; }
+unsigned char sg_Graphics_BlueOf(color c)           { return c & 0xff; }
+
+void sg_Graphics_ColorComponents(color c, unsigned char *r, unsigned char *g, unsigned char *b, unsigned char *a)
+{
+    *r = sg_Graphics_RedOf(c);
+    *g = sg_Graphics_GreenOf(c);
+    *b = sg_Graphics_BlueOf(c);
+    *a = sg_Graphics_TransparencyOf(c);
+}
+
+color sg_Graphics_ColorFromBitmap(bitmap bmp, color apiColor)
+{
+    return apiColor;
+}
+
+void sg_Graphics_ColorToString(color c, char *result)
+{
+    sprintf(result, "%u,%u,%u,%u", sg_Graphics_RedOf(c), sg_Graphics_GreenOf(c),
+                                   sg_Graphics_BlueOf(c), sg_Graphics_TransparencyOf(c));
+}
+
+color sg_Graphics_GetPixel(bitmap bmp, int32_t x, int32_t y)
+{
+    if (bmp == NULL || x < 0 || y < 0 || x >= bmp->width || y >= bmp->height) return 0;
+    return ((sgh_bitmap *)bmp)->pixels[(size_t)y * bmp->width + x];
+}
+
+color sg_Graphics_GetPixelFromScreen(int32_t x, int32_t y)
+{
+    return sg_Graphics_GetPixel(sg_Headless_Screen(), x, y);
+}
+
+void sg_Graphics_PutPixel(bitmap bmp, color value, int32_t x, int32_t y)
+{
+    if (bmp) sgh_PutPixel((sgh_bitmap *)bmp, value, x, y);
+}
+
+//----------------------------------------------------------------------------
+// Clipping
+//----------------------------------------------------------------------------
+
+void sg_Graphics_PushClipRectForBitmap(bitmap bmp, const rectangle *r)
+{
+    sgh_bitmap *dest = (sgh_bitmap *)bmp;
+    if (dest == NULL || dest->clip_count >= SGH_MAX_CLIPS) return;
+
+    // A pushed clip is always intersected with the current one
+    rectangle current = sgh_ClipOf(dest);
+    dest->clips[dest->clip_count++] = sg_Geometry_Intersection(r, &current);
+}
+
+void sg_Graphics_PushClipRect(const rectangle *r)
+{
+    sg_Graphics_PushClipRectForBitmap(sg_Headless_Screen(), r);
+}
+
+void sg_Graphics_PushClipXY(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    rectangle r = { x, y, w, h };
+    sg_Graphics_PushClipRect(&r);
+}
+
+void sg_Graphics_PopClipBmp(bitmap bmp)
+{
+    sgh_bitmap *dest = (sgh_bitmap *)bmp;
+    if (dest && dest->clip_count > 0) dest->clip_count--;
+}
+
+void sg_Graphics_PopClipScreen()
+{
+    sg_Graphics_PopClipBmp(sg_Headless_Screen());
+}
+
+void sg_Graphics_ResetClipForBitmap(bitmap bmp)
+{
+    if (bmp) ((sgh_bitmap *)bmp)->clip_count = 0;
+}
+
+void sg_Graphics_ResetClip()
+{
+    sg_Graphics_ResetClipForBitmap(sg_Headless_Screen());
+}
+
+void sg_Graphics_SetBmpClip(bitmap bmp, const rectangle *r)
+{
+    sg_Graphics_ResetClipForBitmap(bmp);
+    sg_Graphics_PushClipRectForBitmap(bmp, r);
+}
+
+void sg_Graphics_SetBmpClipXY(bitmap bmp, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    rectangle r = { x, y, w, h };
+    sg_Graphics_SetBmpClip(bmp, &r);
+}
+
+void sg_Graphics_SetClip(const rectangle *r)
+{
+    sg_Graphics_SetBmpClip(sg_Headless_Screen(), r);
+}
+
+void sg_Graphics_SetClipXY(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    sg_Graphics_SetBmpClipXY(sg_Headless_Screen(), x, y, w, h);
+}
+
+rectangle sg_Graphics_CurrentBmpClip(bitmap bmp)
+{
+    return sgh_ClipOf((sgh_bitmap *)bmp);
+}
+
+rectangle sg_Graphics_CurrentScreenClip()
+{
+    return sgh_ClipOf(sgh_Screen());
+}
+
+//----------------------------------------------------------------------------
+// Shapes (no camera headless, so world and screen coordinates are equal)
+//----------------------------------------------------------------------------
+
+void sg_Graphics_DrawOrFillRectangleOnScreen(color clr, bool filled, int32_t xPos, int32_t yPos, int32_t width, int32_t height)
+{
+    sgh_Rect(sgh_Screen(), clr, filled, xPos, yPos, width, height);
+}
+
+void sg_Graphics_DrawOrFillRectangle(color clr, bool filled, float xPos, float yPos, int32_t width, int32_t height)
+{
+    sgh_Rect(sgh_Screen(), clr, filled, xPos, yPos, width, height);
+}
+
+void sg_Graphics_DrawOrFillRectangleStruct(color clr, bool filled, const rectangle *source)
+{
+    sgh_Rect(sgh_Screen(), clr, filled, source->x, source->y, source->width, source->height);
+}
+
+void sg_Graphics_DrawOrFillRectangleStructOnScreen(color clr, bool filled, const rectangle *source)
+{
+    sg_Graphics_DrawOrFillRectangleStruct(clr, filled, source);
+}
+
+void sg_Graphics_DrawOrFillTriangleStruct(color clr, bool filled, const triangle *tri)
+{
+    sgh_Triangle(sgh_Screen(), clr, filled, tri);
+}
+
+void sg_Graphics_DrawOrFillTriangleStructOnScreen(color clr, bool filled, const triangle *tri)
+{
+    sgh_Triangle(sgh_Screen(), clr, filled, tri);
+}
+
+void sg_Graphics_DrawTriangle(color clr, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    triangle tri = {{ { x1, y1 }, { x2, y2 }, { x3, y3 } }};
+    sgh_Triangle(sgh_Screen(), clr, false, &tri);
+}
+
+//----------------------------------------------------------------------------
+// Images
+//----------------------------------------------------------------------------
+
+// Reads width/height from a PNG's IHDR chunk; false if not a readable PNG
+static bool sgh_PngSize(const char *path, int32_t *w, int32_t *h)
+{
+    unsigned char header[24];
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return false;
+    size_t got = fread(header, 1, sizeof(header), f);
+    fclose(f);
+
+    if (got < sizeof(header) || memcmp(header + 1, "PNG", 3) != 0) return false;
+    *w = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+    *h = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+    return *w > 0 && *h > 0;
+}
+
+static sgh_bitmap *sgh_FindBitmap(const char *name)
+{
+    for (sgh_bitmap *bmp = _bitmaps; bmp; bmp = bmp->next)
+        if (bmp != _screen && strcmp(bmp->name, name) == 0) return bmp;
+    return NULL;
+}
+
+static sgh_bitmap *sgh_LoadBitmap(const char *name, const char *filename)
+{
+    char path[SGH_NAME_LEN * 3];
+    int32_t w = 32, h = 32;
+    uint32_t shade = 0x808080;
+
+    sgh_stats.bitmap_load_calls++;
+
+    // As in sgImages.pas, loading an existing name returns that bitmap
+    sgh_bitmap *existing = sgh_FindBitmap(name);
+    if (existing) return existing;
+
+    sgh_ResourcePath("images", filename, path, sizeof(path));
+    if (!sgh_PngSize(path, &w, &h)) sgh_PngSize(filename, &w, &h);
+
+    sgh_bitmap *result = sgh_NewBitmap(name, filename, w, h);
+    for (const char *c = filename; *c; c++) shade = shade * 31 + (unsigned char)*c;
+    for (size_t i = 0; i < (size_t)w * h; i++) result->pixels[i] = 0xff000000 | (shade & 0xffffff);
+
+    sgh_stats.bitmap_loads++;
+    return result;
+}
+
+bitmap sg_Images_LoadBitmapNamed(const char *name, const char *filename)
+{
+    return &sgh_LoadBitmap(name, filename)->data;
+}
+
+bitmap sg_Images_LoadBitmap(const char *filename)
+{
+    return sg_Images_LoadBitmapNamed(filename, filename);
+}
+
+bitmap sg_Images_LoadBitmapWithTransparentColor(const char *filename, bool transparent, color transparentColor)
+{
+    return sg_Images_LoadBitmapNamed(filename, filename);
+}
+
+bitmap sg_Images_LoadTransparentBitmapNamed(const char *name, const char *filename, color transparentColor)
+{
+    return sg_Images_LoadBitmapNamed(name, filename);
+}
+
+bitmap sg_Images_CreateBitmap(int32_t width, int32_t height)
+{
+    return &sgh_NewBitmap("", "", width, height)->data;
+}
+
+bitmap sg_Images_CreateBitmapNamed(const char *name, int32_t width, int32_t height)
+{
+    return &sgh_NewBitmap(name, "", width, height)->data;
+}
+
+bitmap sg_Images_BitmapNamed(const char *name)
+{
+    sgh_bitmap *result = sgh_FindBitmap(name);
+    return result ? &result->data : NULL;
+}
+
+bool sg_Images_HasBitmap(const char *name)
+{
+    return sgh_FindBitmap(name) != NULL;
+}
+
+void sg_Images_FreeBitmap(bitmap *bitmapToFree)
+{
+    if (bitmapToFree == NULL || *bitmapToFree == NULL) return;
+    if ((sgh_bitmap *)*bitmapToFree == _screen) return;
+    sgh_DeleteBitmap((sgh_bitmap *)*bitmapToFree);
+    *bitmapToFree = NULL;
+}
+
+void sg_Images_ReleaseBitmap(const char *name)
+{
+    bitmap bmp = sg_Images_BitmapNamed(name);
+    sg_Images_FreeBitmap(&bmp);
+}
+
+void sg_Images_ReleaseAllBitmaps()
+{
+    sgh_bitmap *bmp = _bitmaps;
+    while (bmp)
+    {
+        sgh_bitmap *next = bmp->next;
+        if (bmp != _screen && bmp->name[0]) sgh_DeleteBitmap(bmp);
+        bmp = next;
+    }
+}
+
+int32_t sg_Images_BitmapWidth(bitmap bmp)       { return bmp ? bmp->width  : 0; }
+int32_t sg_Images_BitmapHeight(bitmap bmp)      { return bmp ? bmp->height : 0; }
+int32_t sg_Images_BitmapCellWidth(bitmap bmp)   { return bmp ? bmp->cell_w : 0; }
+int32_t sg_Images_BitmapCellHeight(bitmap bmp)  { return bmp ? bmp->cell_h : 0; }
+int32_t sg_Images_BitmapCellColumns(bitmap bmp) { return bmp ? bmp->cell_cols : 0; }
+int32_t sg_Images_BitmapCellRows(bitmap bmp)    { return bmp ? bmp->cell_rows : 0; }
+int32_t sg_Images_BitmapCellCount(bitmap bmp)   { return bmp ? bmp->cell_count : 0; }
+
+void sg_Images_BitmapSetCellDetails(bitmap bmp, int32_t width, int32_t height, int32_t columns, int32_t rows, int32_t count)
+{
+    if (bmp == NULL) return;
+    bmp->cell_w     = width;
+    bmp->cell_h     = height;
+    bmp->cell_cols  = columns;
+    bmp->cell_rows  = rows;
+    bmp->cell_count = count;
+}
+
+rectangle sg_Images_BitmapRectangleOfCell(bitmap src, int32_t cell)
+{
+    rectangle result = { 0, 0, 0, 0 };
+    if (src == NULL || cell < 0 || cell >= src->cell_count || src->cell_cols < 1) return result;
+    result.x        = (float)((cell % src->cell_cols) * src->cell_w);
+    result.y        = (float)((cell / src->cell_cols) * src->cell_h);
+    result.width    = src->cell_w;
+    result.height   = src->cell_h;
+    return result;
+}
+
+bitmap_cell sg_Images_BitmapCellOf(bitmap bmp, int32_t cell)
+{
+    bitmap_cell result = { bmp, cell };
+    return result;
+}
+
+int32_t sg_Images_BitmapWidthForCell(const bitmap_cell *bmp)    { return bmp->bmp ? bmp->bmp->cell_w : 0; }
+int32_t sg_Images_BitmapHeightForCell(const bitmap_cell *bmp)   { return bmp->bmp ? bmp->bmp->cell_h : 0; }
+
+bool sg_Images_SameBitmapCell(const bitmap_cell *bmp1, const bitmap_cell *bmp2)
+{
+    return bmp1->bmp == bmp2->bmp && bmp1->cell == bmp2->cell;
+}
+
+void sg_Images_DrawBitmapOnto(bitmap dest, bitmap src, int32_t x, int32_t y)
+{
+    if (src == NULL) return;
+    sgh_Blit((sgh_bitmap *)dest, (sgh_bitmap *)src, 0, 0, src->width, src->height, x, y);
+}
+
+void sg_Images_DrawBitmapOnScreen(bitmap src, int32_t x, int32_t y)
+{
+    sg_Images_DrawBitmapOnto(sg_Headless_Screen(), src, x, y);
+}
+
+void sg_Images_DrawBitmap(bitmap src, float x, float y)
+{
+    sg_Images_DrawBitmapOnScreen(src, (int32_t)x, (int32_t)y);
+}
+
+void sg_Images_DrawBitmapAtPoint(bitmap src, const point2d *position)
+{
+    sg_Images_DrawBitmap(src, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapAtPointOnScreen(bitmap src, const point2d *position)
+{
+    sg_Images_DrawBitmap(src, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapAtPointOnto(bitmap dest, bitmap src, const point2d *position)
+{
+    sg_Images_DrawBitmapOnto(dest, src, (int32_t)position->x, (int32_t)position->y);
+}
+
+void sg_Images_DrawBitmapNamed(const char *name, float x, float y)
+{
+    sg_Images_DrawBitmap(sg_Images_BitmapNamed(name), x, y);
+}
+
+void sg_Images_DrawBitmapNamedAtPoint(const char *name, const point2d *position)
+{
+    sg_Images_DrawBitmapNamed(name, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapPartOnto(bitmap dest, bitmap src, int32_t srcX, int32_t srcY, int32_t srcW, int32_t srcH, int32_t x, int32_t y)
+{
+    sgh_Blit((sgh_bitmap *)dest, (sgh_bitmap *)src, srcX, srcY, srcW, srcH, x, y);
+}
+
+void sg_Images_DrawBitmapPartOnScreen(bitmap src, int32_t srcX, int32_t srcY, int32_t srcW, int32_t srcH, int32_t x, int32_t y)
+{
+    sg_Images_DrawBitmapPartOnto(sg_Headless_Screen(), src, srcX, srcY, srcW, srcH, x, y);
+}
+
+void sg_Images_DrawBitmapPart(bitmap src, int32_t srcX, int32_t srcY, int32_t srcW, int32_t srcH, float x, float y)
+{
+    sg_Images_DrawBitmapPartOnScreen(src, srcX, srcY, srcW, srcH, (int32_t)x, (int32_t)y);
+}
+
+void sg_Images_DrawBitmapPartFromRectOnto(bitmap dest, bitmap src, const rectangle *source, int32_t x, int32_t y)
+{
+    sg_Images_DrawBitmapPartOnto(dest, src, (int32_t)source->x, (int32_t)source->y,
+                                 source->width, source->height, x, y);
+}
+
+void sg_Images_DrawBitmapPartFromRectOnScreen(bitmap src, const rectangle *source, int32_t x, int32_t y)
+{
+    sg_Images_DrawBitmapPartFromRectOnto(sg_Headless_Screen(), src, source, x, y);
+}
+
+void sg_Images_DrawBitmapPartFromRect(bitmap src, const rectangle *source, float x, float y)
+{
+    sg_Images_DrawBitmapPartFromRectOnScreen(src, source, (int32_t)x, (int32_t)y);
+}
+
+void sg_Images_DrawBitmapPartFromRectAtPoint(bitmap src, const rectangle *source, const point2d *position)
+{
+    sg_Images_DrawBitmapPartFromRect(src, source, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapPartFromRectAtPointOnScreen(bitmap src, const rectangle *source, const point2d *position)
+{
+    sg_Images_DrawBitmapPartFromRect(src, source, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapPartFromRectAtPointOnto(bitmap dest, bitmap src, const rectangle *source, const point2d *position)
+{
+    sg_Images_DrawBitmapPartFromRectOnto(dest, src, source, (int32_t)position->x, (int32_t)position->y);
+}
+
+void sg_Images_DrawCellOntoXY(bitmap dest, bitmap src, int32_t cell, float x, float y)
+{
+    rectangle part = sg_Images_BitmapRectangleOfCell(src, cell);
+    sg_Images_DrawBitmapPartFromRectOnto(dest, src, &part, (int32_t)x, (int32_t)y);
+}
+
+void sg_Images_DrawCellOnto(bitmap dest, bitmap src, int32_t cell, const point2d *position)
+{
+    sg_Images_DrawCellOntoXY(dest, src, cell, position->x, position->y);
+}
+
+void sg_Images_DrawCellOnScreenXY(bitmap src, int32_t cell, float x, float y)
+{
+    sg_Images_DrawCellOntoXY(sg_Headless_Screen(), src, cell, x, y);
+}
+
+void sg_Images_DrawCellXY(bitmap src, int32_t cell, float x, float y)
+{
+    sg_Images_DrawCellOnScreenXY(src, cell, x, y);
+}
+
+void sg_Images_DrawCell(bitmap src, int32_t cell, const point2d *position)
+{
+    sg_Images_DrawCellOnScreenXY(src, cell, position->x, position->y);
+}
+
+void sg_Images_DrawCellOnScreen(bitmap src, int32_t cell, const point2d *position)
+{
+    sg_Images_DrawCellOnScreenXY(src, cell, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapCellOnto(bitmap dest, const bitmap_cell *src, int32_t x, int32_t y)
+{
+    sg_Images_DrawCellOntoXY(dest, src->bmp, src->cell, x, y);
+}
+
+void sg_Images_DrawBitmapCellOnScreen(const bitmap_cell *src, int32_t x, int32_t y)
+{
+    sg_Images_DrawBitmapCellOnto(sg_Headless_Screen(), src, x, y);
+}
+
+void sg_Images_DrawBitmapCell(const bitmap_cell *src, float x, float y)
+{
+    sg_Images_DrawBitmapCellOnScreen(src, (int32_t)x, (int32_t)y);
+}
+
+void sg_Images_DrawBitmapCellAtPoint(const bitmap_cell *src, const point2d *position)
+{
+    sg_Images_DrawBitmapCell(src, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapCellAtPointOnScreen(const bitmap_cell *src, const point2d *position)
+{
+    sg_Images_DrawBitmapCell(src, position->x, position->y);
+}
+
+void sg_Images_DrawBitmapCellAtPointOnto(bitmap dest, const bitmap_cell *src, const point2d *position)
+{
+    sg_Images_DrawBitmapCellOnto(dest, src, (int32_t)position->x, (int32_t)position->y);
+}
+
+//----------------------------------------------------------------------------
+// Text: one filled cell per glyph, sized from the font's point size
+//----------------------------------------------------------------------------
+
+static int32_t sgh_GlyphWidth(font theFont)
+{
+    int32_t size = theFont ? ((sgh_font *)theFont)->size : 8;
+    return size * 3 / 5 > 0 ? size * 3 / 5 : 1;
+}
+
+static int32_t sgh_GlyphHeight(font theFont)
+{
+    return theFont ? ((sgh_font *)theFont)->size : 8;
+}
+
+static void sgh_Text(sgh_bitmap *dest, const char *theText, color textColor, font theFont, float x, float y)
+{
+    int32_t gw = sgh_GlyphWidth(theFont), gh = sgh_GlyphHeight(theFont);
+    sgh_stats.text_draws++;
+
+    for (int32_t i = 0; theText[i]; i++)
+    {
+        if (theText[i] == ' ') continue;
+        sgh_FillRect(dest, textColor, (int32_t)x + i * gw, (int32_t)y + gh / 4, gw - 1, gh * 3 / 4);
+    }
+}
+
+font sg_Text_LoadFontNamed(const char *name, const char *filename, int32_t size)
+{
+    for (sgh_font *fnt = _fonts; fnt; fnt = fnt->next)
+        if (strcmp(fnt->name, name) == 0) return &fnt->data;
+
+    sgh_font *result = calloc(1, sizeof(sgh_font));
+    sgh_CopyName(result->name, name);
+    result->data.name   = result->name;
+    result->size        = size;
+    result->style       = NORMAL_FONT;
+    result->next        = _fonts;
+    _fonts = result;
+    return &result->data;
+}
+
+void sg_Text_FontNameFor(const char *fontName, int32_t size, char *result)
+{
+    sprintf(result, "%s|%d", fontName, size);
+}
+
+font sg_Text_LoadFont(const char *fontName, int32_t size)
+{
+    char name[SGH_NAME_LEN + 16];
+    sg_Text_FontNameFor(fontName, size, name);
+    return sg_Text_LoadFontNamed(name, fontName, size);
+}
+
+font sg_Text_FontNamed(const char *name)
+{
+    for (sgh_font *fnt = _fonts; fnt; fnt = fnt->next)
+        if (strcmp(fnt->name, name) == 0) return &fnt->data;
+    return NULL;
+}
+
+font sg_Text_FontNamedWithSize(const char *name, int32_t size)
+{
+    char fullName[SGH_NAME_LEN + 16];
+    sg_Text_FontNameFor(name, size, fullName);
+    return sg_Text_FontNamed(fullName);
+}
+
+bool sg_Text_HasFont(const char *name)
+{
+    return sg_Text_FontNamed(name) != NULL;
+}
+
+void sg_Text_FreeFont(font *fontToFree)
+{
+    if (fontToFree == NULL || *fontToFree == NULL) return;
+    sgh_font **link = &_fonts;
+    while (*link && &(*link)->data != *fontToFree) link = &(*link)->next;
+    if (*link)
+    {
+        sgh_font *dead = *link;
+        *link = dead->next;
+        sgh_NotifyFree(dead);
+        free(dead);
+    }
+    *fontToFree = NULL;
+}
+
+void sg_Text_ReleaseFont(const char *name)
+{
+    font fnt = sg_Text_FontNamed(name);
+    sg_Text_FreeFont(&fnt);
+}
+
+void sg_Text_ReleaseAllFonts()
+{
+    while (_fonts)
+    {
+        font fnt = &_fonts->data;
+        sg_Text_FreeFont(&fnt);
+    }
+}
+
+font_style sg_Text_FontFontStyle(font font)             { return ((sgh_font *)font)->style; }
+void sg_Text_FontSetStyle(font font, font_style value)  { ((sgh_font *)font)->style = value; }
+
+int32_t sg_Text_TextWidth(font theFont, const char *theText)
+{
+    return (int32_t)strlen(theText) * sgh_GlyphWidth(theFont);
+}
+
+int32_t sg_Text_TextHeight(font theFont, const char *theText)
+{
+    return sgh_GlyphHeight(theFont);
+}
+
+void sg_Text_DrawText(const char *theText, color textColor, font theFont, float x, float y)
+{
+    sgh_Text(sgh_Screen(), theText, textColor, theFont, x, y);
+}
+
+void sg_Text_DrawTextAtPoint(const char *theText, color textColor, font theFont, const point2d *pt)
+{
+    sgh_Text(sgh_Screen(), theText, textColor, theFont, pt->x, pt->y);
+}
+
+void sg_Text_DrawTextOnScreen(const char *theText, color textColor, font theFont, int32_t x, int32_t y)
+{
+    sgh_Text(sgh_Screen(), theText, textColor, theFont, x, y);
+}
+
+void sg_Text_DrawTextOnScreenAtPoint(const char *theText, color textColor, font theFont, const point2d *pt)
+{
+    sgh_Text(sgh_Screen(), theText, textColor, theFont, pt->x, pt->y);
+}
+
+void sg_Text_DrawTextOnBitmap(bitmap dest, const char *theText, color textColor, font theFont, int32_t x, int32_t y)
+{
+    sgh_Text((sgh_bitmap *)dest, theText, textColor, theFont, x, y);
+}
+
+void sg_Text_DrawTextOnBitmapAtPoint(bitmap dest, const char *theText, color textColor, font theFont, const point2d *pt)
+{
+    sgh_Text((sgh_bitmap *)dest, theText, textColor, theFont, pt->x, pt->y);
+}
+
+void sg_Text_DrawSimpleText(const char *theText, color textColor, float x, float y)
+{
+    sgh_Text(sgh_Screen(), theText, textColor, NULL, x, y);
+}
+
+void sg_Text_DrawSimpleTextOnScreen(const char *theText, color textColor, float x, float y)
+{
+    sgh_Text(sgh_Screen(), theText, textColor, NULL, x, y);
+}
+
+void sg_Text_DrawSimpleTextPt(const char *theText, color textColor, const point2d *pt)
+{
+    sgh_Text(sgh_Screen(), theText, textColor, NULL, pt->x, pt->y);
+}
+
+void sg_Text_DrawSimpleTextOnBitmap(bitmap dest, const char *theText, color textColor, float x, float y)
+{
+    sgh_Text((sgh_bitmap *)dest, theText, textColor, NULL, x, y);
+}
+
+bitmap sg_Text_DrawTextToBitmapAtPointWithFontNamedAndSize(font font, const char *str, color clrFg, color backgroundColor)
+{
+    sgh_bitmap *result = sgh_NewBitmap("", "", sg_Text_TextWidth(font, str), sg_Text_TextHeight(font, str));
+    sgh_FillRect(result, backgroundColor, 0, 0, result->data.width, result->data.height);
+    sgh_Text(result, str, clrFg, font, 0, 0);
+    return &result->data;
+}
@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------
+// SGHeadlessPrivate.h
+//----------------------------------------------------------------------------
+//
+//  State shared between the headless backend's translation units. Not
+//  part of the SGSDK interface; only lib/headless/*.c include this.
+//
+//----------------------------------------------------------------------------
+
+#ifndef SGHeadlessPrivate
+#define SGHeadlessPrivate
+
+#include "SGSDK.h"
+#include "SGHeadless.h"
+
+#define SGH_MAX_CLIPS   16
+#define SGH_MAX_KEYS    512
+#define SGH_NAME_LEN    256
+
+// A bitmap surface. data must stay first: the bitmap handed out to the
+// wrappers is &data, and the backend casts it back to sgh_bitmap.
+typedef struct _sgh_bitmap {
+    bitmap_data         data;
+    uint32_t           *pixels;
+    rectangle           clips[SGH_MAX_CLIPS];
+    int32_t             clip_count;
+    char                name[SGH_NAME_LEN];
+    char                filename[SGH_NAME_LEN];
+    struct _sgh_bitmap *next;
+} sgh_bitmap;
+
+// Counters shared by every unit
+extern headless_stats sgh_stats;
+
+// Core (SGHeadlessCore.c)
+void     sgh_NotifyFree(void *ptr);
+void     sgh_Unimplemented(const char *name);
+void     sgh_ResourcePath(const char *subdir, const char *filename, char *result, size_t len);
+void     sgh_CopyName(char *dest, const char *src);
+
+// Graphics (SGHeadlessGraphics.c)
+sgh_bitmap *sgh_Screen();
+void     sgh_FillRect(sgh_bitmap *dest, color clr, int32_t x, int32_t y, int32_t w, int32_t h);
+void     sgh_Blit(sgh_bitmap *dest, sgh_bitmap *src, int32_t srcX, int32_t srcY,
+                  int32_t srcW, int32_t srcH, int32_t x, int32_t y);
+
+// Used by generated stubs to log the first call into each stub
+#define SGH_UNIMPLEMENTED() \
+    do { \
+        static bool warned = false; \
+        sgh_stats.unimplemented_calls++; \
+        if (!warned) { warned = true; sgh_Unimplemented(__func__); } \
+    } while (0)
+
+#endif
@@ -0,0 +1,4551 @@
+/*
+* Generated by gen_stubs.py - DO NOT EDIT!
+*
+* Headless SGSDK entry points with no implementation yet
+*
+* Stubbing SGSDK.h
+*/
+
+#include <string.h>
+
+#include "SGHeadlessPrivate.h"
+
+int32_t sg_Animations_AnimationCurrentCell(animation anim)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Animations_AnimationCurrentVector(animation anim)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Animations_AnimationEnded(animation anim)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Animations_AnimationEnteredFrame(animation anim)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Animations_AnimationFrameTime(animation anim)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Animations_AnimationIndex(animation_script temp, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Animations_AnimationName(animation_script temp, int32_t idx, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_AnimationScriptName(animation_script script, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+animation_script sg_Animations_AnimationScriptNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    animation_script result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Animations_AssignAnimation(animation anim, int32_t idx, animation_script script)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_AssignAnimationNamed(animation anim, const char *name, animation_script script)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_AssignAnimationNamedWithSound(animation anim, const char *name, animation_script script, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_AssignAnimationWithSound(animation anim, int32_t idx, animation_script script, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+animation sg_Animations_CreateAnimation(int32_t identifier, animation_script script, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+    animation result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+animation sg_Animations_CreateAnimationNamed(const char *identifier, animation_script script)
+{
+    SGH_UNIMPLEMENTED();
+    animation result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+animation sg_Animations_CreateAnimationNamedWithSound(const char *identifier, animation_script script, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+    animation result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+animation sg_Animations_CreateAnimationWithSound(int32_t identifier, animation_script script)
+{
+    SGH_UNIMPLEMENTED();
+    animation result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Animations_DrawAnimation(animation ani, bitmap bmp, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_DrawAnimationAtPoint(animation ani, bitmap bmp, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_DrawAnimationOnScreen(animation ani, bitmap bmp, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_DrawAnimationOnScreenAtPt(animation ani, bitmap bmp, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_DrawAnimationOntoDest(bitmap dest, animation ani, bitmap bmp, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_DrawAnimationOntoDestAtPt(bitmap dest, animation ani, bitmap bmp, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_FreeAnimation(animation *ani)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_FreeAnimationScript(animation_script *scriptToFree)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Animations_HasAnimationScript(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+animation_script sg_Animations_LoadAnimationScript(const char *filename)
+{
+    SGH_UNIMPLEMENTED();
+    animation_script result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+animation_script sg_Animations_LoadAnimationScriptNamed(const char *name, const char *filename)
+{
+    SGH_UNIMPLEMENTED();
+    animation_script result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Animations_ReleaseAllAnimationScripts()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_ReleaseAnimationScript(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_ResetAnimationWithSound(animation anim, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_RestartAnimation(animation anim)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_UpdateAnimation(animation anim)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_UpdateAnimationPct(animation anim, float pct)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Animations_UpdateAnimationPctAndSound(animation anim, float pct, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+arduino_device sg_Arduino_ArduinoDeviceNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    arduino_device result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Arduino_ArduinoHasData(arduino_device dev)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+unsigned char sg_Arduino_ArduinoReadByte(arduino_device dev)
+{
+    SGH_UNIMPLEMENTED();
+    unsigned char result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+unsigned char sg_Arduino_ArduinoReadByteTimeout(arduino_device dev, int32_t timeout)
+{
+    SGH_UNIMPLEMENTED();
+    unsigned char result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Arduino_ArduinoReadLine(arduino_device dev, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Arduino_ArduinoReadLineTimeout(arduino_device dev, int32_t timeout, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Arduino_ArduinoSendByte(arduino_device dev, unsigned char value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Arduino_ArduinoSendString(arduino_device dev, const char *value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Arduino_ArduinoSendStringLine(arduino_device dev, const char *value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+arduino_device sg_Arduino_CreateArduinoDevice(const char *port, int32_t baud)
+{
+    SGH_UNIMPLEMENTED();
+    arduino_device result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+arduino_device sg_Arduino_CreateArduinoNamed(const char *name, const char *port, int32_t baud)
+{
+    SGH_UNIMPLEMENTED();
+    arduino_device result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Arduino_FreeArduinoDevice(arduino_device *dev)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Arduino_HasArduinoDevice(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Arduino_ReleaseAllArduinoDevices()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Arduino_ReleaseArduinoDevice(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+point2d sg_Camera_CameraPos()
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Camera_CameraScreenRect()
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Camera_CameraX()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Camera_CameraY()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Camera_CenterCameraOn(sprite s, const vector *offset)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_CenterCameraOnCharacter(character c, const vector *offset)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_CenterCameraOnWithXYOffset(sprite s, int32_t offsetX, int32_t offsetY)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_MoveCameraBy(const vector *offset)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_MoveCameraByXY(float dx, float dy)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_MoveCameraTo(const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_MoveCameraToXY(float x, float y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Camera_PointOnScreen(const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Camera_RectOnScreen(const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Camera_SetCameraPos(const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_SetCameraX(float x)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Camera_SetCameraY(float y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+point2d sg_Camera_ToScreen(const point2d *worldPoint)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Camera_ToScreenRect(const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Camera_ToScreenX(float worldX)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Camera_ToScreenY(float worldY)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Camera_ToWorld(const point2d *screenPoint)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Camera_ToWorldX(int32_t screenX)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Camera_ToWorldY(int32_t screenY)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+direction_angles sg_Characters_CharacterAngleAt(character c, int32_t index)
+{
+    SGH_UNIMPLEMENTED();
+    direction_angles result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Characters_CharacterAngleMaxAt(character c, int32_t index)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Characters_CharacterAngleMinAt(character c, int32_t index)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Characters_CharacterAnglesLength(character c)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Characters_CharacterCharacterName(character c, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_Characters_CharacterCurrentDirection(character c)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Characters_CharacterCurrentState(character c)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Characters_CharacterDirectionCount(character c)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Characters_CharacterDirections(character c, string_array result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterFilename(character c, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterName(character c, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+character sg_Characters_CharacterNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    character result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Characters_CharacterSetCurrentDirection(character c, int32_t direction)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterSetCurrentState(character c, int32_t state)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterSetName(character c, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterSetType(character c, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterSetValue(character c, int32_t idx, float val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterSetValueByName(character c, const char *name, float val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Characters_CharacterShownLayersAt(character c, int32_t index)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Characters_CharacterSprite(character c)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Characters_CharacterStateCount(character c)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Characters_CharacterStates(character c, string_array result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_CharacterType(character c, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Characters_CharacterValueAt(character c, int32_t index)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Characters_CharacterValueCount(character c)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Characters_CharacterValueNames(character c, string_array result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_DrawCharacter(character c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_DrawCharacterSprite(character c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_DrawCharacterWithStationary(character c, int32_t stationaryState, int32_t state)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_FreeCharacter(character *c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Characters_HasCharacter(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+character sg_Characters_LoadCharacter(const char *filename)
+{
+    SGH_UNIMPLEMENTED();
+    character result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+character sg_Characters_LoadCharacterNamed(const char *name, const char *filename)
+{
+    SGH_UNIMPLEMENTED();
+    character result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Characters_ReleaseAllCharacters()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_ReleaseCharacter(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_SetActiveLayer(character c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Characters_ToggleLayerVisibility(character c, int32_t index)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Characters_UpdateDirectionAnimation(character c)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Characters_UpdateDirectionAnimationWithStationary(character c, int32_t state, int32_t newState)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Geometry_CalculateAngleBetweenSprites(sprite s1, sprite s2)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Geometry_ClosestPointOnCircle(const point2d *fromPt, const circle *c)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Geometry_ClosestPointOnLineFromCircle(const circle *c, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Geometry_ClosestPointOnLinesFromCircle(const circle *c, const lines_array lines, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Geometry_ClosestPointOnRectFromCircle(const circle *c, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Geometry_CreateRectangleLines(const lines_array lines, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_CreateVectorFromPointPtToRectangle(const point2d *pt, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_CreateVectorFromPointToRect(float x, float y, float rectX, float rectY, int32_t rectWidth, int32_t rectHeight)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_CreateVectorFromPointToRectangle(float x, float y, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Geometry_DistantPointOnCircle(const point2d *pt, const circle *c)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Geometry_DistantPointOnCircleHeading(const point2d *pt, const circle *c, const vector *heading, point2d *oppositePt)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Geometry_LineCircleHit(const circle *c, const vector *velocity, const lines_array lines, line_segment *found, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Geometry_RayCircleIntersectDistance(const point2d *ray_origin, const vector *ray_heading, const circle *c)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Geometry_RayIntersectionPoint(const point2d *fromPt, const vector *heading, const line_segment *line, point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Geometry_RectangleFromLines(const lines_array lines, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Geometry_TangentPoints(const point2d *fromPt, const circle *c, point2d *p1, point2d *p2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorFromPointPtToRectangle(const point2d *pt, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorFromPointToRect(float x, float y, float rectX, float rectY, int32_t rectWidth, int32_t rectHeight)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorFromPointToRectangle(float x, float y, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorOutOfCircleFromCircle(const circle *src, const circle *bounds, const vector *velocity)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorOutOfCircleFromPoint(const point2d *pt, const circle *c, const vector *velocity)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorOutOfRectFromCircle(const circle *c, const rectangle *rect, const vector *velocity)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorOutOfRectFromPoint(const point2d *pt, const rectangle *rect, const vector *velocity)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorOutOfRectFromRect(const rectangle *src, const rectangle *bounds, const vector *velocity)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorOverLinesFromCircle(const circle *c, const lines_array lines, const vector *velocity, int32_t *maxIdx, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Geometry_VectorOverLinesFromLines(const lines_array srcLines, const lines_array boundLines, const vector *velocity, int32_t *maxIdx, int32_t srcLines_len, int32_t boundLines_len)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Geometry_WidestPoints(const circle *c, const vector *along, point2d *pt1, point2d *pt2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Graphics_BrightnessOf(color c)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Graphics_DrawHorizontalLine(color clr, float y, float x1, float x2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawHorizontalLineOnScreen(color clr, int32_t y, int32_t x1, int32_t x2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawHorizontalLineOnto(bitmap dest, color clr, int32_t y, int32_t x1, int32_t x2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLine(color clr, float xPosStart, float yPosStart, float xPosEnd, float yPosEnd)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLineOnScreen(color clr, int32_t xPosStart, int32_t yPosStart, int32_t xPosEnd, int32_t yPosEnd)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLineOnto(bitmap dest, color clr, int32_t xPosStart, int32_t yPosStart, int32_t xPosEnd, int32_t yPosEnd)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLinePts(color clr, const point2d *startPt, const point2d *endPt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLinePtsOnScreen(color clr, const point2d *startPt, const point2d *endPt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLinePtsOnto(bitmap dest, color clr, const point2d *startPt, const point2d *endPt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLineSegment(color clr, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLineSegmentOnScreen(color clr, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLineSegmentOnto(bitmap dest, color clr, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawLineSegments(color clr, const lines_array lines, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircle(color clr, bool filled, float xc, float yc, int32_t radius)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleAtPoint(color clr, bool filled, const point2d *position, int32_t radius)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleAtPointOnScreen(color clr, bool filled, const point2d *position, int32_t radius)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleAtPointOnto(bitmap dest, color clr, bool filled, const point2d *point, int32_t radius)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleOnScreen(color clr, bool filled, float xc, float yc, int32_t radius)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleOnto(bitmap dest, color clr, bool filled, float xc, float yc, int32_t radius)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleStruct(color clr, bool filled, const circle *c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleStructOnScreen(color clr, bool filled, const circle *c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillCircleStructOnto(bitmap dest, color clr, bool filled, const circle *c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillEllipse(color clr, bool filled, float xPos, float yPos, int32_t width, int32_t height)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillEllipseInRect(color clr, bool filled, const rectangle *source)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillEllipseInRectOnScreen(color clr, bool filled, const rectangle *source)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillEllipseInRectOnto(bitmap dest, color clr, bool filled, const rectangle *source)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillEllipseOnScreen(color clr, bool filled, int32_t xPos, int32_t yPos, int32_t width, int32_t height)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillEllipseOnto(bitmap dest, color clr, bool filled, int32_t xPos, int32_t yPos, int32_t width, int32_t height)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillRectangleOnto(bitmap dest, color clr, bool filled, int32_t xPos, int32_t yPos, int32_t width, int32_t height)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillRectangleStructOnto(bitmap dest, color clr, bool filled, const rectangle *source)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawOrFillTriangleStructOnto(bitmap dest, color clr, bool filled, const triangle  *tri)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawPixel(color clr, float x, float y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawPixelAtPoint(color clr, const point2d *position)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawPixelAtPointOnScreen(color clr, const point2d *position)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawPixelAtPointOnto(bitmap dest, color clr, const point2d *position)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawPixelOnScreen(color clr, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawPixelOnto(bitmap dest, color clr, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawTriangleOnScreen(color clr, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawTriangleOnto(bitmap dest, color clr, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawVerticalLine(color clr, float x, float y1, float y2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawVerticalLineOnScreen(color clr, int32_t x, int32_t y1, int32_t y2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_DrawVerticalLineOnto(bitmap dest, color clr, int32_t x, int32_t y1, int32_t y2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_FillTriangle(color clr, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_FillTriangleOnScreen(color clr, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Graphics_FillTriangleOnto(bitmap dest, color clr, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+color sg_Graphics_HSBColor(float hue, float saturation, float brightness)
+{
+    SGH_UNIMPLEMENTED();
+    color result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Graphics_HSBValuesOf(color c, float *h, float *s, float *b)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Graphics_HueOf(color c)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Graphics_SaturationOf(color c)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+circle sg_Images_BitmapCellCircle(bitmap bmp, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+circle sg_Images_BitmapCellCircleXY(bitmap bmp, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Images_BitmapCellRectangle(const point2d *pt, bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Images_BitmapCellRectangleAtOrigin(bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Images_BitmapCellRectangleXY(float x, float y, bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+circle sg_Images_BitmapCircle(bitmap bmp, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+circle sg_Images_BitmapCircleXY(bitmap bmp, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Images_BitmapFilename(bitmap bmp, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_BitmapName(bitmap bmp, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+rectangle sg_Images_BitmapRectAtOrigin(bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Images_BitmapRectXY(float x, float y, bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Images_BitmapsInterchangable(bitmap bmp1, bitmap bmp2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Images_ClearSurface(bitmap dest, color toColor)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_ClearSurfaceToBlack(bitmap dest)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bitmap sg_Images_CombineIntoGrid(const bitmap *bitmaps, int32_t cols, int32_t bitmaps_len)
+{
+    SGH_UNIMPLEMENTED();
+    bitmap result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Images_MakeOpaque(bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_MakeTransparent(bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_OptimiseBitmap(bitmap surface)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Images_PixelDrawnAtPoint(bitmap bmp, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bitmap sg_Images_RotateScaleBitmap(bitmap src, float degRot, float scale)
+{
+    SGH_UNIMPLEMENTED();
+    bitmap result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Images_SaveBitmap(bitmap src, const char *filepath)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_SaveToPNG(bitmap bmp, const char *filename)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_SetOpacity(bitmap bmp, float pct)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_SetTransparentColor(bitmap src, color clr)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Images_SetupBitmapForCollisions(bitmap src)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Input_DeviceMovedInXAxis()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Input_DeviceMovedInYAxis()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Input_DeviceMovedInZAxis()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Input_EndReadingText(char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_FingersOnScreen(finger_array result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Input_GetAccelerometerThreshold()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Input_HideKeyboard()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_HideMouse()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_KeyName(key_code key, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Input_KeyUp(key_code key)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Input_KeyboardShown()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Input_MouseClicked(mouse_button button)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Input_MouseDown(mouse_button button)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Input_MouseMovement()
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Input_MousePosition()
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Input_MousePositionAsVector()
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Input_MouseShown()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Input_MouseUp(mouse_button button)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Input_MouseX()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Input_MouseY()
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Input_MoveMouse(unsigned char x, unsigned char y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_MoveMouseToPoint(const point2d *point)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_Input_NumberOfFingersOnScreen()
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Input_ReadingText()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Input_ScreenTouched()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Input_SetAccelerometerThreshold(float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_SetMouseVisible(bool show)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_ShowKeyboard()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_ShowMouse()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_StartReadingText(color textColor, int32_t maxLength, font theFont, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_StartReadingTextWithText(const char *text, color textColor, int32_t maxLength, font theFont, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_StartReadingTextWithTextAndColorInArea(const char *text, color textColor, color backGroundColor, int32_t maxLength, font theFont, const rectangle *area)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_StartReadingTextWithTextAtPt(const char *text, color textColor, int32_t maxLength, font theFont, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_StartReadingTextWithTextInArea(const char *text, color textColor, int32_t maxLength, font theFont, const rectangle *area)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_StartReadingTextWithinArea(color textColor, int32_t maxLength, font theFont, const rectangle *area)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Input_TextEntryCancelled()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Input_TextReadAsASCII(char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Input_ToggleKeyboard()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_Networking_AcceptTCPConnection()
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Networking_BroadcastTCPMessage(const char *aMsg)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_BroadcastUDPMessage(const char *aMsg)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_ClearMessageQueue(connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_CloseAllConnections()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_CloseAllSockets()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_CloseAllTCPHostSockets()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_CloseAllUDPSockets()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Networking_CloseConnection(connection *aConnection)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Networking_CloseTCPHostSocket(int32_t aPort)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Networking_CloseUDPSocket(int32_t aPort)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Networking_ConnectionCount()
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+uint32_t sg_Networking_ConnectionIP(connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+    uint32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Networking_ConnectionPort(connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Networking_ConnectionQueueSize()
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+connection sg_Networking_CreateTCPConnection(const char *aIP, int32_t aPort)
+{
+    SGH_UNIMPLEMENTED();
+    connection result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Networking_CreateTCPHost(int32_t aPort)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+connection sg_Networking_CreateUDPConnection(const char *aDestIP, int32_t aDestPort, int32_t aInPort)
+{
+    SGH_UNIMPLEMENTED();
+    connection result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Networking_CreateUDPHost(int32_t aPort)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Networking_DecToHex(uint32_t aDec, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_EnqueueMessage(const char *aMsg, connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_EnqueueNewConnection(connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+connection sg_Networking_FetchConnection()
+{
+    SGH_UNIMPLEMENTED();
+    connection result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Networking_FreeConnection(connection *aConnection)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_HexStrToIPv4(const char *aHex, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_HexToDecString(const char *aHex, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+uint32_t sg_Networking_IPv4ToDec(const char *aIP)
+{
+    SGH_UNIMPLEMENTED();
+    uint32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Networking_MessageCount(connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Networking_MyIP(char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_ReadLastMessage(connection aConnection, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_ReadMessage(connection aConnection, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Networking_ReleaseAllConnections()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+connection sg_Networking_RetreiveConnection(int32_t aConnectionAt)
+{
+    SGH_UNIMPLEMENTED();
+    connection result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+connection sg_Networking_SendTCPMessage(const char *aMsg, connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+    connection result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Networking_SendUDPMessage(const char *aMsg, connection aConnection)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Networking_TCPMessageReceived()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Networking_UDPMessageReceived()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapAtPointsCollision(bitmap bmp1, const point2d *pt1, bitmap bmp2, const point2d *pt2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapCollision(bitmap bmp1, int32_t x1, int32_t y1, bitmap bmp2, int32_t x2, int32_t y2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapPartAtPtRectCollision(bitmap bmp, const point2d *pt, const rectangle *part, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapPartPointCollision(bitmap bmp, int32_t x, int32_t y, const rectangle *part, float ptX, float ptY)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapPartPointXYCollision(bitmap bmp, int32_t x, int32_t y, const rectangle *part, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapPartRectCollision(bitmap bmp, int32_t x, int32_t y, const rectangle *part, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapPointCollision(bitmap bmp, int32_t x, int32_t y, float ptX, float ptY)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapPointPtCollision(bitmap bmp, int32_t x, int32_t y, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapRectCollision(bitmap bmp, int32_t x, int32_t y, int32_t rectX, int32_t rectY, int32_t rectWidth, int32_t rectHeight)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapRectangleCollision(bitmap bmp, int32_t x, int32_t y, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_BitmapsPartsCollision(bitmap bmp1, const point2d *pt1, const rectangle *part1, bitmap bmp2, const point2d *pt2, const rectangle *part2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellBitmapCollision(bitmap bmp1, int32_t cell, int32_t x1, int32_t y1, bitmap bmp2, int32_t x2, int32_t y2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellBitmapCollisionAtPt(bitmap bmp1, int32_t cell, const point2d *pt1, bitmap bmp2, const point2d *pt2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellBitmapPartCollision(bitmap bmp1, int32_t cell, int32_t x1, int32_t y1, bitmap bmp2, int32_t x2, int32_t y2, const rectangle *part)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellBitmapPartCollisionAtPt(bitmap bmp1, int32_t cell, const point2d *pt1, bitmap bmp2, const point2d *pt2, const rectangle *part)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellCollision(bitmap bmp1, int32_t cell1, int32_t x1, int32_t y1, bitmap bmp2, int32_t cell2, int32_t x2, int32_t y2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellCollisionAtPt(bitmap bmp1, int32_t cell1, const point2d *pt1, bitmap bmp2, int32_t cell2, const point2d *pt2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellRectCollision(bitmap bmp, int32_t cell, int32_t x, int32_t y, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CellRectCollisionAtPt(bitmap bmp, int32_t cell, const point2d *pt, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CircleCircleCollision(const circle *c1, const circle *c2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CircleLinesCollision(const circle *c, const lines_array lines, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CircleRectCollision(const circle *c, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_CircleTriangleCollision(const circle *c, const triangle  *tri)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Physics_CollideCircleCircle(sprite s, const circle *c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Physics_CollideCircleLine(sprite s, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Physics_CollideCircleLines(sprite s, const lines_array lines, int32_t lines_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Physics_CollideCircleRectangle(sprite s, const rectangle *rect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Physics_CollideCircles(sprite s1, sprite s2)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Physics_RectLineCollision(const rectangle *rect, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+collision_side sg_Physics_SideForCollisionTest(const vector *velocity)
+{
+    SGH_UNIMPLEMENTED();
+    collision_side result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_SpriteBitmapAtPointCollision(sprite s, bitmap bmp, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_SpriteBitmapCollision(sprite s, bitmap bmp, float x, float y)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_SpriteCircleLineCollision(sprite s, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_SpriteCollision(sprite s1, sprite s2)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_SpriteRectCollision(sprite s, float x, float y, int32_t width, int32_t height)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_SpriteRectLineCollision(sprite s, const line_segment *line)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_SpriteRectangleCollision(sprite s, const rectangle *r)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Physics_TriangleLineCollision(const triangle  *tri, const line_segment *ln)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Resources_HasResourceBundle(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Resources_LoadResourceBundle(const char *name, bool showProgress)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Resources_LoadResourceBundleNamed(const char *name, const char *filename, bool showProgress)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Resources_PathToOtherResourceWithBase(const char *path, const char *filename, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Resources_PathToResourceWithBase(const char *path, const char *filename, resource_kind kind, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Resources_PathToResourceWithSubPaths(const char *filename, resource_kind kind, const string_array subPaths, char *result, int32_t subPaths_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Resources_PathToResourseInSubdir(const char *filename, const char *subdir, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Resources_PathToResourseKindInSubdir(const char *filename, resource_kind kind, const char *subdir, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Resources_ReleaseResourceBundle(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+point2d sg_Sprites_CenterPoint(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateBasicSprite(bitmap layer)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateBasicSpriteNamed(const char *name, bitmap layer)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateBasicSpritePt(bitmap layer, point2d pt)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateBasicSpriteXY(bitmap layer, float x, float y)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSprite(const bitmap *layers, int32_t layers_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSpriteNamed(const char *name, const bitmap *layers, int32_t layers_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSpriteWithAnimationScript(const bitmap *layers, animation_script ani, int32_t layers_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSpriteWithAnimationScriptNamed(const char *name, const bitmap *layers, animation_script ani, int32_t layers_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSpriteWithLayerNames(const bitmap *layers, const string_array layerNames, int32_t layers_len, int32_t layerNames_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSpriteWithLayerNamesAndAnimationScript(const bitmap *layers, const string_array layerNames, animation_script ani, int32_t layers_len, int32_t layerNames_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSpriteWithLayerNamesAndAnimationScriptNamed(const char *name, const bitmap *layers, const string_array layerNames, animation_script ani, int32_t layers_len, int32_t layerNames_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateLayeredSpriteWithLayerNamesNamed(const char *name, const bitmap *layers, const string_array layerNames, int32_t layers_len, int32_t layerNames_len)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithAnimation(bitmap layer, animation_script ani)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithAnimationNamed(const char *name, bitmap layer, animation_script ani)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithAnimationPt(bitmap layer, animation_script ani, point2d pt)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithAnimationXY(bitmap layer, animation_script ani, float x, float y)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithLayer(bitmap layer, const char *layerName)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithLayerAndAnimation(bitmap layer, const char *layerName, animation_script ani)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithLayerAndAnimationNamed(const char *name, bitmap layer, const char *layerName, animation_script ani)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+sprite sg_Sprites_CreateSpriteWithLayerNamed(const char *name, bitmap layer, const char *layerName)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_DrawSpriteOffsetPoint(sprite s, const point2d *position)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_DrawSpriteOffsetXY(sprite s, int32_t xOffset, int32_t yOffset)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_FreeSprite(sprite *s)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Sprites_HasSprite(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_MoveSpritePct(sprite s, float pct)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_MoveSpriteTo(sprite s, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_MoveSpriteVecPct(sprite s, const vector *distance, float pct)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_ReleaseAllSprites()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_ReleaseSprite(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_ReplayAnimationWithSound(sprite s, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_Sprites_SpriteAddLayer(sprite s, bitmap newLayer, const char *layerName)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteAddToVelocity(sprite s, const vector *value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteAddValue(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteAddValueWithInitialValue(sprite s, const char *name, float initVal)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_Sprites_SpriteAnimationHasEnded(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteBringLayerForward(sprite s, int32_t visibleLayer)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteBringLayerToFront(sprite s, int32_t visibleLayer)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+circle sg_Sprites_SpriteCircle(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bitmap sg_Sprites_SpriteCollisionBitmap(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    bitmap result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+circle sg_Sprites_SpriteCollisionCircle(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+collision_test_kind sg_Sprites_SpriteCollisionKind(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    collision_test_kind result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Sprites_SpriteCollisionRectangle(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteCurrentCell(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Sprites_SpriteCurrentCellRectangle(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteDX(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteDY(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteHeading(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteHeight(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteHideLayer(sprite s, int32_t id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteHideLayerNamed(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bitmap sg_Sprites_SpriteLayerAtIdx(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+    bitmap result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+circle sg_Sprites_SpriteLayerCircle(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteLayerCount(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteLayerHeight(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteLayerIndex(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteLayerName(sprite s, int32_t idx, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bitmap sg_Sprites_SpriteLayerNamed(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bitmap result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+circle sg_Sprites_SpriteLayerNamedCircle(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    circle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteLayerNamedHeight(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Sprites_SpriteLayerNamedRectangle(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteLayerNamedWidth(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Sprites_SpriteLayerOffset(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Sprites_SpriteLayerOffsetNamed(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteLayerOffsets(sprite s, point2d *result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+rectangle sg_Sprites_SpriteLayerRectangle(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteLayerWidth(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteLayers(sprite s, bitmap *result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Sprites_SpriteMass(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteName(sprite sprt, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+sprite sg_Sprites_SpriteNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    sprite result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Sprites_SpriteOffscreen(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Sprites_SpriteOnScreenAt(sprite s, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_Sprites_SpriteOnScreenAtPoint(sprite s, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+point2d sg_Sprites_SpritePosition(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    point2d result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteReplayAnimation(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Sprites_SpriteRotation(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteScale(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+rectangle sg_Sprites_SpriteScreenRectangle(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    rectangle result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteSendLayerBackward(sprite s, int32_t visibleLayer)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSendLayerToBack(sprite s, int32_t visibleLayer)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetCollisionBitmap(sprite s, bitmap bmp)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetCollisionKind(sprite s, collision_test_kind value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetDX(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetDY(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetHeading(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetLayerOffset(sprite s, int32_t idx, const point2d *value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetLayerOffsetNamed(sprite s, const char *name, const point2d *value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetLayerOffsets(sprite s, const point2d *values, int32_t values_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetMass(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetPosition(sprite s, const point2d *value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetRotation(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetScale(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetSpeed(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetValue(sprite s, int32_t idx, float val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetValueNamed(sprite s, const char *name, float val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetVelocity(sprite s, const vector *value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetX(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteSetY(sprite s, float value)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_Sprites_SpriteShowLayer(sprite s, int32_t id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteShowLayerNamed(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteSpeed(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteStartAnimation(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteStartAnimationNamed(sprite s, const char *named)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteStartAnimationNamedWithSound(sprite s, const char *named, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteStartAnimationWithSound(sprite s, int32_t idx, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteToggleLayerNamedVisible(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_SpriteToggleLayerVisible(sprite s, int32_t id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+float sg_Sprites_SpriteValue(sprite s, int32_t index)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteValueCount(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteValueNamed(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteValueNames(sprite s, string_array result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+vector sg_Sprites_SpriteVelocity(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteVisibleIndexOfLayer(sprite s, int32_t id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteVisibleIndexOfLayerNamed(sprite s, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteVisibleLayer(sprite s, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_Sprites_SpriteVisibleLayerCount(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_SpriteVisibleLayerIds(sprite s, int32_t *result, int32_t result_len)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_Sprites_SpriteWidth(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteX(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_Sprites_SpriteY(sprite s)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Sprites_UpdateSpriteAnimationPctWithSound(sprite s, float pct, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Sprites_UpdateSpritePctWithSound(sprite s, float pct, bool withSound)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+vector sg_Sprites_VectorFromCenterSpriteToPoint(sprite s, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+vector sg_Sprites_VectorFromTo(sprite s1, sprite s2)
+{
+    SGH_UNIMPLEMENTED();
+    vector result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_Text_DrawFramerate(int32_t x, int32_t y, font font)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawFramerateFontNamed(int32_t x, int32_t y, const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawFramerateFontNamedSize(int32_t x, int32_t y, const char *name, int32_t size)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawFramerateWithSimpleFont(int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextAtPointWithFontNamed(const char *theText, color textColor, const char *name, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextAtPointWithFontNamedAndSize(const char *theText, color textColor, const char *name, int32_t size, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLines(const char *theText, color textColor, color backColor, font theFont, font_alignment align, float x, float y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRect(const char *theText, color textColor, color backColor, font theFont, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectOnBitmap(bitmap dest, const char *theText, color textColor, color backColor, font theFont, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectOnBitmapWithFontNamed(bitmap dest, const char *theText, color textColor, color backColor, const char *name, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectOnBitmapWithFontNamedAndSize(bitmap dest, const char *theText, color textColor, color backColor, const char *name, int32_t size, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectOnScreen(const char *theText, color textColor, color backColor, font theFont, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectOnScreenWithFontNamed(const char *theText, color textColor, color backColor, const char *name, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectOnScreenWithFontNamedAndSize(const char *theText, color textColor, color backColor, const char *name, int32_t size, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectWithFontNamed(const char *theText, color textColor, color backColor, const char *name, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesInRectWithFontNamedAndSize(const char *theText, color textColor, color backColor, const char *name, int32_t size, font_alignment align, const rectangle *withinRect)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesOnBitmap(bitmap dest, const char *theText, color textColor, color backColor, font theFont, font_alignment align, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesOnBitmapWithFontNamed(bitmap dest, const char *theText, color textColor, color backColor, const char *name, font_alignment align, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesOnBitmapWithFontNamedAndSize(bitmap dest, const char *theText, color textColor, color backColor, const char *name, int32_t size, font_alignment align, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesOnScreen(const char *theText, color textColor, color backColor, font theFont, font_alignment align, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesOnScreenWithFontNamed(const char *theText, color textColor, color backColor, const char *name, font_alignment align, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesOnScreenWithFontNamedWithSize(const char *theText, color textColor, color backColor, const char *name, int32_t size, font_alignment align, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesWithFontNamed(const char *theText, color textColor, color backColor, const char *name, font_alignment align, float x, float y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextLinesWithFontNamedAndSize(const char *theText, color textColor, color backColor, const char *name, int32_t size, font_alignment align, float x, float y, int32_t w, int32_t h)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnBitmapAtPointWithFontNamed(bitmap dest, const char *theText, color textColor, const char *name, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnBitmapAtPointWithFontNamedAndSize(bitmap dest, const char *theText, color textColor, const char *name, int32_t size, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnBitmapWithFontNamed(bitmap dest, const char *theText, color textColor, const char *name, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnBitmapWithFontNamedAndSize(bitmap dest, const char *theText, color textColor, const char *name, int32_t size, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnScreenAtPointWithFontNamed(const char *theText, color textColor, const char *name, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnScreenAtPointWithFontNamedAndSize(const char *theText, color textColor, const char *name, int32_t size, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnScreenWithFontNamed(const char *theText, color textColor, const char *name, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextOnScreenWithFontNamedAndSize(const char *theText, color textColor, const char *name, int32_t size, int32_t x, int32_t y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextWithFontNamed(const char *theText, color textColor, const char *name, float x, float y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_Text_DrawTextWithFontNamedSize(const char *theText, color textColor, const char *name, int32_t size, float x, float y)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+font_alignment sg_Text_TextAlignmentFrom(const char *str)
+{
+    SGH_UNIMPLEMENTED();
+    font_alignment result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_ActivatePanel(panel p)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+region sg_UserInterface_ActiveRadioButton(guiradio_group grp)
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ActiveRadioButtonIndex(guiradio_group RadioGroup)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ActiveRadioButtonIndexFromID(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ActiveRadioButtonIndexOnPanel(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+region sg_UserInterface_ActiveRadioButtonOnPanelWithId(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+region sg_UserInterface_ActiveRadioButtonWithID(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+panel sg_UserInterface_ActiveTextBoxParent()
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ActiveTextIndex()
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_AddItemByBitmap(guilist lst, bitmap img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_AddItemByText(guilist lst, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_AddItemOnPanelWithIdByText(panel pnl, const char *id, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_AddItemWithIdByBitmap(const char *id, bitmap img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_AddItemWithIdByText(const char *id, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_UserInterface_ButtonClicked(region r)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_ButtonNamedClicked(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_CheckBoxSetStateWithId(const char *id, bool val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+guicheckbox sg_UserInterface_CheckboxFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    guicheckbox result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_CheckboxSetState(guicheckbox chk, bool val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_CheckboxSetStateFromRegion(region r, bool val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_CheckboxSetStateOnPanel(panel pnl, const char *id, bool val)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_UserInterface_CheckboxState(const char *s)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_CheckboxStateFromCheckbox(guicheckbox chk)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_CheckboxStateFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_CheckboxStateOnPanel(panel p, const char *s)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_DeactivatePanel(panel p)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_DeactivateTextBox()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_UserInterface_DialogCancelled()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_DialogComplete()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_DialogPath(char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_DialogSetPath(const char *fullname)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_DrawGUIAsVectors(bool b)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_DrawInterface()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_FinishReadingText()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_FreePanel(panel *pnl)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_UserInterface_GUIClicked()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_GUISetActiveTextbox(guitextbox t)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_GUISetActiveTextboxFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_GUISetActiveTextboxNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_GUISetBackgroundColor(color c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_GUISetBackgroundColorInactive(color c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_GUISetForegroundColor(color c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_GUISetForegroundColorInactive(color c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+guitextbox sg_UserInterface_GUITextBoxOfTextEntered()
+{
+    SGH_UNIMPLEMENTED();
+    guitextbox result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_GUITextEntryComplete()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+region sg_UserInterface_GlobalRegionWithID(const char *ID)
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_HasPanel(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_HidePanel(panel p)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_HidePanelNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_IndexOfLastUpdatedTextBox()
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_IsDragging()
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font_alignment sg_UserInterface_LabelAlignementFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    font_alignment result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font_alignment sg_UserInterface_LabelAlignment(guilabel lbl)
+{
+    SGH_UNIMPLEMENTED();
+    font_alignment result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font sg_UserInterface_LabelFont(guilabel l)
+{
+    SGH_UNIMPLEMENTED();
+    font result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+guilabel sg_UserInterface_LabelFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    guilabel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font sg_UserInterface_LabelFromRegionGetFont(region r)
+{
+    SGH_UNIMPLEMENTED();
+    font result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_LabelFromRegionSetText(region r, const char *newString)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelOnPanelWithIdSetText(panel pnl, const char *id, const char *newString)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelSetFont(guilabel l, const char *s)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelSetText(guilabel lb, const char *newString)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelText(guilabel lb, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelTextFromRegion(region r, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelTextOnPanelWithId(panel pnl, const char *id, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelTextWithId(const char *id, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_LabelWithIdSetText(const char *id, const char *newString)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_ListActiveItemIndex(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListActiveItemIndexFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListActiveItemIndexOnPanelWithId(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListActiveItemIndexWithId(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_ListActiveItemText(guilist list, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListActiveItemTextFromRegion(region r, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListActiveItemTextOnPanelWithId(panel pnl, const char *ID, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddBitmapAndTextItem(guilist lst, bitmap img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddBitmapAndTextItemFromRegion(region r, bitmap img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddItemBitmap(panel pnl, const char *id, bitmap img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddItemByBitmapFromRegion(region r, bitmap img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddItemByTextFromRegion(region r, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddItemWithCell(guilist lst, const bitmap_cell *img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddItemWithCellAndText(guilist lst, const bitmap_cell *img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddItemWithCellAndTextFromRegion(region r, const bitmap_cell *img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListAddItemWithCellFromRegion(region r, const bitmap_cell *img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_ListBitmapCellIndex(guilist lst, const bitmap_cell *img)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListBitmapIndex(guilist lst, bitmap img)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_ListClearItems(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListClearItemsFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListClearItemsGivenPanelWithId(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+font sg_UserInterface_ListFont(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+    font result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font_alignment sg_UserInterface_ListFontAlignment(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+    font_alignment result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font_alignment sg_UserInterface_ListFontAlignmentFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    font_alignment result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font sg_UserInterface_ListFontFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    font result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+guilist sg_UserInterface_ListFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    guilist result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListItemCount(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListItemCountFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListItemCountOnPanelWithId(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListItemCountWithId(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_ListItemText(guilist lst, int32_t idx, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListItemTextFromId(const char *id, int32_t idx, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListItemTextFromRegion(region r, int32_t idx, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListItemTextOnPanelWithId(panel pnl, const char *id, int32_t idx, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_ListLargestStartIndex(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_ListOnPanelWithIdAddBitmapWithTextItem(panel pnl, const char *id, bitmap img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListOnPanelWithIdAddItemWithCell(panel pnl, const char *id, const bitmap_cell *img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListOnPanelWithIdAddItemWithCellAndText(panel pnl, const char *id, const bitmap_cell *img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListRemoveActiveItemFromId(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListRemoveActiveItemFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListRemoveActiveItemOnPanelWithId(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListRemoveItem(guilist lst, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListRemoveItemFromWithId(const char *id, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListRemoveItemOnPanelWithId(panel pnl, const char *id, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_ListScrollIncrement(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_ListSet(panel pnl, const char *id, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListSetActiveItemIndex(guilist lst, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListSetActiveItemIndexWithId(const char *id, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListSetFont(guilist lst, font f)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListSetFontAlignment(guilist lst, font_alignment align)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListSetFontAlignmentFromRegion(region r, font_alignment align)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListSetStartingAt(guilist lst, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListSetStartingAtFromRegion(region r, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_ListStartAt(guilist lst)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListStartingAtFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_ListTextIndex(guilist lst, const char *value)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_ListWithIDAddBitmapWithTextItem(const char *id, bitmap img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListWithIdActiveItemText(const char *ID, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListWithIdAddItemWithCell(const char *id, const bitmap_cell *img)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListWithIdAddItemWithCellAndText(const char *id, const bitmap_cell *img, const char *text)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ListclearItemsWithId(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+panel sg_UserInterface_LoadPanel(const char *filename)
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+panel sg_UserInterface_LoadPanelNamed(const char *name, const char *filename)
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_MovePanel(panel p, const vector *mvmt)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+panel sg_UserInterface_NewPanel(const char *pnlName)
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_PanelActive(panel pnl)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+panel sg_UserInterface_PanelAtPoint(const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+panel sg_UserInterface_PanelClicked()
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_PanelDraggable(panel p)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_PanelFilename(panel pnl, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_PanelHeight(panel p)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_PanelIsDragging(panel pnl)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_PanelName(panel pnl, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+panel sg_UserInterface_PanelNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_PanelNamedHeight(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_PanelNamedWidth(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_PanelSetDraggable(panel p, bool b)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+bool sg_UserInterface_PanelVisible(panel p)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_PanelWasClicked(panel pnl)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_PanelWidth(panel p)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_UserInterface_PanelX(panel p)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_UserInterface_PanelY(panel p)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_PointInRegion(const point2d *pt, panel p)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_PointInRegionWithKind(const point2d *pt, panel p, guielement_kind kind)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+guiradio_group sg_UserInterface_RadioGroupFromId(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    guiradio_group result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+guiradio_group sg_UserInterface_RadioGroupFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    guiradio_group result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+guiradio_group sg_UserInterface_RadioGroupOnPanelWidthId(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    guiradio_group result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+bool sg_UserInterface_RegionActive(region forRegion)
+{
+    SGH_UNIMPLEMENTED();
+    bool result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+region sg_UserInterface_RegionAtPoint(panel p, const point2d *pt)
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+region sg_UserInterface_RegionClicked()
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_RegionClickedID(char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+int32_t sg_UserInterface_RegionHeight(region r)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_RegionID(region r, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+region sg_UserInterface_RegionOfLastUpdatedTextBox()
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+panel sg_UserInterface_RegionPanel(region r)
+{
+    SGH_UNIMPLEMENTED();
+    panel result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+int32_t sg_UserInterface_RegionWidth(region r)
+{
+    SGH_UNIMPLEMENTED();
+    int32_t result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+region sg_UserInterface_RegionWithID(panel pnl, const char *ID)
+{
+    SGH_UNIMPLEMENTED();
+    region result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_UserInterface_RegionX(region r)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+float sg_UserInterface_RegionY(region r)
+{
+    SGH_UNIMPLEMENTED();
+    float result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_RegisterEventCallback(region r, guievent_callback callback)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ReleaseAllPanels()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ReleasePanel(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SelectRadioButton(region r)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SelectRadioButtonFromRadioGroupAndIndex(guiradio_group rGroup, int32_t idx)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SelectRadioButtonFromRadioGroupAndRegion(guiradio_group rGroup, region r)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SelectRadioButtonOnPanelWithId(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SelectRadioButtonWithID(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SetLabelAlignment(guilabel tb, font_alignment align)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SetLabelAlignmentFromRegion(region r, font_alignment align)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_SetRegionActive(region forRegion, bool b)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ShowOpenDialog()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ShowOpenDialogWithType(file_dialog_select_type select)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ShowPanel(panel p)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ShowPanelDialog(panel p)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ShowPanelNamed(const char *name)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ShowSaveDialog()
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ShowSaveDialogWithType(file_dialog_select_type select)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+font_alignment sg_UserInterface_TextBoxAlignmentFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    font_alignment result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font sg_UserInterface_TextBoxFont(guitextbox tb)
+{
+    SGH_UNIMPLEMENTED();
+    font result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+font sg_UserInterface_TextBoxFontFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    font result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+guitextbox sg_UserInterface_TextBoxFromID(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+    guitextbox result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_TextBoxSetAlignmentFromRegion(region r, font_alignment align)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextBoxText(guitextbox tb, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+font_alignment sg_UserInterface_TextboxAlignment(guitextbox tb)
+{
+    SGH_UNIMPLEMENTED();
+    font_alignment result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+guitextbox sg_UserInterface_TextboxFromRegion(region r)
+{
+    SGH_UNIMPLEMENTED();
+    guitextbox result;
+    memset(&result, 0, sizeof(result));
+    return result;
+}
+
+void sg_UserInterface_TextboxSetAlignment(guitextbox tb, font_alignment align)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetFont(guitextbox Tb, font f)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetText(guitextbox tb, const char *s)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextFromId(const char *id, const char *s)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextFromRegion(region r, const char *s)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextOnPanelAndId(panel pnl, const char *id, const char *s)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToInt(guitextbox tb, int32_t i)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToIntFromRegion(region r, int32_t i)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToIntOnPanelWithId(panel pnl, const char *id, int32_t i)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToIntWithId(const char *id, int32_t i)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToSingle(guitextbox tb, float single)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToSingleFromId(const char *id, float single)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToSingleFromRegion(region r, float single)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxSetTextToSingleOnPanel(panel pnl, const char *id, float single)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxTextFromRegion(region r, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxTextOnPanelWithId(panel pnl, const char *id, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_TextboxTextWithId(const char *id, char *result)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ToggleActivatePanel(panel p)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ToggleCheckboxState(guicheckbox c)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ToggleCheckboxStateFromID(const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ToggleCheckboxStateOnPanel(panel pnl, const char *id)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ToggleRegionActive(region forRegion)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_ToggleShowPanel(panel p)
+{
+    SGH_UNIMPLEMENTED();
+}
+
+void sg_UserInterface_UpdateInterface()
+{
+    SGH_UNIMPLEMENTED();
+}
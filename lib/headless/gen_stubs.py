@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+#
+# gen_stubs.py
+#
+# Writes SGHeadlessStubs.c: a definition for every sg_* prototype in
+# lib/SGSDK.h that the other lib/headless/*.c units do not implement, so
+# the complete C wrapper library links against the headless backend.
+# Each stub logs on its first call and returns a zeroed result.
+#
+# Usage: python3 lib/headless/gen_stubs.py   (or `make stubs`)
+#
+
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SDK_HEADER = os.path.join(HERE, '..', 'SGSDK.h')
+OUTPUT = 'SGHeadlessStubs.c'
+
+PROTOTYPE = re.compile(r'^(.+?)\s*\b(sg_\w+)\((.*)\);$')
+DEFINITION = re.compile(r'^[A-Za-z].*?\b(sg_\w+)\(.*\)\s*(\{.*)?$')
+
+
+def implemented_names():
+    names = set()
+    for filename in os.listdir(HERE):
+        if not filename.endswith('.c') or filename == OUTPUT:
+            continue
+        with open(os.path.join(HERE, filename)) as source:
+            for line in source:
+                match = DEFINITION.match(line.rstrip())
+                if match:
+                    names.add(match.group(1))
+    return names
+
+
+def stub(ret, name, params):
+    ret = ret.strip()
+    lines = ['%s %s(%s)' % (ret, name, params), '{', '    SGH_UNIMPLEMENTED();']
+    if ret != 'void':
+        lines += ['    %s result;' % ret,
+                  '    memset(&result, 0, sizeof(result));',
+                  '    return result;']
+    lines += ['}', '']
+    return '\n'.join(lines)
+
+
+def main():
+    done = implemented_names()
+    stubs = []
+    with open(SDK_HEADER) as header:
+        for line in header:
+            match = PROTOTYPE.match(line.strip())
+            if match and match.group(2) not in done:
+                stubs.append(stub(*match.groups()))
+
+    with open(os.path.join(HERE, OUTPUT), 'w') as out:
+        out.write('/*\n'
+                  '* Generated by gen_stubs.py - DO NOT EDIT!\n'
+                  '*\n'
+                  '* Headless SGSDK entry points with no implementation yet\n'
+                  '*\n'
+                  '* Stubbing SGSDK.h\n'
+                  '*/\n\n'
+                  '#include <string.h>\n\n'
+                  '#include "SGHeadlessPrivate.h"\n\n')
+        out.write('\n'.join(stubs))
+
+    print('%s: %d stubs' % (OUTPUT, len(stubs)))
+
+
+if __name__ == '__main__':
+    main()
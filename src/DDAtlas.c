@@ -0,0 +1,161 @@
+/**
+ * @file    DDAtlas.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the packing of images into atlas sheets and the
+ *          flushing of batched draws from them.
+ */
+
+#include "DDAtlas.h"
+
+#include <stddef.h>
+
+#include "Geometry.h"
+#include "Images.h"
+
+/**
+ * @brief   Starts a new, transparent sheet with an empty first shelf
+ * @return  Non-zero if a sheet was started, or zero if the atlas
+ *          already has as many sheets as it can
+ */
+static int dd_atlas_new_sheet(DDAtlas *atlas)
+{
+    if (atlas->sheetCount == DD_ATLAS_MAX_SHEETS) { return 0; }
+
+    atlas->sheets[atlas->sheetCount++]  = create_bitmap(DD_ATLAS_SHEET_SIZE, DD_ATLAS_SHEET_SIZE);
+    atlas->shelfX                       = 0;
+    atlas->shelfY                       = 0;
+    atlas->shelfHeight                  = 0;
+    return 1;
+}
+
+/**
+ * @brief   Resets an atlas to having no sheets
+ * @param   atlas
+ *          The atlas to reset
+ */
+void dd_atlas_init(DDAtlas *atlas)
+{
+    atlas->sheetCount   = 0;
+    atlas->shelfX       = 0;
+    atlas->shelfY       = 0;
+    atlas->shelfHeight  = 0;
+}
+
+/**
+ * @brief   Packs images into the atlas, tallest first, along shelves
+ *          that fill each sheet from the top, starting another sheet
+ *          when one runs out of room. Each image is copied onto its
+ *          sheet; the images themselves are left untouched.
+ * @param   atlas
+ *          The atlas to pack into (images already in it stay put)
+ * @param   images
+ *          The images to pack (at most DD_ATLAS_MAX_IMAGES)
+ * @param   count
+ *          The number of images
+ * @param   regions
+ *          Where each image was packed, in the order of images; images
+ *          bigger than a sheet, or beyond a full atlas, get no sheet
+ * @return  The number of images packed
+ */
+int dd_atlas_pack(DDAtlas *atlas, const bitmap *images, int count, DDAtlasRegion *regions)
+{
+    int order[DD_ATLAS_MAX_IMAGES];
+    int packed = 0;
+
+    if (count > DD_ATLAS_MAX_IMAGES) { count = DD_ATLAS_MAX_IMAGES; }
+
+    // Tallest first (insertion sort; there are only a handful), so each
+    // shelf is as tall as its first image and wastes little beneath the rest
+    for (int i = 0; i < count; i++)
+    {
+        int j = i;
+        while (j > 0 && bitmap_height(images[order[j - 1]]) < bitmap_height(images[i]))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        bitmap image    = images[order[i]];
+        int w           = bitmap_width(image)  + DD_ATLAS_PADDING;
+        int h           = bitmap_height(image) + DD_ATLAS_PADDING;
+
+        regions[order[i]].sheet = NULL;
+        if (w > DD_ATLAS_SHEET_SIZE || h > DD_ATLAS_SHEET_SIZE) { continue; }
+
+        // No room left along this shelf? Start the next one down
+        if (atlas->sheetCount && atlas->shelfX + w > DD_ATLAS_SHEET_SIZE)
+        {
+            atlas->shelfY      += atlas->shelfHeight;
+            atlas->shelfX       = 0;
+            atlas->shelfHeight  = 0;
+        }
+        // No room for that shelf? Start another sheet
+        if (!atlas->sheetCount || atlas->shelfY + h > DD_ATLAS_SHEET_SIZE)
+        {
+            if (!dd_atlas_new_sheet(atlas)) { continue; }
+        }
+
+        bitmap sheet = atlas->sheets[atlas->sheetCount - 1];
+        draw_bitmap_onto(sheet, image, atlas->shelfX, atlas->shelfY);
+        regions[order[i]].sheet     = sheet;
+        regions[order[i]].source    = rectangle_from(atlas->shelfX, atlas->shelfY,
+                                                     bitmap_width(image), bitmap_height(image));
+
+        atlas->shelfX += w;
+        if (h > atlas->shelfHeight) { atlas->shelfHeight = h; }
+        packed++;
+    }
+    return packed;
+}
+
+/**
+ * @brief   Frees every sheet of an atlas, leaving it empty; regions
+ *          packed into it must no longer be drawn
+ * @param   atlas
+ *          The atlas to free
+ */
+void dd_atlas_free(DDAtlas *atlas)
+{
+    for (int i = 0; i < atlas->sheetCount; i++) { free_bitmap(&atlas->sheets[i]); }
+    dd_atlas_init(atlas);
+}
+
+/**
+ * @brief   Empties a batch and zeroes its counters
+ * @param   batch
+ *          The batch to reset
+ */
+void dd_batch_init(DDBatch *batch)
+{
+    batch->sheet    = NULL;
+    batch->count    = 0;
+    batch->draws    = 0;
+    batch->flushes  = 0;
+}
+
+/**
+ * @brief   Draws everything gathered in a batch onto the screen, in
+ *          the order it was added, and empties the batch. SwinGame has
+ *          no call taking many parts of a bitmap at once, so this is a
+ *          tight loop of plain blits from the one sheet.
+ * @param   batch
+ *          The batch to flush
+ */
+void dd_batch_flush(DDBatch *batch)
+{
+    if (!batch->count) { return; }
+
+    bitmap sheet = batch->sheet;
+    for (int i = 0; i < batch->count; i++)
+    {
+        draw_bitmap_part_from_rect_on_screen(sheet, &batch->sources[i], batch->x[i], batch->y[i]);
+    }
+    batch->draws   += batch->count;
+    batch->flushes++;
+    batch->count    = 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file    DDAtlas.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the texture atlas the sprites' images are packed
+ *          into at startup, and the batch their draws are gathered in
+ *          so that runs of sprites on the same sheet go to SwinGame as
+ *          plain C blits, back to back, from the one source bitmap.
+ */
+
+#ifndef DDAtlas_h
+#define DDAtlas_h
+
+// Import SwinGame types (for bitmap and rectangle)
+#include "Types.h"
+
+/**
+ * @brief   Width and height of each atlas sheet
+ */
+#define DD_ATLAS_SHEET_SIZE     512
+
+/**
+ * @brief   Maximum number of sheets in an atlas
+ */
+#define DD_ATLAS_MAX_SHEETS     4
+
+/**
+ * @brief   Maximum number of images packed in one call to dd_atlas_pack
+ */
+#define DD_ATLAS_MAX_IMAGES     64
+
+/**
+ * @brief   Transparent pixels left between packed images, so that
+ *          filtering never bleeds one image into the next
+ */
+#define DD_ATLAS_PADDING        1
+
+/**
+ * @brief   Maximum number of draws a batch gathers before it flushes
+ */
+#define DD_BATCH_CAPACITY       256
+
+/**
+ * @struct  DDAtlasRegion
+ * @brief   Where an image was packed; a NULL sheet means the image
+ *          was not packed (too big, or the atlas was full) and is to
+ *          be drawn from its own bitmap
+ */
+typedef struct DDAtlasRegion
+{
+    bitmap      sheet;      //!< The sheet the image is on, or NULL
+    rectangle   source;     //!< The image's part of the sheet
+} DDAtlasRegion;
+
+/**
+ * @struct  DDAtlas
+ * @brief   The sheets images are packed into, shelf by shelf; set it
+ *          up with dd_atlas_init
+ */
+typedef struct DDAtlas
+{
+    bitmap      sheets[DD_ATLAS_MAX_SHEETS];    //!< Sheets created so far
+    int         sheetCount;                     //!< Number of sheets created
+    int         shelfX;                         //!< Where the next image goes along the shelf
+    int         shelfY;                         //!< Top of the current shelf on the last sheet
+    int         shelfHeight;                    //!< Height of the current shelf
+} DDAtlas;
+
+/**
+ * @struct  DDBatch
+ * @brief   Draws gathered from one sheet, in order, awaiting a flush
+ */
+typedef struct DDBatch
+{
+    bitmap      sheet;                          //!< The sheet every gathered draw is from
+    int         count;                          //!< Number of gathered draws
+    rectangle   sources[DD_BATCH_CAPACITY];     //!< Part of the sheet each draw copies
+    int32_t     x[DD_BATCH_CAPACITY];           //!< Where each draw goes along the x axis
+    int32_t     y[DD_BATCH_CAPACITY];           //!< Where each draw goes along the y axis
+    long        draws;                          //!< Draws flushed so far, for profiling
+    long        flushes;                        //!< Non-empty flushes so far, for profiling
+} DDBatch;
+
+void    dd_atlas_init(DDAtlas *atlas);
+int     dd_atlas_pack(DDAtlas *atlas, const bitmap *images, int count, DDAtlasRegion *regions);
+void    dd_atlas_free(DDAtlas *atlas);
+
+void    dd_batch_init(DDBatch *batch);
+void    dd_batch_flush(DDBatch *batch);
+
+/**
+ * @brief   Gathers a draw of part of a sheet onto the screen, first
+ *          flushing what was gathered if it is from another sheet (so
+ *          draws still land in the order they were added) or if the
+ *          batch is full
+ * @param   batch
+ *          The batch
+ * @param   region
+ *          The packed image to draw
+ * @param   x
+ *          Where to draw it along the x axis
+ * @param   y
+ *          Where to draw it along the y axis
+ */
+static inline void dd_batch_add(DDBatch *batch, const DDAtlasRegion *region, float x, float y)
+{
+    if (batch->count == DD_BATCH_CAPACITY || (batch->count && batch->sheet != region->sheet))
+    {
+        dd_batch_flush(batch);
+    }
+    batch->sheet                    = region->sheet;
+    batch->sources[batch->count]    = region->source;
+    batch->x[batch->count]          = (int32_t)x;
+    batch->y[batch->count]          = (int32_t)y;
+    batch->count++;
+}
+
+#endif
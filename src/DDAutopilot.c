@@ -0,0 +1,106 @@
+/**
+ * @file    DDAutopilot.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the autopilot's lookahead.
+ */
+
+#include "DDAutopilot.h"
+
+#include <math.h>
+
+/**
+ * @brief   Number of plans weighed each tick
+ */
+#define DD_AUTOPILOT_PLANS      11
+
+/**
+ * @brief   The plans weighed: which way each moves first (-1 left,
+ *          0 stay, 1 right), and for how many ticks before staying
+ */
+static const int dd_plan_step[DD_AUTOPILOT_PLANS]   = { 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1 };
+static const int dd_plan_ticks[DD_AUTOPILOT_PLANS]  = { 0, 60, 60, 30, 30, 15, 15, 8, 8, 4, 4 };
+
+/**
+ * @brief   Wraps a distance along the x axis into half a screen either
+ *          way, as the balloon shows on both sides while crossing an edge
+ */
+static inline float dd_autopilot_wrap(float dx, float width)
+{
+    dx = fmodf(dx + width / 2, width);
+    if (dx < 0) { dx += width; }
+    return dx - width / 2;
+}
+
+/**
+ * @brief   Plays a plan forward
+ * @return  The first tick a dart reaches the balloon on, or one past
+ *          the horizon if none does
+ */
+static int dd_autopilot_play(const DDAutopilotView *view, int plan)
+{
+    float apexX     = view->balloon.points[1].x;
+    float apexY     = view->balloon.points[1].y;
+    float baseY     = view->balloon.points[0].y;
+    float halfWidth = (view->balloon.points[2].x - view->balloon.points[0].x) / 2;
+    float slope     = (baseY - apexY) / halfWidth;
+    float speed     = view->speed;
+    float width     = (float)view->screenWidth;
+    float centre    = apexX;
+
+    for (int tick = 1; tick <= DD_AUTOPILOT_HORIZON; tick++)
+    {
+        if (tick <= dd_plan_ticks[plan]) { centre += dd_plan_step[plan] * speed; }
+        float fallen = speed * tick;
+
+        for (int i = 0; i < view->dartCount; i++)
+        {
+            float y = view->darts[i].y + fallen;
+            if (y < apexY || y - speed > baseY) { continue; }
+
+            // Within the triangle's width, and between its edge and base
+            // at some point during this tick's fall?
+            float d = fabsf(dd_autopilot_wrap(view->darts[i].x - centre, width));
+            if (d < halfWidth && y >= apexY + slope * d) { return tick; }
+        }
+    }
+    return DD_AUTOPILOT_HORIZON + 1;
+}
+
+/**
+ * @brief   Picks which way to steer the balloon this tick
+ * @param   view
+ *          What the autopilot sees of the game
+ * @param   previous
+ *          Which way it steered last tick (-1 left, 0 stay, 1 right);
+ *          among equally safe plans it keeps going that way, so the
+ *          balloon doesn't dither
+ * @return  -1 to steer left, 1 to steer right, 0 to stay put
+ */
+int dd_autopilot_steer(const DDAutopilotView *view, int previous)
+{
+    // Darts only fall towards the balloon while it's alive
+    if (view->speed <= 0) { return 0; }
+
+    int best = 0, bestTicks = -1;
+    for (int plan = 0; plan < DD_AUTOPILOT_PLANS; plan++)
+    {
+        int ticks = dd_autopilot_play(view, plan);
+        if (ticks > bestTicks ||
+            (ticks == bestTicks && dd_plan_step[plan] == previous && dd_plan_step[best] != previous))
+        {
+            best        = plan;
+            bestTicks   = ticks;
+        }
+    }
+
+    // Nothing in the way? Then go for the health kit, if that's safe too
+    if (bestTicks > DD_AUTOPILOT_HORIZON && view->hasHealth)
+    {
+        float dx = dd_autopilot_wrap(view->healthX - view->balloon.points[1].x,
+                                     (float)view->screenWidth);
+        int towards = dx < -view->speed ? 3 : dx > view->speed ? 4 : 0;   // For 30 ticks
+        if (dd_autopilot_play(view, towards) > DD_AUTOPILOT_HORIZON) { best = towards; }
+    }
+    return dd_plan_step[best];
+}
@@ -0,0 +1,50 @@
+/**
+ * @file    DDAutopilot.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the autopilot, a bot that steers the balloon in
+ *          place of the player: each tick it plays a few short plans
+ *          (stay, hold left or right, or move for a while then stay)
+ *          forward against the darts in view and takes the first step
+ *          of whichever plan hits a dart latest, or never.
+ * @note    Darts fall straight down at the game's speed and the balloon
+ *          moves at it too, so a plan is played out with no more than
+ *          a subtraction and a comparison per dart per tick.
+ */
+
+#ifndef DDAutopilot_h
+#define DDAutopilot_h
+
+// Import SwinGame types (for triangle and point2d)
+#include "Types.h"
+
+/**
+ * @brief   Most darts the autopilot looks at
+ */
+#define DD_AUTOPILOT_MAX_DARTS  64
+
+/**
+ * @brief   Number of ticks each plan is played out for
+ */
+#define DD_AUTOPILOT_HORIZON    60
+
+/**
+ * @struct  DDAutopilotView
+ * @brief   What the autopilot sees of a game on a tick
+ */
+typedef struct DDAutopilotView
+{
+    triangle    balloon;        //!< The balloon's outer collision triangle (left of the
+                                //!< base, apex, right of the base)
+    float       speed;          //!< Distance darts fall, and the balloon moves, a tick
+    int         screenWidth;    //!< Width of the screen, which the balloon wraps around
+    int         hasHealth;      //!< Whether a health kit is falling
+    float       healthX;        //!< Where the health kit is along the x axis
+    int         dartCount;      //!< Number of darts in view
+    point2d     darts[DD_AUTOPILOT_MAX_DARTS];  //!< Bottom centre of each dart (the point
+                                                //!< tested against the balloon)
+} DDAutopilotView;
+
+int     dd_autopilot_steer(const DDAutopilotView *view, int previous);
+
+#endif
@@ -88,6 +88,11 @@
                                                                 //!< DDCollidable sprites
                                                                 //!< since it allows access
                                                                 //!< to both collision masks
+@property   (readonly)  DDBalloon*          duplicate;          //!< Allows readonly access to
+                                                                //!< the duplicate balloon (or
+                                                                //!< nil) so that DDGame can
+                                                                //!< find darts near it in its
+                                                                //!< collision broad phase
 
 // Declare methods
 -(id)   initInGame:(DDGame*) game;
@@ -9,6 +9,7 @@
 
 // Import SwinGame Framework
 #import "SwinGame.h"
+#import "GeometryInline.h"
 
 // Import my interface
 #import "DDBalloon.h"
@@ -16,6 +17,7 @@
 // Import interfaces of other classes used
 #import "DDCollisionMask.h"
 #import "DDGame.h"
+#import "DDSoundBank.h"
 
 @implementation DDBalloon
 
@@ -24,6 +26,7 @@
 @synthesize isAlive             = _isAlive;
 @synthesize innerCollisionMask  = _innerCollisionMask;
 @synthesize outerCollisionMask  = _outerCollisionMask;
+@synthesize duplicate           = _duplicate;
 
 /**
  * @brief   The constructor for DDBalloon which intialises
@@ -50,6 +53,17 @@
     return self;
 }
 
+/**
+ * @brief   Releases my collision masks (my duplicate, if I have one,
+ *          belongs to the canvas)
+ */
+-(void) dealloc
+{
+    [_innerCollisionMask release];
+    [_outerCollisionMask release];
+    [super dealloc];
+}
+
 /**
  * @brief   Moves the balloon's position in the given
  *          direction. Does the same with the duplicate
@@ -75,46 +89,40 @@
 {
     int const INNER_SCALE = 17;
     
-    // Temportary point for collision boundary assignment
-    SGPoint2D* ptInnerA = [SGGeometry pointAtX:_position.x + INNER_SCALE
-                                             y:_position.y + _bitmap.height /2           ];
-    SGPoint2D* ptInnerB = [SGGeometry pointAtX:_position.x + _bitmap.width  /2
-                                             y:_position.y + INNER_SCALE * 1.7           ];
-    SGPoint2D* ptInnerC = [SGGeometry pointAtX:_position.x + _bitmap.width - INNER_SCALE
-                                             y:_position.y + _bitmap.height /2           ];
+    // Temportary triangle for collision boundary assignment
+    triangle inner = { {
+        { _position.x + INNER_SCALE,                  _position.y + _bitmap.height /2 },
+        { _position.x + _bitmap.width  /2,            _position.y + INNER_SCALE * 1.7 },
+        { _position.x + _bitmap.width - INNER_SCALE,  _position.y + _bitmap.height /2 }
+    } };
     
     // If the _innerCollisionMask was initialised already?
     if (_innerCollisionMask)
     {
-        [_innerCollisionMask updateWithPoints:@[ptInnerA, ptInnerB, ptInnerC]];
+        [_innerCollisionMask updateWithTriangle:inner];
     // Otherwise initialse it.
     }
     else
     {
-        _innerCollisionMask = [[DDCollisionMask alloc] initAsTriangleAtPointA: ptInnerA
-                                                                       pointB: ptInnerB
-                                                                       pointC: ptInnerC];
+        _innerCollisionMask = [[DDCollisionMask alloc] initAsTriangle:inner];
     }
     
     // Reassignment of points for outer collision boundary assignment
-    SGPoint2D* ptOuterA = [SGGeometry pointAtX:_position.x
-                                             y:_position.y + _bitmap.height /2 ];
-    SGPoint2D* ptOuterB = [SGGeometry pointAtX:_position.x + _bitmap.width  /2
-                                             y:_position.y                     ];
-    SGPoint2D* ptOuterC = [SGGeometry pointAtX:_position.x + _bitmap.width
-                                             y:_position.y + _bitmap.height /2 ];
+    triangle outer = { {
+        { _position.x,                                _position.y + _bitmap.height /2 },
+        { _position.x + _bitmap.width  /2,            _position.y                     },
+        { _position.x + _bitmap.width,                _position.y + _bitmap.height /2 }
+    } };
     
     // If the _innerCollisionMask was initialised already?
     if (_outerCollisionMask)
     {
-        [_outerCollisionMask updateWithPoints:@[ptOuterA, ptOuterB, ptOuterC]];
+        [_outerCollisionMask updateWithTriangle:outer];
     // Otherwise initialse it.
     }
     else
     {
-         _outerCollisionMask    = [[DDCollisionMask alloc] initAsTriangleAtPointA:ptOuterA
-                                                                           pointB:ptOuterB
-                                                                           pointC:ptOuterC];
+         _outerCollisionMask    = [[DDCollisionMask alloc] initAsTriangle:outer];
     }
 }
 
@@ -150,11 +158,11 @@
             
             // Replace my inner coll. bound with the duplicate's
             [_innerCollisionMask
-             updateWithPoints:_duplicate.innerCollisionMask.points];
+             updateWithTriangle:*_duplicate.innerCollisionMask.tri];
 
             // Replace my inner coll. bound with the duplicate's
             [_outerCollisionMask
-             updateWithPoints:_duplicate.outerCollisionMask.points];
+             updateWithTriangle:*_duplicate.outerCollisionMask.tri];
             
             // Kill the duplicate
             [_duplicate kill];
@@ -184,11 +192,11 @@
              // Replace my inner coll. bound with the duplicate's
             
             [_innerCollisionMask
-             updateWithPoints:_duplicate.innerCollisionMask.points];
+             updateWithTriangle:*_duplicate.innerCollisionMask.tri];
             
              // Replace my inner coll. bound with the duplicate's
             [_outerCollisionMask
-            updateWithPoints:_duplicate.outerCollisionMask.points];
+            updateWithTriangle:*_duplicate.outerCollisionMask.tri];
 
             // Kill the duplicate
             [_duplicate kill];
@@ -197,11 +205,11 @@
     }
     
     // If the balloon is definately in the centre
-    if ([SGGeometry point:[self centre]
-                  inRectX:_bitmap.width
-                        y:0
-                    width:[SGGraphics screenWidth] - 2 * _bitmap.width
-                   height:[SGGraphics screenHeight]]
+    if ([SGGeometry pointData:[self centrePoint]
+                      inRectX:_bitmap.width
+                            y:0
+                        width:[SGGraphics screenWidth] - 2 * _bitmap.width
+                       height:[SGGraphics screenHeight]]
         )
     {
         // Then obviously no duplicates allowed! the duplicate
@@ -253,7 +261,8 @@
                                               atSpeed:[SGGraphics screenWidth]/2
                                                        + _bitmap.width  /2];
     }
-    return duplicate;
+    // The canvas keeps it until it is killed
+    return [duplicate autorelease];
 }
 
 /**
@@ -279,11 +288,10 @@
 {
     // Get the collision point of the other shape
     // Note we cast as a rectangle since only balloon use triangles
-    SGPoint2D* collisionPoint = [SGGeometry rectangleCenterBottom:
-                                 (SGRectangle*)[sprite getCollisionMask].shape];
+    point2d collisionPoint = rectangle_center_bottom_inline([sprite getCollisionMask].rect);
     
     // Inner collision?
-    if ([SGGeometry point:collisionPoint inTriangle:_innerCollisionMask.shape])
+    if (point_in_triangle_inline(&collisionPoint, _innerCollisionMask.tri))
     {
         [self burst];           // burst balloon
         
@@ -293,7 +301,7 @@
         return YES;
     } else
     // Outer collision?
-    if ([SGGeometry point:collisionPoint inTriangle:_outerCollisionMask.shape])
+    if (point_in_triangle_inline(&collisionPoint, _outerCollisionMask.tri))
     {
         [self jiggle]; // just jiggle
         return YES;
@@ -320,10 +328,10 @@
  */
 -(void) jiggle
 {
-    if (round([SGUtils rnd]) == 0) { _position.x += [SGUtils rndUpto:_speed*1.5]; }
-    else                           { _position.x -= [SGUtils rndUpto:_speed*1.5]; }
+    if (dd_random_float(_game.rng) < 0.5f) { _position.x += dd_random_upto(_game.rng, _speed*1.5); }
+    else                                   { _position.x -= dd_random_upto(_game.rng, _speed*1.5); }
     [self updateMaskPosition];
-    [SGAudio playSoundEffect:[[SGSoundEffect alloc] initFromFile:@"slidepast-1.ogg"]];
+    [DDSoundBank play:DDSOUND_SLIDEPAST];
 
 }
 
@@ -336,7 +344,7 @@
     _health--;
     if (_health < 1)
     { _isAlive = NO; _health = 0; }
-    [SGAudio playSoundEffect:[[SGSoundEffect alloc] initFromFile:@"loselife-1.ogg"]];
+    [DDSoundBank play:DDSOUND_LOSELIFE];
 }
 
 /**
@@ -345,10 +353,10 @@
 -(void) oneUp
 {
     _health++;
-    [SGAudio playSoundEffect:[[SGSoundEffect alloc] initFromFile:@"newround.ogg"]];
+    [DDSoundBank play:DDSOUND_NEWROUND];
     if (_health > 0)
     {
-        [SGAudio stopSoundEffectNamed:@"dying"];
+        [DDSoundBank stop:DDSOUND_DYING];
         _isAlive = YES;
     }
     
@@ -0,0 +1,47 @@
+/**
+ * @class   DDBitmapCache
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the process-wide cache of bitmaps shared by every
+ *          sprite drawn with the same image file. Each file is loaded
+ *          once, under its interned name, and counted out to sprites
+ *          so that spawning one never touches the image loader. Once
+ *          loaded, they can be packed into an atlas to be drawn from,
+ *          if the atlas is enabled (it is not by default, as drawing
+ *          each sprite from its own bitmap measures faster).
+ * @note    Names are matched by pointer first, so passing the same
+ *          string literal (or the name returned by internName:) on
+ *          every spawn skips comparing strings altogether.
+ */
+
+#import <Foundation/Foundation.h>
+
+// Import the atlas the cached bitmaps are packed into
+#import "DDAtlas.h"
+
+// Forward reference classes referenced in interface
+@class SGBitmap;
+
+/**
+ * @brief   Maximum number of distinct bitmaps the cache holds
+ */
+#define DD_BITMAP_CACHE_CAPACITY    16
+
+@interface DDBitmapCache : NSObject
+
+// Declare methods
++(NSString*)    internName:(NSString*) name;
++(void)         preloadBitmapsNamed:(NSArray*) names;
++(SGBitmap*)    bitmapNamed:(NSString*) name;
++(void)         releaseBitmap:(SGBitmap*) bitmap;
++(void)         setAtlasEnabled:(BOOL) enabled;
++(BOOL)         atlasEnabled;
++(void)         packAtlas;
++(const DDAtlasRegion*) atlasRegionOfBitmap:(SGBitmap*) bitmap;
++(void)         purge;
++(int)          count;
++(int)          hits;
++(int)          misses;
++(long)         bytes;
+
+@end
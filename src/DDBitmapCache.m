@@ -0,0 +1,310 @@
+/**
+ * @class   DDBitmapCache
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the process-wide cache of bitmaps shared by every
+ *          sprite drawn with the same image file.
+ */
+
+// Import SwinGame Framework
+#import "SwinGame.h"
+
+// Import my interface
+#import "DDBitmapCache.h"
+
+/**
+ * @struct  DDBitmapCacheEntry
+ * @brief   One image file known to the cache
+ */
+typedef struct DDBitmapCacheEntry
+{
+    NSString*   name;       //!< The interned name, which is also the file's name
+    SGBitmap*   bitmap;     //!< The loaded bitmap, or nil if not (or no longer) loaded
+    int         refs;       //!< Number of sprites currently drawing the bitmap
+    long        bytes;      //!< Approximate memory held by the bitmap's pixels
+    DDAtlasRegion region;   //!< Where the bitmap was packed in the atlas, if it was
+} DDBitmapCacheEntry;
+
+/**
+ * @brief   Declare the cache's entries and counters as static
+ *          variables; the cache is shared by the whole process
+ */
+static DDBitmapCacheEntry   _entries[DD_BITMAP_CACHE_CAPACITY];
+static int                  _count  = 0;
+static int                  _hits   = 0;
+static int                  _misses = 0;
+static long                 _bytes  = 0;
+static DDAtlas              _atlas  = { { NULL }, 0, 0, 0, 0 };
+static BOOL                 _atlasEnabled = NO;
+
+@implementation DDBitmapCache
+
+/**
+ * @brief   Finds the entry for a name, adding one if the name
+ *          is new to the cache
+ * @note    This method is private
+ * @param   name
+ *          The image file's name
+ * @return  The entry, or NULL if the cache is full
+ */
++(DDBitmapCacheEntry*) entryNamed:(NSString*) name
+{
+    // Same (interned) string? No need to compare characters
+    for (int i = 0; i < _count; i++)
+    {
+        if (_entries[i].name == name) { return &_entries[i]; }
+    }
+    for (int i = 0; i < _count; i++)
+    {
+        if ([_entries[i].name isEqualToString:name]) { return &_entries[i]; }
+    }
+
+    if (_count == DD_BITMAP_CACHE_CAPACITY)
+    {
+        NSLog(@"Bitmap cache is full; cannot cache %@", name);
+        return NULL;
+    }
+
+    DDBitmapCacheEntry* entry = &_entries[_count++];
+    entry->name     = [name copy];
+    entry->bitmap   = nil;
+    entry->refs     = 0;
+    entry->bytes    = 0;
+    entry->region.sheet = NULL;
+    return entry;
+}
+
+/**
+ * @brief   Loads an entry's bitmap if it is not already loaded
+ * @note    This method is private
+ * @param   entry
+ *          The entry to load
+ * @return  YES if the bitmap had to be loaded
+ */
++(BOOL) loadEntry:(DDBitmapCacheEntry*) entry
+{
+    if (entry->bitmap) { return NO; }
+
+    entry->bitmap   = [[SGBitmap alloc] initWithName:entry->name fromFile:entry->name];
+    entry->bytes    = (long)entry->bitmap.width * entry->bitmap.height * 4;
+    _bytes         += entry->bytes;
+    return YES;
+}
+
+/**
+ * @brief   Interns a name, so that later lookups of the returned
+ *          string match by pointer alone
+ * @param   name
+ *          The image file's name
+ * @return  The cache's own copy of the name (or name itself, if
+ *          the cache is full)
+ */
++(NSString*) internName:(NSString*) name
+{
+    DDBitmapCacheEntry* entry = [self entryNamed:name];
+    return entry ? entry->name : name;
+}
+
+/**
+ * @brief   Loads bitmaps ahead of the sprites that draw them,
+ *          so that creating those sprites is always a hit
+ * @param   names
+ *          The image files' names
+ */
++(void) preloadBitmapsNamed:(NSArray*) names
+{
+    for (NSString* name in names)
+    {
+        DDBitmapCacheEntry* entry = [self entryNamed:name];
+        if (entry) { [self loadEntry:entry]; }
+    }
+}
+
+/**
+ * @brief   Hands out a bitmap to a sprite, loading it on a miss
+ * @param   name
+ *          The image file's name
+ * @return  The bitmap, owned by the cache; hand it back with
+ *          releaseBitmap: once the sprite no longer draws it
+ */
++(SGBitmap*) bitmapNamed:(NSString*) name
+{
+    DDBitmapCacheEntry* entry = [self entryNamed:name];
+
+    // Cache full? Then the sprite gets a bitmap of its own
+    if (!entry)
+    {
+        _misses++;
+        return [[SGBitmap alloc] initWithName:name fromFile:name];
+    }
+
+    if ([self loadEntry:entry]) { _misses++; }
+    else                        { _hits++;   }
+    entry->refs++;
+    return entry->bitmap;
+}
+
+/**
+ * @brief   Takes back a bitmap handed out by bitmapNamed:; it stays
+ *          loaded (until purged) for the next sprite to use
+ * @param   bitmap
+ *          The bitmap
+ */
++(void) releaseBitmap:(SGBitmap*) bitmap
+{
+    for (int i = 0; i < _count; i++)
+    {
+        if (_entries[i].bitmap == bitmap)
+        {
+            if (_entries[i].refs > 0) { _entries[i].refs--; }
+            return;
+        }
+    }
+
+    // Not cached (handed out while the cache was full)
+    [bitmap release];
+}
+
+/**
+ * @brief   Sets whether packAtlas packs the bitmaps; off by default, as
+ *          batched drawing from the atlas measures slower than drawing
+ *          each sprite from its own bitmap (see bench_atlas)
+ * @param   enabled
+ *          Whether to pack; sprites made before the atlas is packed
+ *          keep drawing from their own bitmaps
+ */
++(void) setAtlasEnabled:(BOOL) enabled
+{
+    _atlasEnabled = enabled;
+}
+
+/**
+ * @brief   Gives whether packAtlas packs the bitmaps
+ * @return  YES if the atlas is enabled
+ */
++(BOOL) atlasEnabled
+{
+    return _atlasEnabled;
+}
+
+/**
+ * @brief   Packs every loaded bitmap that fits into the atlas, so
+ *          sprites can draw them from its sheets in batches; does
+ *          nothing unless the atlas is enabled, or once it has been
+ *          packed
+ */
++(void) packAtlas
+{
+    bitmap  images[DD_BITMAP_CACHE_CAPACITY];
+    int     packing[DD_BITMAP_CACHE_CAPACITY];
+    int     count = 0;
+    
+    if (!_atlasEnabled || _atlas.sheetCount) { return; }
+    
+    for (int i = 0; i < _count; i++)
+    {
+        if (_entries[i].bitmap)
+        {
+            images[count]       = _entries[i].bitmap->pointer;
+            packing[count++]    = i;
+        }
+    }
+    
+    DDAtlasRegion regions[DD_BITMAP_CACHE_CAPACITY];
+    dd_atlas_pack(&_atlas, images, count, regions);
+    for (int i = 0; i < count; i++) { _entries[packing[i]].region = regions[i]; }
+}
+
+/**
+ * @brief   Finds where a bitmap handed out by bitmapNamed: was packed
+ * @param   bitmap
+ *          The bitmap
+ * @return  The bitmap's region of the atlas (kept by the cache for as
+ *          long as the bitmap is handed out), or NULL if the bitmap is
+ *          not packed and must be drawn by itself
+ */
++(const DDAtlasRegion*) atlasRegionOfBitmap:(SGBitmap*) bitmap
+{
+    for (int i = 0; i < _count; i++)
+    {
+        if (_entries[i].bitmap == bitmap)
+        {
+            return _entries[i].region.sheet ? &_entries[i].region : NULL;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief   Frees every bitmap no sprite is drawing; their names
+ *          stay interned, and they are loaded again if needed. The
+ *          atlas is freed too once no sprite draws from it.
+ */
++(void) purge
+{
+    BOOL atlasInUse = NO;
+    
+    for (int i = 0; i < _count; i++)
+    {
+        DDBitmapCacheEntry* entry = &_entries[i];
+        if (entry->region.sheet && entry->refs > 0) { atlasInUse = YES; }
+        if (entry->bitmap && entry->refs == 0)
+        {
+            [SGImages freeBitmap:entry->bitmap];
+            [entry->bitmap release];
+            entry->bitmap   = nil;
+            _bytes         -= entry->bytes;
+            entry->bytes    = 0;
+        }
+    }
+    
+    if (!atlasInUse)
+    {
+        for (int i = 0; i < _count; i++) { _entries[i].region.sheet = NULL; }
+        dd_atlas_free(&_atlas);
+    }
+}
+
+/**
+ * @brief   Counts the bitmaps currently loaded
+ * @return  The number of loaded bitmaps
+ */
++(int) count
+{
+    int loaded = 0;
+    for (int i = 0; i < _count; i++)
+    {
+        if (_entries[i].bitmap) { loaded++; }
+    }
+    return loaded;
+}
+
+/**
+ * @brief   Counts the bitmaps handed out that were already loaded
+ * @return  The number of hits
+ */
++(int) hits
+{
+    return _hits;
+}
+
+/**
+ * @brief   Counts the bitmaps handed out that had to be loaded
+ *          first (none, if they were all preloaded)
+ * @return  The number of misses
+ */
++(int) misses
+{
+    return _misses;
+}
+
+/**
+ * @brief   Estimates the memory held by loaded bitmaps' pixels
+ * @return  The number of bytes
+ */
++(long) bytes
+{
+    return _bytes;
+}
+
+@end
@@ -8,6 +8,13 @@
 
 #import <Foundation/Foundation.h>
 
+// Import the dirty region kept between frames, and the batch sprites draw into
+#import "DDDirtyRegion.h"
+#import "DDAtlas.h"
+
+// Import the frame profiler shown in the debug view
+#import "DDProfiler.h"
+
 // Forward reference classes referenced in interface
 @class DDHud, DDSprite;
 
@@ -16,16 +23,32 @@
     // Declare ivars
     NSMutableArray*         _sprites;   //!< Defines a collection of sprites that the canvas
                                         //!< will draw when it is asked to draw
+    NSMutableDictionary*    _spritesByClass;    //!< Defines the same sprites bucketed by
+                                                //!< their class (class -> array of sprites,
+                                                //!< each knowing its index, in no particular
+                                                //!< order) so lookups by class don't walk
+                                                //!< every sprite
+    NSMutableDictionary*    _firstByClass;  //!< Defines the sprite getSprite: last found for
+                                            //!< each class, returned until it leaves play
+    NSUInteger              _added;     //!< Defines the number of sprites ever added, used
+                                        //!< to order those in a bucket
     DDHud*                  _hud;       //!< Defines the HUD that the canvas will draw when
                                         //!< it is asked to draw
+    DDDirtyRegion           _dirty;     //!< Defines the part of the screen that has changed
+                                        //!< since the canvas last drew, and so is redrawn
+    DDBatch                 _batch;     //!< Defines the batch sprites packed in the atlas
+                                        //!< gather their draws into
 }
 
 // Declare methods
 -(id)   init;
 -(void) addSprite:(DDSprite*) sprite;
--(void) removeSprite:(DDSprite*) sprite;
+-(void) removeSprites:(DDSprite* const*) sprites count:(int) count;
 -(id)   getSprite:(Class) class;
+-(void) savePositions;
 -(void) drawWithItems:(NSDictionary*) data;
--(void) drawDebug;
+-(void) drawWithItems:(NSDictionary*) data interpolation:(float) alpha;
+-(void) drawWithScore:(int) score patches:(int) patches interpolation:(float) alpha;
+-(void) drawDebugWithProfiler:(const DDProfiler*) profiler;
 
 @end
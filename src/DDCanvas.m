@@ -19,6 +19,12 @@
 #import "DDBalloon.h"
 #import "DDHud.h"
 
+/**
+ * @brief   The canvas that last drew to the screen; any other canvas
+ *          must redraw all of it, as what is on screen is not its own
+ */
+static DDCanvas* _lastDrawn = nil;
+
 @implementation DDCanvas 
 
 /**
@@ -30,12 +36,30 @@
 {
     if (self = [super init])
     {
-        _sprites     = [[NSMutableArray alloc] init];
-        _hud         = [[DDHud alloc] init];
+        _sprites        = [[NSMutableArray alloc] init];
+        _spritesByClass = [[NSMutableDictionary alloc] init];
+        _firstByClass   = [[NSMutableDictionary alloc] init];
+        _hud            = [[DDHud alloc] init];
+        _added          = 0;
+        dd_dirty_reset(&_dirty, [SGGraphics screenWidth], [SGGraphics screenHeight]);
+        dd_batch_init(&_batch);
     }
     return self;
 }
 
+/**
+ * @brief   Releases every sprite still on the canvas, and the HUD
+ */
+-(void) dealloc
+{
+    if (_lastDrawn == self) { _lastDrawn = nil; }
+    [_sprites release];
+    [_spritesByClass release];
+    [_firstByClass release];
+    [_hud release];
+    [super dealloc];
+}
+
 /**
  * @brief   Adds a sprite to the sprite collection
  * @param   sprite
@@ -44,18 +68,128 @@
 -(void)addSprite:(DDSprite*) sprite
 {
     [_sprites addObject:sprite];
+    
+    // File it under its class too, creating that class' bucket if needed
+    NSMutableArray* bucket = [_spritesByClass objectForKey:[sprite class]];
+    if (!bucket)
+    {
+        bucket = [[NSMutableArray alloc] init];
+        [_spritesByClass setObject:bucket forKey:(id<NSCopying>)[sprite class]];
+        [bucket release];
+    }
+    sprite.bucketIndex = [bucket count];
+    sprite.addedOrder  = _added++;
+    [bucket addObject:sprite];
 }
 
 /**
- * @brief   Kills a sprite entirely by setting it to
- *          nill, releasing it, and removing it from
- *          the sprites collection.
- * @param   sprite
- *          The sprite object to be killed
+ * @brief   Kills sprites entirely, removing them from the sprites
+ *          collection (which releases them) in a single pass
+ * @param   sprites
+ *          The sprites to be killed, already taken out of play
+ * @param   count
+ *          Number of sprites to be killed
  */
--(void) removeSprite:(DDSprite*) sprite
+-(void) removeSprites:(DDSprite* const*) sprites count:(int) count
 {
-    [_sprites removeObjectIdenticalTo:sprite];
+    if (count == 0) return;
+    
+    for (int i = 0; i < count; i++)
+    {
+        // Whatever it covered last frame must be drawn over
+        dd_dirty_add(&_dirty, sprites[i].drawnBounds);
+        
+        // Remove from its bucket while the sprite is certainly still
+        // alive, moving the bucket's last sprite into its place
+        NSMutableArray* bucket  = [_spritesByClass objectForKey:[sprites[i] class]];
+        DDSprite*       last    = [bucket lastObject];
+        if (last != sprites[i])
+        {
+            last.bucketIndex = sprites[i].bucketIndex;
+            [bucket replaceObjectAtIndex:last.bucketIndex withObject:last];
+        }
+        [bucket removeLastObject];
+        
+        // Forget it as the first of its class, so getSprite: looks again
+        if ([_firstByClass objectForKey:[sprites[i] class]] == sprites[i])
+        {
+            [_firstByClass removeObjectForKey:[sprites[i] class]];
+        }
+    }
+    
+    // Find them all in one walk of the collection (they are out of play,
+    // so only inactive sprites are compared), then close up the gaps at
+    // once, keeping the rest in drawing order
+    NSMutableIndexSet* doomed = [NSMutableIndexSet indexSet];
+    for (NSUInteger i = 0, found = 0; i < [_sprites count] && found < count; i++)
+    {
+        DDSprite* sprite = [_sprites objectAtIndex:i];
+        if (sprite.active) continue;
+        for (int j = 0; j < count; j++)
+        {
+            if (sprites[j] == sprite) { [doomed addIndex:i]; found++; break; }
+        }
+    }
+    [_sprites removeObjectsAtIndexes:doomed];
+}
+
+/**
+ * @brief   Draws every sprite in play between its saved and
+ *          current position
+ * @note    This method is private
+ * @param   alpha
+ *          Fraction of the way from each sprite's saved position
+ *          to its current position (1 draws the current position)
+ */
+-(void) drawSpritesWithInterpolation:(float) alpha
+{
+    static const rectangle notDrawn = { 0, 0, 0, 0 };
+    
+    // Not what I drew last? Then nothing on screen can be kept
+    if (_lastDrawn != self) { dd_dirty_invalidate(&_dirty); }
+    
+    // Every sprite that moved (or came into or out of play) dirties
+    // both where it was and where it now is
+    for (DDSprite* sprite in _sprites)
+    {
+        rectangle was = sprite.drawnBounds;
+        rectangle now = sprite.active ? [sprite boundsWithInterpolation:alpha] : notDrawn;
+        if (memcmp(&was, &now, sizeof(rectangle)) != 0)
+        {
+            dd_dirty_add(&_dirty, was);
+            dd_dirty_add(&_dirty, now);
+            sprite.drawnBounds = now;
+        }
+    }
+    
+    // Most of the screen changed (such as when the background scrolls)?
+    if (dd_dirty_is_full(&_dirty))
+    {
+        for (DDSprite* sprite in _sprites)
+            if (sprite.active)
+                [sprite drawWithInterpolation:alpha inBatch:&_batch];   // Draw every sprite in play
+        dd_batch_flush(&_batch);
+    }
+    else
+    {
+        // Draw, in order, only the sprites over each dirty rectangle
+        for (int i = 0; i < _dirty.count; i++)
+        {
+            rectangle r = _dirty.rects[i];
+            [SGGraphics pushClipX:r.x y:r.y width:r.width height:r.height];
+            for (DDSprite* sprite in _sprites)
+            {
+                rectangle bounds = sprite.drawnBounds;
+                if (sprite.active && rectangles_intersect(&bounds, &r))
+                    [sprite drawWithInterpolation:alpha inBatch:&_batch];
+            }
+            dd_batch_flush(&_batch);                    // Before the clip goes
+            [SGGraphics popClipScreen];
+        }
+    }
+    
+    dd_dirty_clear(&_dirty);
+    _lastDrawn = self;
 }
 
 /**
@@ -71,36 +205,96 @@
  */
 -(void) drawWithItems:(NSDictionary*) data
 {
-    for (DDSprite* sprite in _sprites) [sprite draw];   // Draw every sprite
+    [self drawWithItems:data interpolation:1.0f];
+}
+
+/**
+ * @brief   Draws the canvas as drawWithItems: does, but places each
+ *          sprite between its saved and current position
+ * @param   data
+ *          The dictionary of key/value pairs that will
+ *          be added to the HUD
+ * @param   alpha
+ *          Fraction of the way from each sprite's saved position
+ *          to its current position (1 draws the current position)
+ */
+-(void) drawWithItems:(NSDictionary*) data interpolation:(float) alpha
+{
+    // These HUDs may clear the screen behind the sprites
+    dd_dirty_invalidate(&_dirty);
+    [self drawSpritesWithInterpolation:alpha];
     [_hud drawWithItems:data];                          // Draw the hud
     [SGGraphics refreshScreen];
 }
 
+/**
+ * @brief   Draws the canvas as drawWithItems:interpolation: does,
+ *          but with the in-game HUD, whose labels keep their text
+ *          rendered between frames
+ * @param   score
+ *          The score the HUD shows
+ * @param   patches
+ *          The number of patches the HUD shows
+ * @param   alpha
+ *          Fraction of the way from each sprite's saved position
+ *          to its current position (1 draws the current position)
+ */
+-(void) drawWithScore:(int) score patches:(int) patches interpolation:(float) alpha
+{
+    [self drawSpritesWithInterpolation:alpha];
+    [_hud drawWithScore:score patches:patches];         // Draw the hud
+    [SGGraphics refreshScreen];
+}
+
+/**
+ * @brief   Asks every sprite to remember its current position
+ *          ahead of a simulation tick, for interpolated drawing
+ */
+-(void) savePositions
+{
+    for (DDSprite* sprite in _sprites) [sprite savePosition];
+}
+
 /**
  * @brief   Returns the sprite with the given class
  *          name from the _sprites collection
+ * @note    The sprite found is kept and returned as it is until it
+ *          leaves play, so only then is the class' bucket looked
+ *          through again. A sprite put back into play (as a parked dart
+ *          is) is only found once the one kept has left play.
  * @param   class
- *          The class to compare against every DDSprite in the _sprites
- *          collection.
- * @return  Any object with the given class name, should it exist in _sprites.
- *          Where no object of this class name is found, a nil is returned.
+ *          The exact class of the sprite wanted (subclasses are not
+ *          matched).
+ * @return  The first object of the given class added to _sprites and
+ *          still in play, should one exist. Where no object of this class
+ *          is found, a nil is returned.
  */
 -(id) getSprite:(Class)class
 {
-    for (DDSprite* sprite in _sprites)
-        if ([sprite class] == class)
-        {
-            return sprite;
-        }
-    return nil;
+    DDSprite* first = [_firstByClass objectForKey:class];
+    if (first.active) return first;
+    
+    // Skip any killed this tick, which stay until the game destroys them
+    first = nil;
+    for (DDSprite* sprite in [_spritesByClass objectForKey:class])
+    {
+        if (sprite.active && (!first || sprite.addedOrder < first.addedOrder)) first = sprite;
+    }
+    if (first)  [_firstByClass setObject:first forKey:(id<NSCopying>)class];
+    else        [_firstByClass removeObjectForKey:class];
+    return first;
 }
 
 /**
- * @brief   Draws special objects for debugging purposes only
+ * @brief   Draws special objects for debugging purposes only,
+ *          along with how long each phase of a frame is taking
  * @note    This method applies only in Debug mode
+ * @param   profiler
+ *          The profiler whose percentiles are shown, or NULL
  */
--(void) drawDebug {
+-(void) drawDebugWithProfiler:(const DDProfiler*) profiler {
     [SGGraphics clearScreen];
+    _lastDrawn = nil;                                   // Nothing drawn is kept
     [SGText drawText:@"[ DART DODGER! ]" color:ColorWhite pt:[SGGeometry pointAtX:145 y:40]];
     [SGText drawText:@"By Alex Cummaudo" color:ColorWhite pt:[SGGeometry pointAtX:145 y:50]];
     [SGText drawText:@"** Debug Mode **" color:ColorWhite pt:[SGGeometry pointAtX:145 y:60]];
@@ -111,6 +305,8 @@
     {
         // Given it isn't collidable (conforms to the protocol), then move onto next
         if (![sprite conformsToProtocol:@protocol(DDCollidable)]) continue;
+        // Or isn't in play
+        if (!sprite.active) continue;
 
         // Is this one a balloon?
         if ([sprite isKindOfClass:[DDBalloon class]])
@@ -124,37 +320,51 @@
             if (balloonCount > 1)
             {
                 // Draw Magenta/Blue col. masks (triangles) color for duplicate balloon
-                [SGGraphics draw:ColorMagenta  filled:NO triangle:balloon.innerCollisionMask.shape];
-                [SGGraphics draw:ColorBlue filled:NO triangle:balloon.outerCollisionMask.shape];
+                draw_triangle_struct(ColorMagenta, balloon.innerCollisionMask.tri);
+                draw_triangle_struct(ColorBlue,    balloon.outerCollisionMask.tri);
             }
             else
             {
                 // Draw Green/Yellow col. masks (triangles) color for normal balloon
-                [SGGraphics draw:ColorYellow  filled:NO triangle:balloon.innerCollisionMask.shape];
-                [SGGraphics draw:ColorGreen   filled:NO triangle:balloon.outerCollisionMask.shape];
+                draw_triangle_struct(ColorYellow,  balloon.innerCollisionMask.tri);
+                draw_triangle_struct(ColorGreen,   balloon.outerCollisionMask.tri);
             }
         }
         else
         {
             // Draw red rectangles for other collidables
-            [SGGraphics draw:ColorRed filled:NO rectangle:sprite.getCollisionMask.shape];
+            draw_rectangle_struct(ColorRed, sprite.getCollisionMask.rect);
         }
 
+        point2d centre = sprite.centrePoint;
+
         // Draw class name
         [SGText drawText:[sprite className]
                    color:ColorTurquoise
-               onScreenX:sprite.centre.x-40
-                       y:sprite.centre.y+10];
+               onScreenX:centre.x-40
+                       y:centre.y+10];
         // Memory Address
         [SGText drawText:[NSString stringWithFormat:@"%p", sprite]
                    color:ColorTurquoise
-               onScreenX:sprite.centre.x-40
-                       y:sprite.centre.y+20 ];
+               onScreenX:centre.x-40
+                       y:centre.y+20 ];
         // Centrepoint
         [SGText drawText:[SGGeometry pointToString:sprite.centre]
                    color:ColorTurquoise
-               onScreenX:sprite.centre.x-40
-                       y:sprite.centre.y+30  ];
+               onScreenX:centre.x-40
+                       y:centre.y+30  ];
+    }
+    
+    // Phase timings (in microseconds) over the profiler's recent samples
+    for (int phase = 0; profiler && phase < DDPHASE_COUNT; phase++)
+    {
+        float p50, p95, p99;
+        if (!dd_profile_percentiles(profiler, phase, &p50, &p95, &p99)) continue;
+        [SGText drawText:[NSString stringWithFormat:@"%-10s p50 %6.1f p95 %6.1f p99 %6.1f us",
+                          dd_profile_phase_name(phase), p50, p95, p99]
+                   color:ColorYellow
+               onScreenX:10
+                       y:80 + 10 * phase];
     }
     [SGGraphics refreshScreen];
 }
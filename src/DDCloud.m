@@ -38,22 +38,22 @@
 {
     
     // Define the spawn position
-    SGPoint2D* pos;
+    point2d pos;
     NSString* img;
     
     // Moving left = spawn right
     if (dir == DDLEFT)
     {
         img = @"cloudR.png";
-        pos = [SGGeometry pointAtX:[SGGraphics screenWidth]
-                                 y:400];
+        pos = [SGGeometry pointDataAtX:[SGGraphics screenWidth]
+                                     y:400];
     }
     // Moving left = spawn right
     if (dir == DDRIGHT)
     {
         img = @"cloudL.png";
-        pos = [SGGeometry pointAtX:-[SGGraphics screenWidth]/2
-                                 y:400];
+        pos = [SGGeometry pointDataAtX:-[SGGraphics screenWidth]/2
+                                     y:400];
         
     }
     
@@ -63,15 +63,25 @@
                                   inGame:game])
     {
         _collisionMask  = [[DDCollisionMask alloc]
-                           initAsRectangleAtPointA:_position
-                           pointB:[SGGeometry pointAtX:_position.x+_bitmap.width
-                                                     y:_position.y+_bitmap.height]];
+                           initAsRectangle:rectangle_from(_position.x,
+                                                          _position.y,
+                                                          _bitmap.width,
+                                                          _bitmap.height)];
         _movingDirection = dir;
     }
     return self;
     
 }
 
+/**
+ * @brief   Releases the cloud's collision mask
+ */
+-(void) dealloc
+{
+    [_collisionMask release];
+    [super dealloc];
+}
+
 
 /**
  * @brief   Causes the cloud to move left or right
@@ -84,12 +94,7 @@
     // Move left if left, else right
     if ( _movingDirection == DDLEFT  )  { _position.x -= _speed; }
     if ( _movingDirection == DDRIGHT )  { _position.x += _speed; }
-    
-    NSArray* pts = [[NSArray alloc] initWithObjects:_position,
-                    [SGGeometry pointAtX:_position.x+_bitmap.width
-                                       y:_position.y+_bitmap.height],
-                    nil];
-    [_collisionMask updateWithPoints:pts];
+    [_collisionMask moveInDirection:_movingDirection atSpeed:_speed];
     
     // Kill myself if off right and moving left if off left and moving right
     if ((_position.x > [SGGraphics screenWidth] && _movingDirection == DDRIGHT) ||
@@ -98,7 +103,6 @@
         [self kill];
         self = nil;
     }
-    [pts release];
 }
 
 
@@ -127,14 +131,13 @@
     {
         
         // Make mask for both outer triangle
-        SGTriangle* outerColMsk = sprite.getCollisionMask.shape;
+        const triangle* outerColMsk = sprite.getCollisionMask.tri;
         
         // Cast the sprite as a balloon
         DDBalloon* balloon = (DDBalloon*)sprite;
         
         // Now check the collision
-        if ([SGGeometry triangle:outerColMsk
-             intersectsRectangle:_collisionMask.shape])
+        if (triangle_rectangle_intersect(outerColMsk, _collisionMask.rect))
         {
 
             // Move balloon left or right, accordingly
@@ -0,0 +1,56 @@
+/**
+ * @class   DDCollisionGrid
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a uniform grid over the playfield used as the
+ *          broad phase of collision checking. Items are binned by
+ *          the bounds of their collision masks each tick; only items
+ *          sharing a cell with a queried shape are marked as worth an
+ *          exact DDCollidable collideWithSprite: test.
+ */
+
+#import <Foundation/Foundation.h>
+
+// Import SwinGame types (for rectangle)
+#import "Types.h"
+
+/**
+ * @brief   Width and height of each grid cell in pixels; a 400x600
+ *          playfield becomes 8x12 cells, each a little wider than a
+ *          dart and shorter than the balloon
+ */
+#define DD_COLLISION_CELL_SIZE 50
+
+/**
+ * @struct  DDCollisionGridEntry
+ * @brief   One item binned into one cell, chained to the next entry
+ *          in the same cell.
+ */
+typedef struct DDCollisionGridEntry
+{
+    int item;   //!< Index of the item this entry bins
+    int next;   //!< Index of the next entry in this cell, or -1
+} DDCollisionGridEntry;
+
+@interface DDCollisionGrid : NSObject
+{
+    // Declare ivars
+    int                     _columns;           //!< Number of cells across the playfield
+    int                     _rows;              //!< Number of cells down the playfield
+    int*                    _cellHeads;         //!< First entry of each cell, or -1 if empty
+    DDCollisionGridEntry*   _entries;           //!< Every entry binned since the last clear
+    int                     _entryCount;        //!< Number of entries in use
+    int                     _entryCapacity;     //!< Number of entries allocated
+    unsigned char*          _marks;             //!< Flags marked against each item by
+                                                //!< markItemsNear:withFlag:
+    int                     _itemCapacity;      //!< Number of items _marks can hold
+}
+
+// Declare methods
+-(id)               initWithWidth:(int) width height:(int) height;
+-(void)             clear;
+-(void)             insertItem:(int) item withBounds:(rectangle) bounds;
+-(void)             markItemsNear:(rectangle) bounds withFlag:(unsigned char) flag;
+-(unsigned char)    marksForItem:(int) item;
+
+@end
@@ -0,0 +1,166 @@
+/**
+ * @class   DDCollisionGrid
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a uniform grid over the playfield used as the
+ *          broad phase of collision checking.
+ */
+
+// Import my interface
+#import "DDCollisionGrid.h"
+
+@implementation DDCollisionGrid
+
+/**
+ * @brief   Constructor for the grid, covering a playfield of the
+ *          given size with DD_COLLISION_CELL_SIZE cells
+ * @param   width
+ *          Width of the playfield in pixels
+ * @param   height
+ *          Height of the playfield in pixels
+ * @return  The class's self pointer
+ */
+-(id)initWithWidth:(int) width height:(int) height
+{
+    if (self = [super init])
+    {
+        _columns        = MAX(1, (width  + DD_COLLISION_CELL_SIZE - 1) / DD_COLLISION_CELL_SIZE);
+        _rows           = MAX(1, (height + DD_COLLISION_CELL_SIZE - 1) / DD_COLLISION_CELL_SIZE);
+        _cellHeads      = malloc(sizeof(int) * _columns * _rows);
+        _entryCapacity  = 64;
+        _entries        = malloc(sizeof(DDCollisionGridEntry) * _entryCapacity);
+        _itemCapacity   = 32;
+        _marks          = malloc(sizeof(unsigned char) * _itemCapacity);
+        [self clear];
+    }
+    return self;
+}
+
+/**
+ * @brief   Frees the grid's cells and entries
+ */
+-(void)dealloc
+{
+    free(_cellHeads);
+    free(_entries);
+    free(_marks);
+    [super dealloc];
+}
+
+/**
+ * @brief   Works out the range of cells a rectangle covers. Anything
+ *          off the playfield is clamped into the edge cells so that
+ *          sprites above the screen (e.g. newly spawned darts) still
+ *          meet each other in the broad phase.
+ * @note    This method is private
+ * @param   bounds
+ *          The rectangle to find the cells of
+ * @param   range
+ *          Filled with the first column, first row, last column and
+ *          last row covered, in that order
+ */
+-(void) cellRangeOf:(rectangle) bounds into:(int*) range
+{
+    int firstCol = (int)floorf(bounds.x / DD_COLLISION_CELL_SIZE);
+    int firstRow = (int)floorf(bounds.y / DD_COLLISION_CELL_SIZE);
+    int lastCol  = (int)floorf((bounds.x + bounds.width)  / DD_COLLISION_CELL_SIZE);
+    int lastRow  = (int)floorf((bounds.y + bounds.height) / DD_COLLISION_CELL_SIZE);
+    
+    range[0] = MIN(MAX(firstCol, 0), _columns - 1);
+    range[1] = MIN(MAX(firstRow, 0), _rows    - 1);
+    range[2] = MIN(MAX(lastCol,  0), _columns - 1);
+    range[3] = MIN(MAX(lastRow,  0), _rows    - 1);
+}
+
+/**
+ * @brief   Empties every cell and clears every item's marks, ready
+ *          for items to be binned again for a new tick
+ */
+-(void) clear
+{
+    for (int i = 0; i < _columns * _rows; i++) _cellHeads[i] = -1;
+    memset(_marks, 0, _itemCapacity);
+    _entryCount = 0;
+}
+
+/**
+ * @brief   Bins an item into every cell its bounds overlap
+ * @param   item
+ *          Index of the item (e.g. its slot in the DDDartPool); items
+ *          should be numbered from zero
+ * @param   bounds
+ *          Bounding rectangle of the item's collision mask
+ */
+-(void) insertItem:(int) item withBounds:(rectangle) bounds
+{
+    int range[4];
+    [self cellRangeOf:bounds into:range];
+    
+    // Make room for the item's marks
+    if (item >= _itemCapacity)
+    {
+        int capacity = _itemCapacity;
+        while (item >= capacity) capacity *= 2;
+        _marks = realloc(_marks, sizeof(unsigned char) * capacity);
+        memset(_marks + _itemCapacity, 0, capacity - _itemCapacity);
+        _itemCapacity = capacity;
+    }
+    
+    for (int row = range[1]; row <= range[3]; row++)
+    {
+        for (int col = range[0]; col <= range[2]; col++)
+        {
+            // Make room for another entry
+            if (_entryCount == _entryCapacity)
+            {
+                _entryCapacity *= 2;
+                _entries = realloc(_entries, sizeof(DDCollisionGridEntry) * _entryCapacity);
+            }
+            
+            // Chain the entry onto the front of its cell
+            int cell = row * _columns + col;
+            _entries[_entryCount].item = item;
+            _entries[_entryCount].next = _cellHeads[cell];
+            _cellHeads[cell] = _entryCount++;
+        }
+    }
+}
+
+/**
+ * @brief   Marks every item sharing a cell with the given bounds
+ * @param   bounds
+ *          Bounding rectangle of the shape to find neighbours of
+ * @param   flag
+ *          Flag to OR into the marks of each neighbouring item, so
+ *          that several shapes can be queried in the one tick
+ */
+-(void) markItemsNear:(rectangle) bounds withFlag:(unsigned char) flag
+{
+    int range[4];
+    [self cellRangeOf:bounds into:range];
+    
+    for (int row = range[1]; row <= range[3]; row++)
+    {
+        for (int col = range[0]; col <= range[2]; col++)
+        {
+            for (int e = _cellHeads[row * _columns + col]; e != -1; e = _entries[e].next)
+            {
+                _marks[_entries[e].item] |= flag;
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Returns the flags marked against an item since the last clear
+ * @param   item
+ *          Index of the item
+ * @return  Every flag marked against the item, or 0 if it is not near
+ *          anything queried
+ */
+-(unsigned char) marksForItem:(int) item
+{
+    return item < _itemCapacity ? _marks[item] : 0;
+}
+
+@end
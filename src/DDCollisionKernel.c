@@ -0,0 +1,570 @@
+/**
+ * @file    DDCollisionKernel.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines batch collision tests that check many darts at
+ *          once rather than one collideWithSprite: message at a time.
+ */
+
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define DD_COLLISION_X86 1
+#else
+#define DD_COLLISION_X86 0
+#endif
+
+#include "DDCollisionKernel.h"
+
+/**
+ * @brief   Kernel batch tests go through; -1 until the first test picks one
+ */
+static int dd_collision_chosen = -1;
+
+/**
+ * @struct  DDTriangleSetup
+ * @brief   The parts of the barycentric point-in-triangle test that
+ *          only depend on the triangle, worked out once per batch.
+ */
+typedef struct DDTriangleSetup
+{
+    float   originX, originY;   //!< First point of the triangle
+    float   v0x, v0y;           //!< Edge from the first point to the third
+    float   v1x, v1y;           //!< Edge from the first point to the second
+    float   a, b, d;            //!< Dot products v0.v0, v0.v1 and v1.v1
+    double  denom;              //!< a * d - b * b, unrounded; zero for a degenerate triangle
+    float   inverse;            //!< 1 / denom, rounded to float as SwinGame stores it
+} DDTriangleSetup;
+
+/**
+ * @brief   Works out the per-triangle part of the point-in-triangle test
+ *          in the same order as SwinGame's PointInTriangle
+ * @note    SwinGame keeps the denominator and numerators in x87 extended
+ *          precision and rounds only 1 / denom, u and v to float. Each is
+ *          the difference of two products of floats, which are exact in
+ *          double, so double stands in for extended here, as it does in
+ *          point_in_triangle.
+ * @param   tri
+ *          The triangle to test against
+ * @return  The triangle's setup
+ */
+static DDTriangleSetup dd_triangle_setup(const triangle *tri)
+{
+    DDTriangleSetup s;
+    s.originX   = tri->points[0].x;
+    s.originY   = tri->points[0].y;
+    s.v0x       = tri->points[2].x - s.originX;
+    s.v0y       = tri->points[2].y - s.originY;
+    s.v1x       = tri->points[1].x - s.originX;
+    s.v1y       = tri->points[1].y - s.originY;
+    s.a         = s.v0x * s.v0x + s.v0y * s.v0y;
+    s.b         = s.v0x * s.v1x + s.v0y * s.v1y;
+    s.d         = s.v1x * s.v1x + s.v1y * s.v1y;
+    s.denom     = (double)s.a * s.d - (double)s.b * s.b;
+    s.inverse   = (float)(1 / s.denom);
+    return s;
+}
+
+/**
+ * @brief   Sets the bits of a hit bitmask for a run of results
+ * @param   hits
+ *          The bitmask to set bits in
+ * @param   first
+ *          Index of the rectangle the first result is for
+ * @param   bits
+ *          One bit per result, lowest first
+ * @note    Runs are one, four or eight long, all of which divide 64,
+ *          so a run never straddles two words.
+ */
+static inline void dd_hit_mask_set(uint64_t *hits, int first, unsigned bits)
+{
+    hits[first / 64] |= (uint64_t)bits << (first % 64);
+}
+
+/**
+ * @brief   Empties a batch, ready for rectangles to be added for a new tick
+ * @param   batch
+ *          The batch to empty
+ */
+void dd_rect_batch_clear(DDRectBatch *batch)
+{
+    batch->count = 0;
+}
+
+/**
+ * @brief   Adds a rectangle to the end of a batch
+ * @param   batch
+ *          The batch to add to
+ * @param   rect
+ *          The rectangle to add
+ * @return  Index of the rectangle in the batch, or -1 if the batch is full
+ */
+int dd_rect_batch_add(DDRectBatch *batch, const rectangle *rect)
+{
+    if (batch->count == DD_RECT_BATCH_CAPACITY) return -1;
+
+    int i = batch->count++;
+    batch->x[i]         = rect->x;
+    batch->y[i]         = rect->y;
+    batch->width[i]     = rect->width;
+    batch->height[i]    = rect->height;
+    return i;
+}
+
+/**
+ * @brief   Clears the bits of a hit bitmask for the first rectangles of
+ *          a batch
+ * @param   hits
+ *          The bitmask to clear
+ * @param   count
+ *          Number of rectangles to clear the bits of
+ */
+void dd_hit_mask_clear(uint64_t *hits, int count)
+{
+    memset(hits, 0, sizeof(uint64_t) * (count / 64));
+    if (count % 64) hits[count / 64] &= ~((1ull << (count % 64)) - 1);
+}
+
+/**
+ * @brief   Checks a bit of a hit bitmask
+ * @param   hits
+ *          The bitmask to check
+ * @param   index
+ *          Index of the rectangle in its batch
+ * @return  Non-zero if the rectangle was hit
+ */
+int dd_hit_mask_test(const uint64_t *hits, int index)
+{
+    return (hits[index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * @brief   Checks whether the centre bottom of one rectangle in a batch
+ *          is inside a triangle, as SwinGame's RectangleCenterBottom and
+ *          PointInTriangle would
+ * @param   batch
+ *          The batch holding the rectangle
+ * @param   i
+ *          Index of the rectangle
+ * @param   s
+ *          Setup of the triangle to test against
+ * @return  Non-zero if the point is inside the triangle
+ */
+static inline int dd_bottom_in_triangle(const DDRectBatch *batch, int i, const DDTriangleSetup *s)
+{
+    float px    = batch->x[i] + batch->width[i] / 2.0f;
+    float py    = batch->height[i] > 0 ? batch->y[i] + batch->height[i] : batch->y[i];
+    float v2x   = px - s->originX;
+    float v2y   = py - s->originY;
+    float c     = s->v0x * v2x + s->v0y * v2y;
+    float e     = s->v1x * v2x + s->v1y * v2y;
+    float u     = (float)(((double)s->d * c - (double)s->b * e) * s->inverse);
+    float v     = (float)(((double)s->a * e - (double)s->b * c) * s->inverse);
+    return u > 0 && v > 0 && (double)u + v < 1;
+}
+
+/**
+ * @brief   Checks whether a point is inside one rectangle in a batch,
+ *          edges included, as SwinGame's PointInRect would
+ * @param   batch
+ *          The batch holding the rectangle
+ * @param   i
+ *          Index of the rectangle
+ * @param   pt
+ *          The point to check
+ * @return  Non-zero if the point is inside the rectangle
+ */
+static inline int dd_contains_point(const DDRectBatch *batch, int i, const point2d *pt)
+{
+    if (pt->x < batch->x[i] || pt->x > batch->x[i] + batch->width[i])  return 0;
+    if (pt->y < batch->y[i] || pt->y > batch->y[i] + batch->height[i]) return 0;
+    return 1;
+}
+
+/**
+ * @brief   Marks which rectangles have their centre bottom inside a
+ *          triangle, one rectangle at a time
+ * @note    This is the fallback of dd_rect_batch_bottoms_in_triangle
+ *          and the reference it is checked against.
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   tri
+ *          The triangle to test against
+ * @param   hits
+ *          Bitmask to set the bit of every hit rectangle in; bits of
+ *          rectangles that miss are left as they were
+ */
+void dd_rect_batch_bottoms_in_triangle_scalar(const DDRectBatch *batch, int count,
+                                              const triangle *tri, uint64_t *hits)
+{
+    DDTriangleSetup s = dd_triangle_setup(tri);
+    if (s.denom == 0) return;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (dd_bottom_in_triangle(batch, i, &s)) dd_hit_mask_set(hits, i, 1);
+    }
+}
+
+/**
+ * @brief   Marks which rectangles contain a point, one rectangle at a time
+ * @note    This is the fallback of dd_rect_batch_containing_point and the
+ *          reference it is checked against.
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   pt
+ *          The point to look for
+ * @param   hits
+ *          Bitmask to set the bit of every rectangle containing the
+ *          point in; other bits are left as they were
+ */
+void dd_rect_batch_containing_point_scalar(const DDRectBatch *batch, int count,
+                                           const point2d *pt, uint64_t *hits)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (dd_contains_point(batch, i, pt)) dd_hit_mask_set(hits, i, 1);
+    }
+}
+
+#if DD_COLLISION_X86
+
+/**
+ * @brief   Marks which rectangles have their centre bottom inside a
+ *          triangle, four rectangles at a time
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   tri
+ *          The triangle to test against
+ * @param   hits
+ *          Bitmask to set the bit of every hit rectangle in
+ */
+__attribute__((target("sse2")))
+static void dd_bottoms_in_triangle_sse(const DDRectBatch *batch, int count,
+                                       const triangle *tri, uint64_t *hits)
+{
+    DDTriangleSetup s = dd_triangle_setup(tri);
+    if (s.denom == 0) return;
+
+    const __m128  zero  = _mm_setzero_ps();
+    const __m128  half  = _mm_set1_ps(0.5f);
+    const __m128  ox    = _mm_set1_ps(s.originX), oy  = _mm_set1_ps(s.originY);
+    const __m128  v0x   = _mm_set1_ps(s.v0x),     v0y = _mm_set1_ps(s.v0y);
+    const __m128  v1x   = _mm_set1_ps(s.v1x),     v1y = _mm_set1_ps(s.v1y);
+    const __m128d one   = _mm_set1_pd(1.0);
+    const __m128d a     = _mm_set1_pd(s.a),       b   = _mm_set1_pd(s.b);
+    const __m128d d     = _mm_set1_pd(s.d),       inv = _mm_set1_pd(s.inverse);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 px   = _mm_add_ps(_mm_loadu_ps(&batch->x[i]),
+                                 _mm_mul_ps(_mm_loadu_ps(&batch->width[i]), half));
+        __m128 py   = _mm_add_ps(_mm_loadu_ps(&batch->y[i]),
+                                 _mm_max_ps(_mm_loadu_ps(&batch->height[i]), zero));
+        __m128 v2x  = _mm_sub_ps(px, ox);
+        __m128 v2y  = _mm_sub_ps(py, oy);
+        __m128 c    = _mm_add_ps(_mm_mul_ps(v0x, v2x), _mm_mul_ps(v0y, v2y));
+        __m128 e    = _mm_add_ps(_mm_mul_ps(v1x, v2x), _mm_mul_ps(v1y, v2y));
+
+        // The numerators in double, two lanes at a time, rounding only u
+        // and v to float (see dd_triangle_setup)
+        __m128d cLo = _mm_cvtps_pd(c), cHi = _mm_cvtps_pd(_mm_movehl_ps(c, c));
+        __m128d eLo = _mm_cvtps_pd(e), eHi = _mm_cvtps_pd(_mm_movehl_ps(e, e));
+        __m128 u    = _mm_movelh_ps(
+                        _mm_cvtpd_ps(_mm_mul_pd(_mm_sub_pd(_mm_mul_pd(d, cLo), _mm_mul_pd(b, eLo)), inv)),
+                        _mm_cvtpd_ps(_mm_mul_pd(_mm_sub_pd(_mm_mul_pd(d, cHi), _mm_mul_pd(b, eHi)), inv)));
+        __m128 v    = _mm_movelh_ps(
+                        _mm_cvtpd_ps(_mm_mul_pd(_mm_sub_pd(_mm_mul_pd(a, eLo), _mm_mul_pd(b, cLo)), inv)),
+                        _mm_cvtpd_ps(_mm_mul_pd(_mm_sub_pd(_mm_mul_pd(a, eHi), _mm_mul_pd(b, cHi)), inv)));
+
+        // u + v is compared with 1 unrounded
+        __m128d sumLo = _mm_add_pd(_mm_cvtps_pd(u), _mm_cvtps_pd(v));
+        __m128d sumHi = _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(u, u)),
+                                   _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+        unsigned below  = (unsigned)_mm_movemask_pd(_mm_cmplt_pd(sumLo, one)) |
+                          (unsigned)_mm_movemask_pd(_mm_cmplt_pd(sumHi, one)) << 2;
+        __m128 positive = _mm_and_ps(_mm_cmpgt_ps(u, zero), _mm_cmpgt_ps(v, zero));
+        dd_hit_mask_set(hits, i, (unsigned)_mm_movemask_ps(positive) & below);
+    }
+    for (; i < count; i++)
+    {
+        if (dd_bottom_in_triangle(batch, i, &s)) dd_hit_mask_set(hits, i, 1);
+    }
+}
+
+/**
+ * @brief   Marks which rectangles contain a point, four rectangles at
+ *          a time
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   pt
+ *          The point to look for
+ * @param   hits
+ *          Bitmask to set the bit of every rectangle containing the
+ *          point in
+ */
+__attribute__((target("sse")))
+static void dd_containing_point_sse(const DDRectBatch *batch, int count,
+                                    const point2d *pt, uint64_t *hits)
+{
+    const __m128 px = _mm_set1_ps(pt->x);
+    const __m128 py = _mm_set1_ps(pt->y);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x    = _mm_loadu_ps(&batch->x[i]);
+        __m128 y    = _mm_loadu_ps(&batch->y[i]);
+        __m128 r    = _mm_add_ps(x, _mm_loadu_ps(&batch->width[i]));
+        __m128 btm  = _mm_add_ps(y, _mm_loadu_ps(&batch->height[i]));
+        __m128 in   = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(px, x), _mm_cmple_ps(px, r)),
+                                 _mm_and_ps(_mm_cmpge_ps(py, y), _mm_cmple_ps(py, btm)));
+        dd_hit_mask_set(hits, i, (unsigned)_mm_movemask_ps(in));
+    }
+    for (; i < count; i++)
+    {
+        if (dd_contains_point(batch, i, pt)) dd_hit_mask_set(hits, i, 1);
+    }
+}
+
+
+/**
+ * @brief   Marks which rectangles have their centre bottom inside a
+ *          triangle, eight rectangles at a time
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   tri
+ *          The triangle to test against
+ * @param   hits
+ *          Bitmask to set the bit of every hit rectangle in
+ */
+__attribute__((target("avx")))
+static void dd_bottoms_in_triangle_avx(const DDRectBatch *batch, int count,
+                                       const triangle *tri, uint64_t *hits)
+{
+    DDTriangleSetup s = dd_triangle_setup(tri);
+    if (s.denom == 0) return;
+
+    const __m256  zero  = _mm256_setzero_ps();
+    const __m256  half  = _mm256_set1_ps(0.5f);
+    const __m256  ox    = _mm256_set1_ps(s.originX), oy  = _mm256_set1_ps(s.originY);
+    const __m256  v0x   = _mm256_set1_ps(s.v0x),     v0y = _mm256_set1_ps(s.v0y);
+    const __m256  v1x   = _mm256_set1_ps(s.v1x),     v1y = _mm256_set1_ps(s.v1y);
+    const __m256d one   = _mm256_set1_pd(1.0);
+    const __m256d a     = _mm256_set1_pd(s.a),       b   = _mm256_set1_pd(s.b);
+    const __m256d d     = _mm256_set1_pd(s.d),       inv = _mm256_set1_pd(s.inverse);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 px   = _mm256_add_ps(_mm256_loadu_ps(&batch->x[i]),
+                                    _mm256_mul_ps(_mm256_loadu_ps(&batch->width[i]), half));
+        __m256 py   = _mm256_add_ps(_mm256_loadu_ps(&batch->y[i]),
+                                    _mm256_max_ps(_mm256_loadu_ps(&batch->height[i]), zero));
+        __m256 v2x  = _mm256_sub_ps(px, ox);
+        __m256 v2y  = _mm256_sub_ps(py, oy);
+        __m256 c    = _mm256_add_ps(_mm256_mul_ps(v0x, v2x), _mm256_mul_ps(v0y, v2y));
+        __m256 e    = _mm256_add_ps(_mm256_mul_ps(v1x, v2x), _mm256_mul_ps(v1y, v2y));
+
+        // The numerators in double, four lanes at a time, rounding only u
+        // and v to float (see dd_triangle_setup)
+        __m256d cLo = _mm256_cvtps_pd(_mm256_castps256_ps128(c));
+        __m256d cHi = _mm256_cvtps_pd(_mm256_extractf128_ps(c, 1));
+        __m256d eLo = _mm256_cvtps_pd(_mm256_castps256_ps128(e));
+        __m256d eHi = _mm256_cvtps_pd(_mm256_extractf128_ps(e, 1));
+        __m128 uLo  = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(d, cLo),
+                                                                  _mm256_mul_pd(b, eLo)), inv));
+        __m128 uHi  = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(d, cHi),
+                                                                  _mm256_mul_pd(b, eHi)), inv));
+        __m128 vLo  = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(a, eLo),
+                                                                  _mm256_mul_pd(b, cLo)), inv));
+        __m128 vHi  = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(a, eHi),
+                                                                  _mm256_mul_pd(b, cHi)), inv));
+        __m256 u    = _mm256_insertf128_ps(_mm256_castps128_ps256(uLo), uHi, 1);
+        __m256 v    = _mm256_insertf128_ps(_mm256_castps128_ps256(vLo), vHi, 1);
+
+        // u + v is compared with 1 unrounded
+        __m256d sumLo   = _mm256_add_pd(_mm256_cvtps_pd(uLo), _mm256_cvtps_pd(vLo));
+        __m256d sumHi   = _mm256_add_pd(_mm256_cvtps_pd(uHi), _mm256_cvtps_pd(vHi));
+        unsigned below  = (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(sumLo, one, _CMP_LT_OQ)) |
+                          (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(sumHi, one, _CMP_LT_OQ)) << 4;
+        __m256 positive = _mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GT_OQ),
+                                        _mm256_cmp_ps(v, zero, _CMP_GT_OQ));
+        dd_hit_mask_set(hits, i, (unsigned)_mm256_movemask_ps(positive) & below);
+    }
+    for (; i < count; i++)
+    {
+        if (dd_bottom_in_triangle(batch, i, &s)) dd_hit_mask_set(hits, i, 1);
+    }
+}
+
+/**
+ * @brief   Marks which rectangles contain a point, eight rectangles at
+ *          a time
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   pt
+ *          The point to look for
+ * @param   hits
+ *          Bitmask to set the bit of every rectangle containing the
+ *          point in
+ */
+__attribute__((target("avx")))
+static void dd_containing_point_avx(const DDRectBatch *batch, int count,
+                                    const point2d *pt, uint64_t *hits)
+{
+    const __m256 px = _mm256_set1_ps(pt->x);
+    const __m256 py = _mm256_set1_ps(pt->y);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x    = _mm256_loadu_ps(&batch->x[i]);
+        __m256 y    = _mm256_loadu_ps(&batch->y[i]);
+        __m256 r    = _mm256_add_ps(x, _mm256_loadu_ps(&batch->width[i]));
+        __m256 btm  = _mm256_add_ps(y, _mm256_loadu_ps(&batch->height[i]));
+        __m256 in   = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(px, x,   _CMP_GE_OQ),
+                                                  _mm256_cmp_ps(px, r,   _CMP_LE_OQ)),
+                                    _mm256_and_ps(_mm256_cmp_ps(py, y,   _CMP_GE_OQ),
+                                                  _mm256_cmp_ps(py, btm, _CMP_LE_OQ)));
+        dd_hit_mask_set(hits, i, (unsigned)_mm256_movemask_ps(in));
+    }
+    for (; i < count; i++)
+    {
+        if (dd_contains_point(batch, i, pt)) dd_hit_mask_set(hits, i, 1);
+    }
+}
+
+#endif
+
+/**
+ * @brief   Checks whether this CPU can run a kernel
+ * @param   kernel
+ *          The kernel to check
+ * @return  Non-zero if it can
+ */
+static int dd_collision_supported(DDCollisionKernel kernel)
+{
+    switch (kernel)
+    {
+        case DDCOLLISION_SCALAR:    return 1;
+#if DD_COLLISION_X86
+        case DDCOLLISION_SSE:       return __builtin_cpu_supports("sse2");
+        case DDCOLLISION_AVX:       return __builtin_cpu_supports("avx");
+#endif
+        default:                    return 0;
+    }
+}
+
+/**
+ * @brief   Gives the kernel batch tests go through, picking the widest
+ *          the CPU supports the first time it is asked
+ * @return  The kernel in use
+ */
+DDCollisionKernel dd_collision_kernel(void)
+{
+    int chosen = __atomic_load_n(&dd_collision_chosen, __ATOMIC_RELAXED);
+    if (chosen < 0)
+    {
+        chosen = DDCOLLISION_AVX;
+        while (!dd_collision_supported((DDCollisionKernel)chosen)) chosen--;
+        __atomic_store_n(&dd_collision_chosen, chosen, __ATOMIC_RELAXED);
+    }
+    return (DDCollisionKernel)chosen;
+}
+
+/**
+ * @brief   Makes batch tests go through a given kernel (e.g. to compare
+ *          them), if the CPU supports it
+ * @param   kernel
+ *          The kernel to use
+ * @return  0 if batch tests now use it, -1 if the CPU cannot run it
+ */
+int dd_collision_use_kernel(DDCollisionKernel kernel)
+{
+    if (!dd_collision_supported(kernel)) return -1;
+    __atomic_store_n(&dd_collision_chosen, (int)kernel, __ATOMIC_RELAXED);
+    return 0;
+}
+
+/**
+ * @brief   Names a kernel, for logs and benchmarks
+ * @param   kernel
+ *          The kernel to name
+ * @return  The kernel's name
+ */
+const char *dd_collision_kernel_name(DDCollisionKernel kernel)
+{
+    switch (kernel)
+    {
+        case DDCOLLISION_SSE:   return "SSE";
+        case DDCOLLISION_AVX:   return "AVX";
+        default:                return "scalar";
+    }
+}
+
+/**
+ * @brief   Marks which rectangles have their centre bottom inside a
+ *          triangle, through the widest kernel the CPU supports
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   tri
+ *          The triangle to test against
+ * @param   hits
+ *          Bitmask to set the bit of every hit rectangle in; bits of
+ *          rectangles that miss are left as they were
+ */
+void dd_rect_batch_bottoms_in_triangle(const DDRectBatch *batch, int count,
+                                       const triangle *tri, uint64_t *hits)
+{
+    switch (dd_collision_kernel())
+    {
+#if DD_COLLISION_X86
+        case DDCOLLISION_AVX:   dd_bottoms_in_triangle_avx(batch, count, tri, hits);    break;
+        case DDCOLLISION_SSE:   dd_bottoms_in_triangle_sse(batch, count, tri, hits);    break;
+#endif
+        default:    dd_rect_batch_bottoms_in_triangle_scalar(batch, count, tri, hits); break;
+    }
+}
+
+/**
+ * @brief   Marks which rectangles contain a point, through the widest
+ *          kernel the CPU supports
+ * @param   batch
+ *          The rectangles to test
+ * @param   count
+ *          Number of rectangles, from the start of the batch, to test
+ * @param   pt
+ *          The point to look for
+ * @param   hits
+ *          Bitmask to set the bit of every rectangle containing the
+ *          point in; other bits are left as they were
+ */
+void dd_rect_batch_containing_point(const DDRectBatch *batch, int count,
+                                    const point2d *pt, uint64_t *hits)
+{
+    switch (dd_collision_kernel())
+    {
+#if DD_COLLISION_X86
+        case DDCOLLISION_AVX:   dd_containing_point_avx(batch, count, pt, hits);        break;
+        case DDCOLLISION_SSE:   dd_containing_point_sse(batch, count, pt, hits);        break;
+#endif
+        default:    dd_rect_batch_containing_point_scalar(batch, count, pt, hits);      break;
+    }
+}
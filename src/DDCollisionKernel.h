@@ -0,0 +1,79 @@
+/**
+ * @file    DDCollisionKernel.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines batch collision tests that check many darts at
+ *          once rather than one collideWithSprite: message at a time.
+ *          Darts are copied into a structure-of-arrays batch and
+ *          tested four (SSE) or eight (AVX) at a time, picked by what
+ *          the CPU running the game supports, with a scalar fallback,
+ *          giving a hit bitmask with one bit per dart.
+ * @note    Each test gives the same answer as the SwinGame geometry
+ *          function it stands in for, so acting on the bitmask plays
+ *          out exactly as the per-dart path would.
+ */
+
+#ifndef DDCollisionKernel_h
+#define DDCollisionKernel_h
+
+#include <stdint.h>
+
+// Import SwinGame types (for rectangle, triangle and point2d)
+#include "Types.h"
+
+/**
+ * @brief   Most rectangles a DDRectBatch can hold (a multiple of 64,
+ *          so the hit bitmask is a whole number of words)
+ */
+#define DD_RECT_BATCH_CAPACITY 256
+
+/**
+ * @brief   Number of 64-bit words in a hit bitmask for a full batch
+ */
+#define DD_HIT_MASK_WORDS (DD_RECT_BATCH_CAPACITY / 64)
+
+/**
+ * @enum    DDCollisionKernel
+ * @brief   The ways a batch test can be carried out
+ */
+typedef enum DDCollisionKernel
+{
+    DDCOLLISION_SCALAR, //!< One rectangle at a time
+    DDCOLLISION_SSE,    //!< Four rectangles at a time
+    DDCOLLISION_AVX     //!< Eight rectangles at a time
+} DDCollisionKernel;
+
+/**
+ * @struct  DDRectBatch
+ * @brief   Rectangles (e.g. dart collision masks) laid out as one
+ *          array per field so that several can be tested at once.
+ */
+typedef struct DDRectBatch
+{
+    float   x[DD_RECT_BATCH_CAPACITY];      //!< Left of each rectangle
+    float   y[DD_RECT_BATCH_CAPACITY];      //!< Top of each rectangle
+    float   width[DD_RECT_BATCH_CAPACITY];  //!< Width of each rectangle
+    float   height[DD_RECT_BATCH_CAPACITY]; //!< Height of each rectangle
+    int     count;                          //!< Number of rectangles in the batch
+} DDRectBatch;
+
+void    dd_rect_batch_clear(DDRectBatch *batch);
+int     dd_rect_batch_add(DDRectBatch *batch, const rectangle *rect);
+
+void    dd_hit_mask_clear(uint64_t *hits, int count);
+int     dd_hit_mask_test(const uint64_t *hits, int index);
+
+void    dd_rect_batch_bottoms_in_triangle(const DDRectBatch *batch, int count,
+                                          const triangle *tri, uint64_t *hits);
+void    dd_rect_batch_bottoms_in_triangle_scalar(const DDRectBatch *batch, int count,
+                                                 const triangle *tri, uint64_t *hits);
+void    dd_rect_batch_containing_point(const DDRectBatch *batch, int count,
+                                       const point2d *pt, uint64_t *hits);
+void    dd_rect_batch_containing_point_scalar(const DDRectBatch *batch, int count,
+                                              const point2d *pt, uint64_t *hits);
+
+DDCollisionKernel   dd_collision_kernel(void);
+int                 dd_collision_use_kernel(DDCollisionKernel kernel);
+const char          *dd_collision_kernel_name(DDCollisionKernel kernel);
+
+#endif
@@ -15,9 +15,15 @@ typedef enum DDCollisionMaskType
  * @date    10 Sep 2013
  * @brief   Defines the collision mask object for objects that
  *          require collisions.
+ * @note    The shape is held by value as a SwinGame rectangle or
+ *          triangle struct and is moved in place, so moving a mask
+ *          each frame allocates nothing.
  */
 #import <Foundation/Foundation.h>
 
+// Import SwinGame types (for rectangle, triangle and point2d)
+#import "Types.h"
+
 // Import DDDirection Enumeration
 #import "DDDirection.h"
 
@@ -27,33 +33,36 @@ typedef enum DDCollisionMaskType
 @interface DDCollisionMask : NSObject
 {
     // Declare ivars
-    id          _maskShape; //!< Defines the collision mask shape required for
-                            //!< this DDCollisionMask to have.
-                            //!< @note  We use id type here since
-                            //!<        we're not sure which kind
-                            //!<        of SG shape we're going to
-                            //!<        be initialised with.
-    NSArray*    _points;    //!< Defines a collection of whereabouts each of the
-                            //!< points in this mask's shape are.
+    DDCollisionMaskType _type;  //!< Defines which of the shapes below this mask uses
+    rectangle           _rect;  //!< Defines the mask's shape when it is a RECTANGLE
+    triangle            _tri;   //!< Defines the mask's shape when it is a TRIANGLE
 }
 
-@property (readonly)   NSArray *points;     //!< Defines readonly access to the points of the
-                                            //!< collision mask shape, used by DDBalloon to
-                                            //!< access each of its triangular collision
-                                            //!< points in its collision triangle.
-@property (readonly)   id       shape;      //!< Defines readonly access to the shape of the
-                                            //!< collision mask (whatever that shape object
-                                            //!< may be---hence the id type to return any
-                                            //!< kind of object!).
-                                            //!< Used by DDCollidable objects to determine
-                                            //!< overlapping of collision mask shapes.
+@property (readonly)   DDCollisionMaskType type;    //!< Defines readonly access to which kind of
+                                                    //!< shape this collision mask is.
+@property (readonly)   const rectangle*    rect;    //!< Defines readonly access to the rectangle of
+                                                    //!< a RECTANGLE mask, ready to hand to the
+                                                    //!< SwinGame geometry functions.
+                                                    //!< @note  Points into the mask, so it is only
+                                                    //!<        valid while the mask is alive.
+@property (readonly)   const triangle*     tri;     //!< Defines readonly access to the triangle of
+                                                    //!< a TRIANGLE mask, used by DDBalloon and
+                                                    //!< anything colliding with it.
+                                                    //!< @note  Points into the mask, so it is only
+                                                    //!<        valid while the mask is alive.
 
 // Declare methods
+-(id)   initAsRectangle:(rectangle) rect;
+-(id)   initAsTriangle:(triangle) tri;
 -(id)   initAsRectangleAtPointA:(SGPoint2D*) pointA pointB:(SGPoint2D*) pointB;
 -(id)   initAsTriangleAtPointA:(SGPoint2D*) pointA
                         pointB:(SGPoint2D*) pointB
                         pointC:(SGPoint2D*) pointC;
+-(void) moveByX:(float) dx y:(float) dy;
+-(void) moveToX:(float) x y:(float) y;
 -(void) moveInDirection:(DDDirection)coord atSpeed:(int) speed;
--(void) updateWithPoints:(NSArray*)points;
+-(void) updateWithRectangle:(rectangle) rect;
+-(void) updateWithTriangle:(triangle) tri;
++(void) applyMatrix:(const matrix2d*) m toMasks:(NSArray*) masks;
 
 @end
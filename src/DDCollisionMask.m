@@ -8,14 +8,35 @@
 
 // Import SwinGame Framework
 #import "SwinGame.h"
+#import "GeometryInline.h"
 
 // Import my interface
 #import "DDCollisionMask.h"
 
+// Import the batch transforms (for applyMatrix:toMasks:)
+#import "DDTransformKernel.h"
+
 @implementation DDCollisionMask
 
-@synthesize points = _points;
-@synthesize shape  = _maskShape;
+@synthesize type = _type;
+
+/**
+ * @brief   Manual synthesis for the rectangle of the mask
+ * @return  A pointer to this mask's rectangle
+ */
+-(const rectangle*) rect
+{
+    return &_rect;
+}
+
+/**
+ * @brief   Manual synthesis for the triangle of the mask
+ * @return  A pointer to this mask's triangle
+ */
+-(const triangle*) tri
+{
+    return &_tri;
+}
 
 /**
  * @brief   Manual synthesis for centre of mask which
@@ -24,19 +45,49 @@
  *          or a rectangle.
  * @return  The centrepoint of the shape of the collison mask
  */
--(SGPoint2D*) maskCentre
+-(point2d) maskCentre
 {
+    // For Triangles
+    if (_type == TRIANGLE)
+    {
+        return triangle_barycenter_inline(&_tri);
+    }
     // For Rectangles
-    if ([_maskShape isKindOfClass:[SGRectangle class]])
+    return rectangle_center_inline(&_rect);
+}
+
+/**
+ * @brief   Constructor for a rectangle-shape collision
+ *          mask, taking in the rectangle itself
+ * @param   rect
+ *          The rectangle this mask covers
+ * @return  The class's self pointer
+ */
+-(id)initAsRectangle:(rectangle) rect
+{
+    if (self = [super init])
     {
-        return [SGGeometry rectangleCenter:(SGRectangle*)_maskShape];
+        _type   = RECTANGLE;
+        _rect   = rect;
     }
-    // For Triangles
-    if ([_maskShape isKindOfClass:[SGTriangle class]])
+    return self;
+}
+
+/**
+ * @brief   Constructor for a triangle-shape collision
+ *          mask, taking in the triangle itself
+ * @param   tri
+ *          The triangle this mask covers
+ * @return  The class's self pointer
+ */
+-(id)initAsTriangle:(triangle) tri
+{
+    if (self = [super init])
     {
-        return [SGGeometry triangleBarycenter:(SGTriangle*)_maskShape];
+        _type   = TRIANGLE;
+        _tri    = tri;
     }
-    return nil;
+    return self;
 }
 
 /**
@@ -50,16 +101,7 @@
  */
 -(id)initAsRectangleAtPointA:(SGPoint2D*) pointA pointB:(SGPoint2D*) pointB
 {
-    if (self = [super init])
-    {
-        _points     = [[NSMutableArray alloc] initWithObjects:pointA, pointB, nil];
-        // Allocate memory so that the NSObject-typed variable
-        // now holds a SGRectangle; i.e. assignment polymorphism
-        _maskShape  = [[SGRectangle alloc] init];
-        _maskShape  = [SGGeometry createRectangle:pointA
-                                               to:pointB];
-    }
-    return self;
+    return [self initAsRectangle:create_rectangle_for_points_byval(pointA.data, pointB.data)];
 }
 
 /**
@@ -77,21 +119,52 @@
                      pointB:(SGPoint2D*) pointB
                      pointC:(SGPoint2D*) pointC
 {
-    if (self = [super init])
+    triangle tri = { { pointA.data, pointB.data, pointC.data } };
+    return [self initAsTriangle:tri];
+}
+
+/**
+ * @brief   Moves every point in the mask by the given offset,
+ *          in place
+ * @param   dx
+ *          Distance to move along the x axis
+ * @param   dy
+ *          Distance to move along the y axis
+ */
+-(void) moveByX:(float) dx y:(float) dy
+{
+    if (_type == RECTANGLE)
     {
-        _points     = [[NSMutableArray alloc] initWithObjects:pointA, pointB, pointC, nil];
-        // Allocate memory so that the NSObject-typed variable
-        // now holds a SGTriangle; i.e. assignment polymorphism
-        _maskShape  = [[SGTriangle alloc] init];
-        _maskShape  = [SGGeometry createTrianglePtA:pointA
-                                                ptB:pointB
-                                                ptC:pointC];
+        _rect.x += dx;
+        _rect.y += dy;
+    }
+    else
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            _tri.points[i].x += dx;
+            _tri.points[i].y += dy;
+        }
     }
-    return self;
 }
 
 /**
- * @brief   Moves every point in the _maskShape at a given speed
+ * @brief   Moves the mask so that its first point (the top-left
+ *          of a rectangle or the first point of a triangle) sits
+ *          at the given location, keeping its size and shape
+ * @param   x
+ *          Where the first point should be along the x axis
+ * @param   y
+ *          Where the first point should be along the y axis
+ */
+-(void) moveToX:(float) x y:(float) y
+{
+    if (_type == RECTANGLE) { [self moveByX:x - _rect.x          y:y - _rect.y]; }
+    else                    { [self moveByX:x - _tri.points[0].x y:y - _tri.points[0].y]; }
+}
+
+/**
+ * @brief   Moves every point in the mask at a given speed
  *          in a given direction.
  * @param   coord
  *          Direction for each point to move towards
@@ -100,34 +173,52 @@
  */
 -(void) moveInDirection:(DDDirection)coord atSpeed:(int) speed
 {
-    if (coord == DDLEFT)    { for (SGPoint2D* point in _points) point.x -= speed; }
-    if (coord == DDRIGHT)   { for (SGPoint2D* point in _points) point.x += speed; }
-    if (coord == DDUP)      { for (SGPoint2D* point in _points) point.y -= speed; }
-    if (coord == DDDOWN)    { for (SGPoint2D* point in _points) point.y += speed; }
-    [self updateWithPoints:_points];
+    if (coord == DDLEFT)    { [self moveByX:-speed y:0]; }
+    if (coord == DDRIGHT)   { [self moveByX: speed y:0]; }
+    if (coord == DDUP)      { [self moveByX:0 y:-speed]; }
+    if (coord == DDDOWN)    { [self moveByX:0 y: speed]; }
 }
 
 /**
- * @brief   Updates the position of the mask by iterating
- *          through every point on the shape and relocating
- *          it to the given points array.
- * @param   points
- *          What each of the local _points will be replaced with
+ * @brief   Replaces the rectangle of a RECTANGLE mask
+ * @param   rect
+ *          What the mask's rectangle will be replaced with
  */
--(void) updateWithPoints:(NSArray*)points
+-(void) updateWithRectangle:(rectangle) rect
 {
-    _points = points;
-    if      ([_maskShape isKindOfClass:[SGRectangle class]])
-    {
-        _maskShape = [SGGeometry rectangleFrom:[_points objectAtIndex:0]
-                                            to:[_points objectAtIndex:1]];
-    }
-    else if ([_maskShape isKindOfClass:[SGTriangle  class]])
+    _rect = rect;
+}
+
+/**
+ * @brief   Replaces the triangle of a TRIANGLE mask
+ * @param   tri
+ *          What the mask's triangle will be replaced with
+ */
+-(void) updateWithTriangle:(triangle) tri
+{
+    _tri = tri;
+}
+
+/**
+ * @brief   Transforms (e.g. rotates or scales) a whole set of masks
+ *          by a matrix, one mask at a time
+ * @note    A rotated rectangle has no SwinGame rectangle, so a
+ *          RECTANGLE mask becomes the smallest rectangle around
+ *          its transformed corners. Copying masks into a
+ *          DDTransformKernel batch to transform them together was
+ *          measured no faster than this, even with AVX.
+ * @param   m
+ *          The matrix to apply
+ * @param   masks
+ *          The DDCollisionMasks to transform, in place
+ */
++(void) applyMatrix:(const matrix2d*) m toMasks:(NSArray*) masks
+{
+    for (DDCollisionMask *mask in masks)
     {
-        _maskShape = [SGGeometry triangleFromPtA:[_points objectAtIndex:0]
-                                             ptB:[_points objectAtIndex:1]
-                                             ptC:[_points objectAtIndex:2]];
+        if (mask->_type == RECTANGLE) dd_transform_rectangles(m, &mask->_rect, 1);
+        else                          dd_transform_triangles(m, &mask->_tri, 1);
     }
 }
 
-@end
\ No newline at end of file
+@end
@@ -9,6 +9,15 @@
 
 #import <Foundation/Foundation.h>
 
+// Import the DDKeys type
+#import "DDInputLog.h"
+
+// Import the difficulty curve (for DDDifficulty)
+#import "DDDifficulty.h"
+
+// Import the frame profiler (for DDProfiler)
+#import "DDProfiler.h"
+
 // Forward reference classes referenced in interface
 @class DDCanvas, DDGame;
 
@@ -17,12 +26,51 @@
     // Declare ivars
     DDCanvas*       _menuCanvas;    //!< Canvas for menu-only items to be drawn on
     int             _highScore;     //!< High score value loaded on controller initialisation
+    int             _tickRate;      //!< Number of fixed simulation ticks run per second
+    int             _frameRate;     //!< Maximum number of frames drawn per second (where
+                                    //!< zero, frames are drawn as fast as possible)
+    float           _tickLength;    //!< Length of a single simulation tick in ms
+    float           _accumulator;   //!< Time in ms not yet consumed by a simulation tick
+    uint            _lastTicks;     //!< Ticks at the start of the previous update
+    DDKeys          _keys;          //!< Keys polled (or replayed) for the current frame
+    DDInputLog*     _recording;     //!< Input log being recorded, or nil
+    NSString*       _recordingPath; //!< Where _recording is written at the end of the session
+    DDInputLog*     _replay;        //!< Input log being replayed in place of the keyboard
+                                    //!< and clock, or nil
+    BOOL            _finished;      //!< Whether the replay has run out of frames
+    uint32_t        _seed;          //!< Random seed the next new game is played with
+    DDDifficulty    _difficulty;    //!< Difficulty curve every game's rounds follow
+    NSString*       _difficultyPath;//!< Where the difficulty table is loaded from
+    uint            _difficultyChecked;
+                                    //!< Ticks when the difficulty table was last checked
+                                    //!< for changes
+    DDProfiler      _profiler;      //!< Profiler every game's phases are timed into, written
+                                    //!< out on F12 and at the end of the session
+    BOOL            _autopilot;     //!< Whether the autopilot steers the balloon (and starts
+                                    //!< each new game) in place of the player
 }
 
+// Declare properties
+@property               int     tickRate;   //!< Allows access to the simulation tick rate,
+                                            //!< i.e. how often the game moves each second
+                                            //!< regardless of how fast frames are drawn
+@property               int     frameRate;  //!< Allows access to the frame rate cap, used
+                                            //!< to idle between frames rather than drawing
+                                            //!< identical frames
+@property   (readonly)  BOOL    finished;   //!< Readonly access to whether a replay has
+                                            //!< played every frame, used to end the
+                                            //!< main loop
+@property               BOOL    autopilot;  //!< Allows access to whether the autopilot
+                                            //!< plays instead of the player, for long
+                                            //!< unattended (soak) runs
+
 // Declare methods
 -(id)   init;
 -(void) update;
 -(void) newGame;
+-(void) recordToFile:(NSString*) path;
+-(BOOL) replayFromFile:(NSString*) path;
+-(void) endSession;
 +(void) killGame;
 
 @end
@@ -18,9 +18,41 @@
 #import "DDGame.h"
 #import "DDBalloon.h"
 #import "DDInterrupt.h"
+#import "DDBitmapCache.h"
+#import "DDSoundBank.h"
+
+/**
+ * @brief   Default number of simulation ticks per second; game speeds
+ *          are in pixels per tick, so this also sets how fast the game plays
+ */
+#define DD_DEFAULT_TICK_RATE    60
+
+/**
+ * @brief   How often (in ms) the difficulty table is checked for
+ *          changes, so that it can be tuned while the game runs
+ */
+#define DD_DIFFICULTY_CHECK_INTERVAL    1000
+
+/**
+ * @brief   Default cap on frames drawn per second
+ */
+#define DD_DEFAULT_FRAME_RATE   120
+
+/**
+ * @brief   Longest update (in ms) that the simulation will catch up on;
+ *          anything longer (e.g. the game over delay) is dropped rather
+ *          than run as a burst of ticks
+ */
+#define DD_MAX_FRAME_TIME       250
 
 @implementation DDController
 
+// Synthesize properties
+@synthesize frameRate = _frameRate;
+@synthesize tickRate  = _tickRate;
+@synthesize finished  = _finished;
+@synthesize autopilot = _autopilot;
+
 /**
  * @brief   Delcare the _currentGame and _inGame
  *          as static variables; this allows them
@@ -52,6 +84,29 @@ static BOOL     _inGame         = NO;
         _menuCanvas     = [[DDCanvas alloc] init];
         _inGame         = NO;
         _highScore      = [self readHighScore];
+        _frameRate      = DD_DEFAULT_FRAME_RATE;
+        _accumulator    = 0;
+        _lastTicks      = [SGUtils getTicks];
+        _keys           = 0;
+        _recording      = nil;
+        _replay         = nil;
+        _finished       = NO;
+        _autopilot      = NO;
+        _seed           = (uint32_t)time(NULL);
+        self.tickRate   = DD_DEFAULT_TICK_RATE;
+        dd_profile_init(&_profiler);
+        
+        // Start from the built-in rounds, then load the table over them
+        dd_difficulty_init(&_difficulty);
+        _difficultyPath = [[SGResources pathToResourceFilename:@"difficulty.txt"] retain];
+        [self checkDifficulty];
+        if (_difficulty.loadedTime == 0)
+        {
+            NSLog(@"No difficulty table at %@; using the built-in rounds", _difficultyPath);
+        }
+        
+        // Load every sound effect now so none is loaded mid-game
+        [DDSoundBank preload];
         
         // Play really annoying music endlessly
         [SGAudio playMusic:[[SGMusic alloc] initWithName:@"song" fromFile:@"mainsong2.ogg"]
@@ -63,10 +118,128 @@ static BOOL     _inGame         = NO;
 /**
  * @brief   Creates a new game (i.e. initalises a new
  *          DDGame object) to play
+ * @note    Each game takes the next seed in turn, so every game of a
+ *          session follows from the session's first seed
  */
 -(void)newGame
 {
-    _currentGame = [[DDGame alloc] init];
+    [_currentGame release];
+    _currentGame = [[DDGame alloc] initWithSeed:_seed++ difficulty:&_difficulty];
+    _currentGame.tickLength = _tickLength;
+    _currentGame.profiler   = &_profiler;
+    
+    // Replays run back to back, so don't hold the game over screen
+    if (_replay) { _currentGame.gameOverDelay = 0; }
+}
+
+/**
+ * @brief   Loads the difficulty table again if it has changed
+ *          since it was last loaded; a game in play picks the new
+ *          rounds up on its next tick (as does a replay of it, as
+ *          the new rounds are recorded)
+ * @note    This method is private
+ */
+-(void)checkDifficulty
+{
+    int result          = dd_difficulty_reload_if_changed(&_difficulty,
+                                                          [_difficultyPath UTF8String]);
+    _difficultyChecked  = [SGUtils getTicks];
+    
+    if (result == DD_DIFFICULTY_LOADED)
+    {
+        NSLog(@"Loaded %d difficulty rounds from %@", _difficulty.roundCount, _difficultyPath);
+        [_recording recordDifficulty:&_difficulty];
+    }
+    else if (result == DD_DIFFICULTY_UNREADABLE)
+    {
+        NSLog(@"Could not read %@; keeping the previous rounds", _difficultyPath);
+    }
+    else if (result != DD_DIFFICULTY_UNCHANGED)
+    {
+        NSLog(@"Bad round on line %d of %@; keeping the previous rounds", result, _difficultyPath);
+    }
+}
+
+/**
+ * @brief   Starts recording the session's input so that it can be
+ *          replayed by replayFromFile:, along with the difficulty
+ *          table it starts with. Must be called before the first game
+ *          is created.
+ * @param   path
+ *          Path of the input log to write when the session ends
+ */
+-(void)recordToFile:(NSString*) path
+{
+    _recording      = [[DDInputLog alloc] initWithSeed:_seed tickRate:_tickRate];
+    _recordingPath  = [path copy];
+    [_recording recordDifficulty:&_difficulty];
+}
+
+/**
+ * @brief   Replays a recorded session: the keyboard and clock are
+ *          replaced by the log's frames, which are run back to back
+ *          without idling, and the difficulty table by the log's
+ *          tables. Must be called before the first game is
+ *          created.
+ * @param   path
+ *          Path of the input log to replay
+ * @return  YES if the log was loaded
+ */
+-(BOOL)replayFromFile:(NSString*) path
+{
+    _replay = [[DDInputLog alloc] initWithContentsOfFile:path];
+    if (!_replay) { return NO; }
+    
+    self.tickRate = _replay.tickRate;
+    _seed         = _replay.seed;
+    NSLog(@"Replaying %lu frames from %@", (unsigned long)_replay.frameCount, path);
+    return YES;
+}
+
+/**
+ * @brief   Writes the profiler's recent samples next to the high score
+ *          file, as ddprofile.csv and as the Chrome trace ddprofile.json
+ * @note    This method is private
+ */
+-(void)writeProfile
+{
+    NSString* csvPath   = [NSString stringWithFormat:@"%@/ddprofile.csv",  [SGResources appPath]];
+    NSString* tracePath = [NSString stringWithFormat:@"%@/ddprofile.json", [SGResources appPath]];
+    
+    int written = dd_profile_write_csv(&_profiler, [csvPath UTF8String]);
+    if (written < 0 || dd_profile_write_trace(&_profiler, [tracePath UTF8String]) < 0)
+    {
+        NSLog(@"Could not write the profile to %@", [SGResources appPath]);
+        return;
+    }
+    NSLog(@"Wrote %d profile samples to %@ and %@", written, csvPath, tracePath);
+}
+
+/**
+ * @brief   Ends the session, logging the bitmap cache's counters and
+ *          writing out the profile, and the input log if recording
+ */
+-(void)endSession
+{
+    if (_profiler.head) { [self writeProfile]; }
+    
+    NSLog(@"Bitmap cache: %d loaded (%ld bytes), %d hits, %d misses",
+          [DDBitmapCache count], [DDBitmapCache bytes],
+          [DDBitmapCache hits], [DDBitmapCache misses]);
+    
+    if (_recording)
+    {
+        if ([_recording writeToFile:_recordingPath])
+        {
+            NSLog(@"Recorded %lu frames to %@", (unsigned long)_recording.frameCount,
+                  _recordingPath);
+        }
+        [_recording release];
+        [_recordingPath release];
+        _recording = nil;
+    }
+    [_replay release];
+    _replay = nil;
 }
 
 /**
@@ -78,25 +251,170 @@ static BOOL     _inGame         = NO;
  */
 +(void)killGame
 {
+    // Killed from within its own tick, so only let it go once the
+    // frame is over
+    [_currentGame autorelease];
     _currentGame    = nil;
     _inGame         = NO;
 }
 
 /**
- * @brief   Updates the controller, by either updating in-game
- *          elements or drawing the menu
+ * @brief   Gets the simulation tick rate (written by hand, as the
+ *          setter is, so the pair stays consistent)
+ * @return  Number of ticks per second
+ */
+-(int)tickRate
+{
+    return _tickRate;
+}
+
+/**
+ * @brief   Sets the simulation tick rate, recalculating the length
+ *          of a single tick
+ * @param   tickRate
+ *          Number of ticks per second; values below 1 are clamped to 1
+ */
+-(void)setTickRate:(int)tickRate
+{
+    _tickRate   = tickRate < 1 ? 1 : tickRate;
+    _tickLength = 1000.0f / _tickRate;
+    _currentGame.tickLength = _tickLength;
+}
+
+/**
+ * @brief   Updates the controller once per frame. Elapsed time is
+ *          banked in the accumulator and spent in fixed-length
+ *          simulation ticks, then the frame is drawn interpolated
+ *          between the last two ticks by whatever time is left over.
+ *          When replaying, the keys, number of ticks and difficulty
+ *          table reloads come from the input log instead.
  */
 -(void)update
 {
-    // Check for key presses
+    uint frameStart = [SGUtils getTicks];
+    int  ticks      = 0;
+    
+    if (_replay)
+    {
+        // Out of frames? Then the replay is over
+        if (![_replay nextFrameKeys:&_keys ticks:&ticks difficulty:&_difficulty])
+        {
+            _finished = YES;
+            return;
+        }
+    }
+    else
+    {
+        uint elapsed    = frameStart - _lastTicks;
+        _lastTicks      = frameStart;
+        
+        // Don't try to catch up on long stalls
+        if (elapsed > DD_MAX_FRAME_TIME) { elapsed = DD_MAX_FRAME_TIME; }
+        _accumulator += elapsed;
+        
+        // Work out as many fixed ticks as the elapsed time allows
+        while (_accumulator >= _tickLength)
+        {
+            ticks++;
+            _accumulator -= _tickLength;
+        }
+        
+        // Pick up any tuning of the difficulty table, ahead of this
+        // frame so that a replay loads it before the same tick
+        if (frameStart - _difficultyChecked >= DD_DIFFICULTY_CHECK_INTERVAL)
+        {
+            [self checkDifficulty];
+        }
+        
+        _keys = _autopilot ? [self autopilotKeys] : [self pollKeys];
+        [_recording recordFrameWithKeys:_keys ticks:ticks];
+        
+        // Dump the profile on F12 (not a game key, so never recorded)
+        if ([SGInput keyTyped:VK_F12]) { [self writeProfile]; }
+    }
+    
+    // Check for key presses (typed keys only fire once per frame)
     [self checkKeys];
+    _currentGame.keys = _keys;
+    
+    // Run this frame's fixed ticks
+    for (int i = 0; i < ticks; i++)
+    {
+        [self tick];
+    }
     
+    [self drawWithInterpolation:_replay ? 1.0f : _accumulator / _tickLength];
+    
+    // Idle for the rest of this frame instead of redrawing it
+    // (unless replaying, which runs as fast as it can)
+    if (_frameRate > 0 && !_replay)
+    {
+        uint spent = [SGUtils getTicks] - frameStart;
+        uint frameLength = 1000 / _frameRate;
+        if (spent < frameLength) { [SGUtils delay:frameLength - spent]; }
+    }
+}
+
+/**
+ * @brief   Polls the keyboard for every key the game responds to
+ * @note    This method is private
+ * @return  The keys held or typed this frame
+ */
+-(DDKeys)pollKeys
+{
+    DDKeys keys = 0;
+    if ([SGInput keyDown:VK_LEFT])      { keys |= DDKEY_LEFT;  }
+    if ([SGInput keyDown:VK_RIGHT])     { keys |= DDKEY_RIGHT; }
+    if ([SGInput keyTyped:VK_P])        { keys |= DDKEY_P;     }
+    if ([SGInput keyDown:VK_S])         { keys |= DDKEY_S;     }
+    if ([SGInput keyDown:VK_SPACE])     { keys |= DDKEY_SPACE; }
+    if ([SGInput keyDown:VK_Q])         { keys |= DDKEY_Q;     }
+    if ([SGInput keyTyped:VK_C])        { keys |= DDKEY_C;     }
+    if ([SGInput keyTyped:VK_H])        { keys |= DDKEY_H;     }
+    return keys;
+}
+
+/**
+ * @brief   Polls the keyboard, but lets the autopilot steer: it holds
+ *          left or right for the balloon in game, and types P out of
+ *          game so that every game over is followed by a new game
+ * @note    This method is private
+ * @return  The keys held or typed this frame
+ */
+-(DDKeys)autopilotKeys
+{
+    DDKeys keys = [self pollKeys] & ~(DDKEY_LEFT | DDKEY_RIGHT);
+    if (_inGame) { return keys | [_currentGame autopilotKeys]; }
+    return keys | DDKEY_P;
+}
+
+/**
+ * @brief   Advances the game by one fixed simulation tick; the game
+ *          applies the held keys itself, so that the balloon moves at
+ *          the same rate as everything else
+ * @note    This method is private
+ */
+-(void)tick
+{
+    if (!_inGame) { return; }
+    
+    [_currentGame updateGame];
+}
+
+/**
+ * @brief   Draws either the current game or the menu
+ * @note    This method is private
+ * @param   alpha
+ *          Fraction of a tick elapsed since the last simulation tick
+ */
+-(void)drawWithInterpolation:(float)alpha
+{
     BOOL backCol;
     
     if (_currentGame)   { backCol = NO;  }
     else                { backCol = YES; }
     
-    if (_inGame) { [_currentGame updateGame]; }
+    if (_inGame) { [_currentGame drawGameWithInterpolation:alpha]; }
     else
     {
         [_menuCanvas drawWithItems:@{@"menu": @YES,
@@ -112,25 +430,20 @@ static BOOL     _inGame         = NO;
 /**
  * @brief   Checks for any key presses for both in-game/non-in-game
  *          functionality
- 
+ * @note    Held in-game keys (left/right) are checked per tick instead
  */
 -(void)checkKeys
 {
-    if ([SGInput keyTyped:VK_P])
+    if (_keys & DDKEY_P)
     {
         // Create a game if there is no game
         if (_currentGame == nil) { [self newGame]; }
-        [SGAudio playSoundEffect:[[SGSoundEffect alloc] initFromFile:@"menu.ogg"]];
+        [DDSoundBank play:DDSOUND_MENU];
         _inGame = !_inGame;
     }
-    if (_inGame)
-    {
-        if ([SGInput keyDown:VK_LEFT])  { [_currentGame moveBalloonInDirection:DDLEFT]; }
-        if ([SGInput keyDown:VK_RIGHT]) { [_currentGame moveBalloonInDirection:DDRIGHT]; }
-    }
-    else
+    if (!_inGame)
     {
-        if ([SGInput keyDown:VK_S]) { [self newHighScoreFromCorruption:YES]; }
+        if (_keys & DDKEY_S) { [self newHighScoreFromCorruption:YES]; }
     }
 }
 
@@ -22,10 +22,18 @@
     // Declare ivars
     int                 _speed;         //!< Declares the dart's speed
     DDCollisionMask*    _collisionMask; //!< Declares the collision mask for the dart
+    int                 _poolIndex;     //!< Declares the dart's slot in its DDDartPool
+                                        //!< (-1 when parked)
 }
 
+// Declare properties
+@property   int     poolIndex;          //!< Allows DDDartPool to track where this
+                                        //!< dart lives in the pool
+
 // Declare methods
 -(id)   initInGame:(DDGame*) game;
+-(id)   initInGame:(DDGame*) game atX:(int) xPos y:(int) yPos;
 -(void) fall;
+-(void) rearmAtX:(int) xPos y:(int) yPos;
 
 @end
@@ -9,6 +9,7 @@
 
 // Import SwinGame Framework
 #import "SwinGame.h"
+#import "GeometryInline.h"
 
 // Import my interface
 #import "DDDart.h"
@@ -21,8 +22,11 @@
 
 @implementation DDDart
 
+// Synthesize properties
+@synthesize poolIndex = _poolIndex;
+
 /**
- * @brief   Causes the dart to fall down by its speed
+ * @brief   Constructor for a dart at a random spot above the screen
  * @param   game
  *          Game to initialise the DDBalloon within for access
  *          to that Game's game canvas (allows my parent to
@@ -30,20 +34,68 @@
  * @return  The class's self pointer
  */
 -(id)initInGame:(DDGame*) game
+{
+    int yPos = -100 - dd_random_upto(game.rng, 200);
+    int xPos = dd_random_upto(game.rng, [SGGraphics screenWidth]);
+    return [self initInGame:game atX:xPos y:yPos];
+}
+
+/**
+ * @brief   Constructor for a dart centred on the given spot
+ * @param   game
+ *          Game to initialise the DDBalloon within for access
+ *          to that Game's game canvas (allows my parent to
+ *          dynamically add my sprite to that canvas at runtime)
+ * @param   xPos
+ *          Where the dart's centre starts along the x axis
+ * @param   yPos
+ *          Where the dart's centre starts along the y axis
+ * @return  The class's self pointer
+ */
+-(id)initInGame:(DDGame*) game atX:(int) xPos y:(int) yPos
 {
     if (self = [super initWithBitmapFile:@"dart.png"
-                               atStaticY:-100 - [SGUtils rndUpto:200]
+                                     atX:xPos
+                                     atY:yPos
                                   inGame:game]) {
+        _poolIndex      = -1;
         _collisionMask  = [[DDCollisionMask alloc]
-                           initAsRectangleAtPointA:_position
-                                            pointB:[SGGeometry pointAtX:_position.x
-                                                                        +_bitmap.width
-                                                                      y:_position.y
-                                                                        +_bitmap.height]];
+                           initAsRectangle:rectangle_from(_position.x,
+                                                          _position.y,
+                                                          _bitmap.width,
+                                                          _bitmap.height)];
     }
     return self;
 }
 
+/**
+ * @brief   Releases the dart's collision mask (only once the pool
+ *          that re-arms it is done with it)
+ */
+-(void) dealloc
+{
+    [_collisionMask release];
+    [super dealloc];
+}
+
+/**
+ * @brief   Puts a parked dart back into play centred on the given
+ *          spot, as if it were newly initialised there
+ * @param   xPos
+ *          Where the dart's centre restarts along the x axis
+ * @param   yPos
+ *          Where the dart's centre restarts along the y axis
+ */
+-(void)rearmAtX:(int) xPos y:(int) yPos
+{
+    _position.x     = xPos - _bitmap.width/2;
+    _position.y     = yPos - _bitmap.height/2;
+    _lastPosition   = _position.data;
+    _active         = YES;
+    
+    [_collisionMask moveToX:_position.x y:_position.y];
+}
+
 /**
  * @brief   Causes the dart to fall down by its speed
  * @note    This method is required by the DDFallable protocol
@@ -52,20 +104,13 @@
 {
     _speed = _game.speed;
     _position.y += _speed;
-    NSArray* pts = [[NSArray alloc] initWithObjects:_position,
-                                                    [SGGeometry pointAtX:_position.x
-                                                                         +_bitmap.width
-                                                                       y:_position.y
-                                                                         +_bitmap.height],
-                                                    nil];
-    [_collisionMask updateWithPoints:pts];
+    [_collisionMask moveByX:0 y:_speed];
     // Automatically kill myself once off bottom of screen
     if (_position.y > [SGGraphics screenHeight])
     {
         [self kill];
         self = nil;
     }
-    [pts release];
 }
 
 /**
@@ -91,10 +136,9 @@
 {
     // This only needs to work with rectangles
     // since all other sprites have rect. col msks
-    SGPoint2D* colPoint = [SGGeometry rectangleCenterBottom:
-                                            (SGRectangle*)[sprite getCollisionMask].shape];
+    point2d colPoint = rectangle_center_bottom_inline([sprite getCollisionMask].rect);
     
-    if ([SGGeometry point:colPoint inRect:_collisionMask.shape])
+    if (point_in_rect(&colPoint, _collisionMask.rect))
     {
         [self kill];
         self = nil;
@@ -0,0 +1,63 @@
+/**
+ * @class   DDDartPool
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a pool of darts which are re-armed in place
+ *          rather than allocated and killed every time one falls
+ *          off the screen. The pool grows to hold as many darts
+ *          as a round asks for.
+ */
+
+#import <Foundation/Foundation.h>
+
+// Import SwinGame types (for point2d)
+#import "Types.h"
+
+/**
+ * @brief   Number of darts the pool has room for at first; the room
+ *          doubles whenever a round asks for more
+ */
+#define DD_DART_POOL_CAPACITY 32
+
+/**
+ * @brief   Number of spawn points drawn from the game's random numbers
+ *          at once
+ */
+#define DD_DART_SPAWN_BATCH 32
+
+// Forward reference classes referenced in interface
+@class DDDart, DDGame;
+
+@interface DDDartPool : NSObject
+{
+    // Declare ivars
+    DDDart**    _darts;                         //!< Every dart this pool has created. Slots
+                                                //!< [0, _count) hold live darts; slots
+                                                //!< [_count, _allocated) hold parked darts
+                                                //!< waiting to be re-armed
+    int         _count;                         //!< Number of live darts
+    int         _allocated;                     //!< Number of darts created so far
+    int         _capacity;                      //!< Number of darts _darts has room for
+    uint        _hits;                          //!< Spawns served by re-arming a parked dart
+    uint        _misses;                        //!< Spawns that had to allocate a new dart
+    DDGame*     _game;                          //!< The game darts are created within
+    point2d     _spawnPoints[DD_DART_SPAWN_BATCH];
+                                                //!< Where the next darts spawn, drawn in
+                                                //!< bulk from the game's random numbers
+    int         _spawnCursor;                   //!< Index of the next unused spawn point
+}
+
+// Declare properties
+@property   (readonly)  int     count;      //!< Readonly access to the number of live darts
+@property   (readonly)  uint    hits;       //!< Readonly access to the pool hit counter
+                                            //!< for profiling
+@property   (readonly)  uint    misses;     //!< Readonly access to the pool miss counter
+                                            //!< for profiling
+
+// Declare methods
+-(id)       initInGame:(DDGame*) game;
+-(DDDart*)  spawn;
+-(void)     despawn:(DDDart*) dart;
+-(DDDart*)  dartAtIndex:(int) index;
+
+@end
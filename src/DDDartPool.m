@@ -0,0 +1,148 @@
+/**
+ * @class   DDDartPool
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a pool of darts which are re-armed in place
+ *          rather than allocated and killed every time one falls
+ *          off the screen. The pool grows to hold as many darts
+ *          as a round asks for.
+ */
+
+// Import my interface
+#import "DDDartPool.h"
+
+// Import SwinGame Framework
+#import "SwinGame.h"
+
+// Import interfaces of other classes used
+#import "DDDart.h"
+#import "DDGame.h"
+
+@implementation DDDartPool
+
+// Synthesize properties
+@synthesize count   = _count;
+@synthesize hits    = _hits;
+@synthesize misses  = _misses;
+
+/**
+ * @brief   The constructor for DDDartPool, which starts empty;
+ *          darts are created on demand
+ * @param   game
+ *          Game to create darts within
+ * @return  The class's self pointer
+ */
+-(id)initInGame:(DDGame*) game
+{
+    if (self = [super init])
+    {
+        _count      = 0;
+        _allocated  = 0;
+        _capacity   = DD_DART_POOL_CAPACITY;
+        _darts      = malloc(sizeof(DDDart*) * _capacity);
+        _hits       = 0;
+        _misses     = 0;
+        _game       = game;
+        _spawnCursor = DD_DART_SPAWN_BATCH;
+    }
+    return self;
+}
+
+/**
+ * @brief   Releases every dart this pool created
+ */
+-(void)dealloc
+{
+    for (int i = 0; i < _allocated; i++) [_darts[i] release];
+    free(_darts);
+    [super dealloc];
+}
+
+/**
+ * @brief   Returns where the next dart should spawn, drawing a batch
+ *          of spawn points at once when they run out
+ * @note    This method is private
+ * @return  The centre of the next dart, above the screen
+ */
+-(point2d)nextSpawnPoint
+{
+    if (_spawnCursor == DD_DART_SPAWN_BATCH)
+    {
+        dd_random_spawn_points(_game.rng, _spawnPoints, DD_DART_SPAWN_BATCH,
+                               [SGGraphics screenWidth], -100, 200);
+        _spawnCursor = 0;
+    }
+    return _spawnPoints[_spawnCursor++];
+}
+
+/**
+ * @brief   Brings a dart into play, re-arming a parked dart where
+ *          there is one and only allocating otherwise
+ * @return  The live dart
+ */
+-(DDDart*)spawn
+{
+    DDDart* dart;
+    
+    // Pool hit: re-arm the first parked dart in place
+    if (_count < _allocated)
+    {
+        point2d at = [self nextSpawnPoint];
+        dart = _darts[_count];
+        [dart rearmAtX:at.x y:at.y];
+        _hits++;
+    }
+    // Pool miss: make another, making room for it if need be
+    else
+    {
+        if (_allocated == _capacity)
+        {
+            _capacity *= 2;
+            _darts = realloc(_darts, sizeof(DDDart*) * _capacity);
+        }
+        point2d at = [self nextSpawnPoint];
+        dart = [[DDDart alloc] initInGame:_game atX:at.x y:at.y];
+        _darts[_allocated++] = dart;
+        _misses++;
+    }
+    
+    dart.poolIndex = _count++;
+    return dart;
+}
+
+/**
+ * @brief   Takes a dart out of play by swapping it with the last
+ *          live dart and parking it, so no array is scanned or shifted
+ * @param   dart
+ *          The dart to park; darts that are already parked are ignored
+ */
+-(void)despawn:(DDDart*) dart
+{
+    int index = dart.poolIndex;
+    
+    // Already parked (e.g. killed twice in one tick)?
+    if (index < 0 || index >= _count || _darts[index] != dart) return;
+    
+    // Move the last live dart into the hole, and this dart to the end
+    int last            = --_count;
+    _darts[index]       = _darts[last];
+    _darts[last]        = dart;
+    _darts[index].poolIndex = index;
+    dart.poolIndex      = -1;
+    dart.active         = NO;
+}
+
+/**
+ * @brief   Returns a live dart
+ * @param   index
+ *          Index from 0 to count - 1. Despawning a dart moves the
+ *          last live dart into its index, so iterate from the end
+ *          when darts may despawn during iteration.
+ * @return  The live dart at that index
+ */
+-(DDDart*)dartAtIndex:(int) index
+{
+    return _darts[index];
+}
+
+@end
@@ -0,0 +1,199 @@
+/**
+ * @file    DDDifficulty.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the built-in difficulty curve and the loading and
+ *          compiling of difficulty table files.
+ */
+
+#include "DDDifficulty.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/**
+ * @brief   Rounds used until (or if) a table file loads, and the
+ *          rounds Resources/difficulty.txt ships with
+ */
+static const DDRound dd_builtin_rounds[] =
+{
+    //  score   darts   speed   health  cloud
+    {   0,      3,      3,      0.00f,  0.00f   },  // ROUND 1
+    {   10,     4,      3,      0.50f,  0.00f   },  // ROUND 2
+    {   20,     5,      4,      0.10f,  0.10f   },  // ROUND 3
+    {   30,     8,      4,      0.20f,  0.20f   },  // ROUND 4
+    {   40,     10,     5,      0.30f,  0.30f   },  // ROUND 5
+    {   50,     12,     5,      0.50f,  0.50f   },  // ROUND 6
+    {   60,     14,     6,      0.20f,  0.60f   },  // ROUND 7
+    {   70,     18,     7,      0.20f,  0.65f   },  // ROUND 8
+    {   80,     30,     7,      0.20f,  0.65f   }   // GREATER THAN ROUND 8
+};
+
+/**
+ * @brief   Checks that a round is in range and comes after the last
+ * @param   round
+ *          The round to check
+ * @param   previous
+ *          The round before it, or NULL if it is the first
+ * @return  1 if the round is valid, otherwise 0
+ */
+static int dd_difficulty_round_is_valid(const DDRound *round, const DDRound *previous)
+{
+    return round->score >= 0 && round->score <= DD_DIFFICULTY_MAX_SCORE &&
+           (!previous || round->score > previous->score) &&
+           round->maxDarts >= 0 && round->speed > 0 &&
+           round->healthChance >= 0 && round->healthChance <= 1 &&
+           round->cloudChance  >= 0 && round->cloudChance  <= 1;
+}
+
+/**
+ * @brief   Replaces a curve's rounds and fills in its dense lookup
+ * @param   curve
+ *          The curve to compile into
+ * @param   rounds
+ *          Valid rounds in order of score
+ * @param   count
+ *          Number of rounds
+ */
+static void dd_difficulty_compile(DDDifficulty *curve, const DDRound *rounds, int count)
+{
+    int r = 0;
+
+    memcpy(curve->rounds, rounds, count * sizeof(DDRound));
+    curve->roundCount = count;
+
+    // Scores from the last round's up are never looked up densely
+    for (int score = 0; score < rounds[count - 1].score; score++)
+    {
+        while (r + 1 < count && score >= rounds[r + 1].score) { r++; }
+        curve->roundAt[score] = r;
+    }
+    curve->generation++;
+}
+
+/**
+ * @brief   Compiles the built-in rounds into a curve
+ * @param   curve
+ *          The curve to initialise
+ */
+void dd_difficulty_init(DDDifficulty *curve)
+{
+    memset(curve, 0, sizeof(DDDifficulty));
+    dd_difficulty_compile(curve, dd_builtin_rounds,
+                          sizeof(dd_builtin_rounds) / sizeof(DDRound));
+}
+
+/**
+ * @brief   Replaces a curve's rounds with rounds from elsewhere (such as
+ *          an input log being replayed)
+ * @param   curve
+ *          The curve to replace the rounds of; left as it was if the
+ *          rounds are bad
+ * @param   rounds
+ *          Rounds in order of score
+ * @param   count
+ *          Number of rounds
+ * @return  DD_DIFFICULTY_LOADED, or the number of the first bad round
+ *          (or 1, if there were no rounds or too many)
+ */
+int dd_difficulty_set_rounds(DDDifficulty *curve, const DDRound *rounds, int count)
+{
+    if (count <= 0 || count > DD_DIFFICULTY_MAX_ROUNDS) { return 1; }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (!dd_difficulty_round_is_valid(&rounds[i], i > 0 ? &rounds[i - 1] : NULL))
+        {
+            return i + 1;
+        }
+    }
+    dd_difficulty_compile(curve, rounds, count);
+    return DD_DIFFICULTY_LOADED;
+}
+
+/**
+ * @brief   Loads a difficulty table file over a curve. Each line is a
+ *          round: the score it starts at, maximum darts, speed, health
+ *          kit chance and cloud chance, separated by whitespace. Blank
+ *          lines and anything after a # are ignored.
+ * @param   curve
+ *          The curve to load into; left as it was if the file is bad
+ * @param   path
+ *          Path of the table file
+ * @return  DD_DIFFICULTY_LOADED, DD_DIFFICULTY_UNREADABLE if the file
+ *          could not be opened, or the number of the first bad line
+ *          (or of the last line, if there were no rounds)
+ */
+int dd_difficulty_load(DDDifficulty *curve, const char *path)
+{
+    DDRound     rounds[DD_DIFFICULTY_MAX_ROUNDS];
+    int         count = 0, line = 0;
+    char        text[256];
+    struct stat info;
+    FILE        *file = fopen(path, "r");
+
+    if (!file) { return DD_DIFFICULTY_UNREADABLE; }
+
+    while (fgets(text, sizeof(text), file))
+    {
+        DDRound round;
+        char    extra;
+        char    *comment = strchr(text, '#');
+
+        line++;
+        if (comment) { *comment = '\0'; }
+
+        // Blank (or comment only) line?
+        if (sscanf(text, " %c", &extra) != 1) { continue; }
+
+        // Exactly five fields, in range, each round after the last
+        if (count == DD_DIFFICULTY_MAX_ROUNDS ||
+            sscanf(text, "%d %d %d %f %f %c", &round.score, &round.maxDarts, &round.speed,
+                   &round.healthChance, &round.cloudChance, &extra) != 5 ||
+            !dd_difficulty_round_is_valid(&round, count > 0 ? &rounds[count - 1] : NULL))
+        {
+            fclose(file);
+            return line;
+        }
+        rounds[count++] = round;
+    }
+    fclose(file);
+
+    if (count == 0) { return line > 0 ? line : 1; }
+
+    dd_difficulty_compile(curve, rounds, count);
+    if (stat(path, &info) == 0)
+    {
+        curve->loadedTime = info.st_mtime;
+        curve->loadedSize = (long)info.st_size;
+    }
+    return DD_DIFFICULTY_LOADED;
+}
+
+/**
+ * @brief   Loads a difficulty table file over a curve again if it has
+ *          changed since it was last loaded, so that it can be tuned
+ *          while the game runs
+ * @param   curve
+ *          The curve to reload into; left as it was if the file is bad
+ * @param   path
+ *          Path of the table file
+ * @return  DD_DIFFICULTY_UNCHANGED if the file has not changed (or has
+ *          gone), otherwise as dd_difficulty_load
+ */
+int dd_difficulty_reload_if_changed(DDDifficulty *curve, const char *path)
+{
+    struct stat info;
+
+    if (stat(path, &info) != 0 ||
+        (info.st_mtime == curve->loadedTime && (long)info.st_size == curve->loadedSize))
+    {
+        return DD_DIFFICULTY_UNCHANGED;
+    }
+
+    // Note the change even if the file is bad, so it is reported once
+    curve->loadedTime = info.st_mtime;
+    curve->loadedSize = (long)info.st_size;
+    return dd_difficulty_load(curve, path);
+}
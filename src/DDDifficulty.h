@@ -0,0 +1,109 @@
+/**
+ * @file    DDDifficulty.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the difficulty curve: the rounds of a game, each
+ *          starting at a score and setting the darts, speed and health
+ *          kit and cloud chances until the next round's score. Rounds
+ *          are read from a table file (see Resources/difficulty.txt)
+ *          and compiled into a dense score to round lookup.
+ */
+
+#ifndef DDDifficulty_h
+#define DDDifficulty_h
+
+#include <limits.h>
+#include <time.h>
+
+/**
+ * @brief   Maximum number of rounds a curve may have
+ */
+#define DD_DIFFICULTY_MAX_ROUNDS    64
+
+/**
+ * @brief   Highest score the last round of a curve may start at; every
+ *          score from zero up to it has an entry in the dense lookup
+ */
+#define DD_DIFFICULTY_MAX_SCORE     4095
+
+/**
+ * @brief   Returned by dd_difficulty_load when the table file loaded
+ */
+#define DD_DIFFICULTY_LOADED        0
+
+/**
+ * @brief   Returned by dd_difficulty_load when the table file could
+ *          not be opened
+ */
+#define DD_DIFFICULTY_UNREADABLE    -1
+
+/**
+ * @brief   Returned by dd_difficulty_reload_if_changed when the table
+ *          file has not changed since it was last loaded
+ */
+#define DD_DIFFICULTY_UNCHANGED     -2
+
+/**
+ * @struct  DDRound
+ * @brief   One round of the difficulty curve
+ */
+typedef struct DDRound
+{
+    int     score;          //!< Score the round starts at
+    int     maxDarts;       //!< Darts on the screen at once, less one
+    int     speed;          //!< Game speed (always positive)
+    float   healthChance;   //!< Chance of a health kit every chance period (0 to 1)
+    float   cloudChance;    //!< Chance of a cloud every chance period (0 to 1)
+} DDRound;
+
+/**
+ * @struct  DDDifficulty
+ * @brief   A compiled difficulty curve; compile the built-in rounds with
+ *          dd_difficulty_init before loading a table over them.
+ */
+typedef struct DDDifficulty
+{
+    DDRound         rounds[DD_DIFFICULTY_MAX_ROUNDS];   //!< Rounds in order of score
+    int             roundCount;                         //!< Number of rounds (at least one)
+    unsigned char   roundAt[DD_DIFFICULTY_MAX_SCORE + 1];
+                                                        //!< Index of the round for every
+                                                        //!< score up to the last round's
+    unsigned int    generation;                         //!< Bumped whenever the rounds change
+    time_t          loadedTime;                         //!< Modification time of the table
+                                                        //!< file loaded, or 0
+    long            loadedSize;                         //!< Size of the table file loaded
+} DDDifficulty;
+
+void    dd_difficulty_init(DDDifficulty *curve);
+int     dd_difficulty_load(DDDifficulty *curve, const char *path);
+int     dd_difficulty_set_rounds(DDDifficulty *curve, const DDRound *rounds, int count);
+int     dd_difficulty_reload_if_changed(DDDifficulty *curve, const char *path);
+
+/**
+ * @brief   Looks up the round a score falls in, and the scores it spans
+ * @param   curve
+ *          The compiled curve
+ * @param   score
+ *          Score to look up; scores below zero fall in the first round
+ * @param   low
+ *          Set to the lowest score in the round (INT_MIN for the first)
+ * @param   high
+ *          Set to the score the next round starts at (INT_MAX for the last)
+ * @return  The round the score falls in
+ */
+static inline const DDRound* dd_difficulty_round_at(const DDDifficulty *curve, int score,
+                                                    int *low, int *high)
+{
+    int last = curve->roundCount - 1;
+    int i;
+
+    if      (score < 0)                         { i = 0; }
+    else if (score >= curve->rounds[last].score) { i = last; }
+    else                                        { i = curve->roundAt[score]; }
+
+    *low  = i == 0    ? INT_MIN : curve->rounds[i].score;
+    *high = i == last ? INT_MAX : curve->rounds[i + 1].score;
+    return &curve->rounds[i];
+}
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file    DDDirtyRegion.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the adding and merging of dirty rectangles.
+ */
+
+#include "DDDirtyRegion.h"
+
+/**
+ * @brief   Checks whether two rectangles overlap or share an edge
+ */
+static int dd_dirty_touching(const rectangle *a, const rectangle *b)
+{
+    return a->x <= b->x + b->width  && b->x <= a->x + a->width &&
+           a->y <= b->y + b->height && b->y <= a->y + a->height;
+}
+
+/**
+ * @brief   Returns the smallest rectangle holding two rectangles
+ */
+static rectangle dd_dirty_union(const rectangle *a, const rectangle *b)
+{
+    float x0 = a->x < b->x ? a->x : b->x;
+    float y0 = a->y < b->y ? a->y : b->y;
+    float x1 = a->x + a->width  > b->x + b->width  ? a->x + a->width  : b->x + b->width;
+    float y1 = a->y + a->height > b->y + b->height ? a->y + a->height : b->y + b->height;
+    return (rectangle){ x0, y0, (int32_t)(x1 - x0), (int32_t)(y1 - y0) };
+}
+
+/**
+ * @brief   Resets a region for a screen of the given size; the whole
+ *          screen starts dirty, as nothing has been drawn yet
+ * @param   region
+ *          The region to reset
+ * @param   width
+ *          Width of the screen
+ * @param   height
+ *          Height of the screen
+ */
+void dd_dirty_reset(DDDirtyRegion *region, int width, int height)
+{
+    region->width   = width;
+    region->height  = height;
+    dd_dirty_clear(region);
+    region->full    = 1;
+}
+
+/**
+ * @brief   Empties a region once it has been redrawn
+ * @param   region
+ *          The region to clear
+ */
+void dd_dirty_clear(DDDirtyRegion *region)
+{
+    region->count   = 0;
+    region->area    = 0;
+    region->full    = 0;
+}
+
+/**
+ * @brief   Adds a rectangle to a region. It is snapped outwards to
+ *          whole pixels and clipped to the screen, then merged with
+ *          any rectangle it touches (and so on, as the merge grows).
+ * @param   region
+ *          The region to add to
+ * @param   r
+ *          The rectangle that must be redrawn
+ */
+void dd_dirty_add(DDDirtyRegion *region, rectangle r)
+{
+    if (region->full) { return; }
+
+    // Whole pixels, within the screen
+    int32_t x0 = (int32_t)r.x - (r.x < (int32_t)r.x);
+    int32_t y0 = (int32_t)r.y - (r.y < (int32_t)r.y);
+    int32_t x1 = (int32_t)(r.x + r.width)  + 1;
+    int32_t y1 = (int32_t)(r.y + r.height) + 1;
+    if (x0 < 0) { x0 = 0; }
+    if (y0 < 0) { y0 = 0; }
+    if (x1 > region->width)  { x1 = region->width;  }
+    if (y1 > region->height) { y1 = region->height; }
+    if (x0 >= x1 || y0 >= y1 || r.width <= 0 || r.height <= 0) { return; }
+
+    rectangle added = { x0, y0, x1 - x0, y1 - y0 };
+
+    // Swallow every rectangle the (growing) new one touches
+    for (int i = 0; i < region->count; )
+    {
+        if (dd_dirty_touching(&added, &region->rects[i]))
+        {
+            added = dd_dirty_union(&added, &region->rects[i]);
+            region->area -= (long)region->rects[i].width * region->rects[i].height;
+            region->rects[i] = region->rects[--region->count];
+            i = 0;
+        }
+        else { i++; }
+    }
+
+    if (region->count == DD_DIRTY_MAX_RECTS)
+    {
+        region->full = 1;
+        return;
+    }
+    region->rects[region->count++] = added;
+    region->area += (long)added.width * added.height;
+}
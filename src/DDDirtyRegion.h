@@ -0,0 +1,71 @@
+/**
+ * @file    DDDirtyRegion.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the region of the screen that must be redrawn this
+ *          frame, kept as a short list of non-overlapping rectangles,
+ *          which DDCanvas redraws under a clip each in place of the
+ *          whole screen.
+ */
+
+#ifndef DDDirtyRegion_h
+#define DDDirtyRegion_h
+
+// Import SwinGame types (for rectangle)
+#include "Types.h"
+
+/**
+ * @brief   Maximum number of separate rectangles in a region; adding
+ *          more makes the whole screen dirty
+ */
+#define DD_DIRTY_MAX_RECTS      32
+
+/**
+ * @brief   Fraction of the screen beyond which the region is redrawn
+ *          as the whole screen, as clipped redraws stop paying off
+ */
+#define DD_DIRTY_MAX_FRACTION   0.5f
+
+/**
+ * @struct  DDDirtyRegion
+ * @brief   The dirty region of a screen; reset it with dd_dirty_reset.
+ */
+typedef struct DDDirtyRegion
+{
+    rectangle   rects[DD_DIRTY_MAX_RECTS];  //!< Dirty rectangles, within the screen and
+                                            //!< not overlapping or touching each other
+    int         count;                      //!< Number of dirty rectangles
+    long        area;                       //!< Total area of the dirty rectangles
+    int         full;                       //!< Whether the whole screen is dirty
+    int         width;                      //!< Width of the screen
+    int         height;                     //!< Height of the screen
+} DDDirtyRegion;
+
+void    dd_dirty_reset(DDDirtyRegion *region, int width, int height);
+void    dd_dirty_clear(DDDirtyRegion *region);
+void    dd_dirty_add(DDDirtyRegion *region, rectangle r);
+
+/**
+ * @brief   Makes the whole screen dirty
+ * @param   region
+ *          The region
+ */
+static inline void dd_dirty_invalidate(DDDirtyRegion *region)
+{
+    region->full = 1;
+}
+
+/**
+ * @brief   Checks whether the whole screen should be redrawn, either
+ *          because it is all dirty or because enough of it is
+ * @param   region
+ *          The region
+ * @return  Non-zero if the whole screen should be redrawn
+ */
+static inline int dd_dirty_is_full(const DDDirtyRegion *region)
+{
+    return region->full ||
+           region->area > (long)(DD_DIRTY_MAX_FRACTION * region->width * region->height);
+}
+
+#endif
@@ -0,0 +1,308 @@
+/**
+ * @file    DDFarm.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the simulation farm's work-stealing scheduler and
+ *          its report.
+ */
+
+#include "DDFarm.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Import the monotonic clock
+#include "DDProfiler.h"
+
+/**
+ * @struct  DDFarmRange
+ * @brief   The jobs a worker has left, [next, end), packed into one
+ *          word (end in the high half) so that taking from the front
+ *          and stealing from the back are each a single compare and
+ *          swap; padded to a cache line of its own
+ */
+typedef struct DDFarmRange
+{
+    uint64_t    bounds;     //!< next | end << 32
+    uint32_t    jobs;       //!< Jobs this worker has run
+    uint32_t    steals;     //!< Ranges this worker has stolen
+    char        pad[48];    //!< Keeps each range on its own cache line
+} DDFarmRange;
+
+/**
+ * @brief   Packs a range of jobs into a word
+ */
+static inline uint64_t dd_farm_pack(uint32_t next, uint32_t end)
+{
+    return (uint64_t)end << 32 | next;
+}
+
+/**
+ * @brief   Takes the next job from the front of a worker's own range
+ * @return  Non-zero if there was a job left
+ */
+static int dd_farm_take(DDFarmRange *range, uint32_t *job)
+{
+    uint64_t bounds = __atomic_load_n(&range->bounds, __ATOMIC_ACQUIRE);
+    for (;;)
+    {
+        uint32_t next = (uint32_t)bounds, end = (uint32_t)(bounds >> 32);
+        if (next >= end) { return 0; }
+        if (__atomic_compare_exchange_n(&range->bounds, &bounds, dd_farm_pack(next + 1, end),
+                                        0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            *job = next;
+            return 1;
+        }
+    }
+}
+
+/**
+ * @brief   Steals the back half of the first other worker's range that
+ *          has jobs left, making it this worker's own range, and takes
+ *          its first job
+ * @return  Non-zero if a job was stolen; zero once every range is empty
+ */
+static int dd_farm_steal(DDFarmRange *ranges, int workers, int worker, uint32_t *job)
+{
+    for (int i = 1; i < workers; i++)
+    {
+        DDFarmRange *victim = &ranges[(worker + i) % workers];
+        uint64_t bounds = __atomic_load_n(&victim->bounds, __ATOMIC_ACQUIRE);
+        for (;;)
+        {
+            uint32_t next = (uint32_t)bounds, end = (uint32_t)(bounds >> 32);
+            if (next >= end) { break; }
+
+            uint32_t from = end - (end - next + 1) / 2;
+            if (__atomic_compare_exchange_n(&victim->bounds, &bounds, dd_farm_pack(next, from),
+                                            0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                // My own range is empty, so no thief is after it
+                __atomic_store_n(&ranges[worker].bounds, dd_farm_pack(from + 1, end),
+                                 __ATOMIC_RELEASE);
+                ranges[worker].steals++;
+                *job = from;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Runs jobs until there are none left to take or steal
+ */
+static void dd_farm_work(DDFarmRange *ranges, int workers, int worker, DDFarmJob run,
+                         void *context, char *results, size_t resultSize)
+{
+    uint32_t job;
+    while (dd_farm_take(&ranges[worker], &job) ||
+           dd_farm_steal(ranges, workers, worker, &job))
+    {
+        run(job, worker, results + (size_t)job * resultSize, context);
+        ranges[worker].jobs++;
+    }
+}
+
+/**
+ * @brief   Runs every job across a number of worker processes, each
+ *          starting with an even share of the jobs and stealing from
+ *          the others once it has run its own
+ * @param   workers
+ *          Number of workers (one runs every job in this process)
+ * @param   jobs
+ *          Number of jobs
+ * @param   run
+ *          Runs one job, in a worker
+ * @param   context
+ *          Handed to every run (as it was when the workers started)
+ * @param   results
+ *          Where each job's result is copied back to, resultSize bytes
+ *          a job, in job order
+ * @param   resultSize
+ *          Size of a job's result
+ * @param   stats
+ *          Set to how the jobs were shared out, or NULL
+ * @return  Zero once every job has run, or -1 if shared memory could
+ *          not be had or a worker failed (the results are then partial)
+ */
+int dd_farm_run(int workers, uint32_t jobs, DDFarmJob run, void *context,
+                void *results, size_t resultSize, DDFarmStats *stats)
+{
+    if (workers < 1)                   { workers = 1; }
+    if (workers > DD_FARM_MAX_WORKERS) { workers = DD_FARM_MAX_WORKERS; }
+
+    // Ranges and results live in memory shared with the workers
+    size_t rangesSize   = sizeof(DDFarmRange) * workers;
+    size_t sharedSize   = rangesSize + resultSize * jobs;
+    char *shared        = mmap(NULL, sharedSize, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) { return -1; }
+
+    DDFarmRange *ranges = (DDFarmRange *)shared;
+    char *sharedResults = shared + rangesSize;
+    for (int i = 0; i < workers; i++)
+    {
+        ranges[i].bounds = dd_farm_pack((uint32_t)((uint64_t)jobs * i / workers),
+                                        (uint32_t)((uint64_t)jobs * (i + 1) / workers));
+    }
+
+    uint64_t start  = dd_profile_now();
+    int failed      = 0;
+    if (workers == 1)
+    {
+        dd_farm_work(ranges, 1, 0, run, context, sharedResults, resultSize);
+    }
+    else
+    {
+        pid_t pids[DD_FARM_MAX_WORKERS];
+        int started = 0;
+        for (; started < workers; started++)
+        {
+            pids[started] = fork();
+            if (pids[started] == 0)
+            {
+                dd_farm_work(ranges, workers, started, run, context, sharedResults, resultSize);
+                _exit(0);
+            }
+            if (pids[started] < 0) { failed = 1; break; }
+        }
+        // A worker that never started leaves its range to be stolen
+        for (int i = 0; i < started; i++)
+        {
+            int status;
+            if (waitpid(pids[i], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status))
+            {
+                failed = 1;
+            }
+        }
+        if (failed)
+        {
+            dd_farm_work(ranges, workers, 0, run, context, sharedResults, resultSize);
+        }
+    }
+
+    // Every job ran unless a worker died mid-job
+    uint32_t ran = 0;
+    for (int i = 0; i < workers; i++) { ran += ranges[i].jobs; }
+
+    if (stats)
+    {
+        stats->workers      = workers;
+        stats->nanoseconds  = dd_profile_now() - start;
+        for (int i = 0; i < workers; i++)
+        {
+            stats->jobs[i]      = ranges[i].jobs;
+            stats->steals[i]    = ranges[i].steals;
+        }
+    }
+    memcpy(results, sharedResults, resultSize * jobs);
+    munmap(shared, sharedSize);
+    return ran == jobs ? 0 : -1;
+}
+
+/**
+ * @brief   Orders 32-bit unsigned values for qsort
+ */
+static int dd_farm_compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief   Orders doubles for qsort
+ */
+static int dd_farm_compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief   Writes a summary of the games a farm played: how long they
+ *          survived, the scores they peaked at, how many darts were on
+ *          screen, what a tick cost and how the work was shared out
+ * @param   out
+ *          Where to write the report
+ * @param   games
+ *          The games' results
+ * @param   count
+ *          Number of games
+ * @param   tickLength
+ *          Length of a tick in ms, to turn ticks into seconds
+ * @param   stats
+ *          How the farm shared out the games, or NULL
+ */
+void dd_farm_report(FILE *out, const DDFarmGame *games, uint32_t count, float tickLength,
+                    const DDFarmStats *stats)
+{
+    if (!count) { fprintf(out, "No games played\n"); return; }
+
+    uint32_t *ticks     = malloc(sizeof(uint32_t) * count);
+    uint32_t *scores    = malloc(sizeof(uint32_t) * count);
+    double   *tickCost  = malloc(sizeof(double)   * count);
+    uint32_t bins[DD_FARM_SCORE_BINS] = { 0 };
+    uint64_t allTicks = 0, allDarts = 0, allNanoseconds = 0;
+    uint32_t over = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const DDFarmGame *game = &games[i];
+        int32_t score   = game->peakScore > 0 ? game->peakScore : 0;
+        int bin         = score / DD_FARM_SCORE_BIN;
+
+        ticks[i]        = game->ticks;
+        scores[i]       = (uint32_t)score;
+        tickCost[i]     = game->ticks ? (double)game->nanoseconds / game->ticks : 0;
+        bins[bin < DD_FARM_SCORE_BINS ? bin : DD_FARM_SCORE_BINS - 1]++;
+        allTicks       += game->ticks;
+        allDarts       += game->darts;
+        allNanoseconds += game->nanoseconds;
+        over           += game->over;
+    }
+    qsort(ticks,    count, sizeof(uint32_t), dd_farm_compare_u32);
+    qsort(scores,   count, sizeof(uint32_t), dd_farm_compare_u32);
+    qsort(tickCost, count, sizeof(double),   dd_farm_compare_double);
+
+#define DD_PCT(a, p) (a)[(size_t)(count - 1) * (p) / 100]
+
+    fprintf(out, "Games           %u (%u over, %u at the tick limit)\n", count, over, count - over);
+    fprintf(out, "Survival (s)    mean %.1f  p50 %.1f  p95 %.1f  max %.1f\n",
+            allTicks * tickLength / 1000.0 / count, DD_PCT(ticks, 50) * tickLength / 1000.0,
+            DD_PCT(ticks, 95) * tickLength / 1000.0, ticks[count - 1] * tickLength / 1000.0);
+    fprintf(out, "Peak score      p10 %u  p50 %u  p90 %u  p99 %u  max %u\n",
+            DD_PCT(scores, 10), DD_PCT(scores, 50), DD_PCT(scores, 90), DD_PCT(scores, 99),
+            scores[count - 1]);
+    for (int i = 0; i < DD_FARM_SCORE_BINS; i++)
+    {
+        if (!bins[i]) { continue; }
+        fprintf(out, "  %3d%-5s %6u  ", i * DD_FARM_SCORE_BIN,
+                i == DD_FARM_SCORE_BINS - 1 ? "+" : "..", bins[i]);
+        for (uint32_t dots = 0; dots < bins[i] * 50 / count; dots++) { fputc('#', out); }
+        fputc('\n', out);
+    }
+    fprintf(out, "Darts per tick  %.2f\n", allTicks ? (double)allDarts / allTicks : 0);
+    fprintf(out, "Tick cost (us)  mean %.2f  p50 %.2f  p99 %.2f (per game)\n",
+            allTicks ? allNanoseconds / 1000.0 / allTicks : 0,
+            DD_PCT(tickCost, 50) / 1000, DD_PCT(tickCost, 99) / 1000);
+
+#undef DD_PCT
+
+    if (stats && stats->nanoseconds)
+    {
+        double seconds = stats->nanoseconds / 1e9;
+        uint32_t steals = 0;
+        for (int i = 0; i < stats->workers; i++) { steals += stats->steals[i]; }
+        fprintf(out, "Farm            %d workers, %.2f s, %.0f games/s, %.0f ticks/s, %u steals\n",
+                stats->workers, seconds, count / seconds, allTicks / seconds, steals);
+    }
+
+    free(ticks);
+    free(scores);
+    free(tickCost);
+}
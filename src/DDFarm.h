@@ -0,0 +1,82 @@
+/**
+ * @file    DDFarm.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the simulation farm: a scheduler that runs many
+ *          independent jobs (headless games) across every core, and the
+ *          report summarising the games it played.
+ * @note    Workers are forked processes rather than threads, as the
+ *          game's classes (and SwinGame) keep process-wide state. Jobs
+ *          are handed out from per-worker ranges in shared memory; a
+ *          worker that runs out steals half of what another has left.
+ */
+
+#ifndef DDFarm_h
+#define DDFarm_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief   Maximum number of workers in a farm
+ */
+#define DD_FARM_MAX_WORKERS     64
+
+/**
+ * @brief   Width of a bin of the report's score histogram
+ */
+#define DD_FARM_SCORE_BIN       10
+
+/**
+ * @brief   Number of bins in the report's score histogram (the last
+ *          takes every higher score)
+ */
+#define DD_FARM_SCORE_BINS      12
+
+/**
+ * @typedef DDFarmJob
+ * @brief   Runs one job of the farm
+ * @param   job
+ *          Index of the job, from zero
+ * @param   worker
+ *          Index of the worker running it
+ * @param   result
+ *          Where the job writes its result (zeroed beforehand)
+ * @param   context
+ *          What was handed to dd_farm_run
+ */
+typedef void (*DDFarmJob)(uint32_t job, int worker, void *result, void *context);
+
+/**
+ * @struct  DDFarmStats
+ * @brief   How the jobs were shared out among the workers
+ */
+typedef struct DDFarmStats
+{
+    int         workers;                        //!< Number of workers run
+    uint32_t    jobs[DD_FARM_MAX_WORKERS];      //!< Jobs each worker ran
+    uint32_t    steals[DD_FARM_MAX_WORKERS];    //!< Ranges each worker stole
+    uint64_t    nanoseconds;                    //!< Wall time of the whole run
+} DDFarmStats;
+
+/**
+ * @struct  DDFarmGame
+ * @brief   The result of one game played by the farm
+ */
+typedef struct DDFarmGame
+{
+    uint32_t    seed;           //!< Seed the game was played with
+    uint32_t    ticks;          //!< Ticks played until game over (or the limit)
+    int32_t     peakScore;      //!< Highest score reached
+    uint8_t     over;           //!< Whether the game ended before the tick limit
+    uint64_t    darts;          //!< Live darts summed over every tick
+    uint64_t    nanoseconds;    //!< Time spent in the game's ticks
+} DDFarmGame;
+
+int     dd_farm_run(int workers, uint32_t jobs, DDFarmJob run, void *context,
+                    void *results, size_t resultSize, DDFarmStats *stats);
+void    dd_farm_report(FILE *out, const DDFarmGame *games, uint32_t count, float tickLength,
+                       const DDFarmStats *stats);
+
+#endif
@@ -9,10 +9,39 @@
 #import <Foundation/Foundation.h>
 
 // Forward reference classes (and typedef) referenced in interface
-@class DDBalloon, DDCanvas, DDBackground, DDSprite;
+@class DDBalloon, DDCanvas, DDBackground, DDSprite, DDDartPool, DDCollisionGrid;
 
 #import "DDDirection.h"
 
+// Import the batch collision tests (for DDRectBatch)
+#import "DDCollisionKernel.h"
+
+// Import the DDKeys type
+#import "DDInputLog.h"
+
+// Import the game's random number generator (for DDRandom)
+#import "DDRandom.h"
+
+// Import the difficulty curve (for DDDifficulty and DDRound)
+#import "DDDifficulty.h"
+
+// Import the frame profiler (for DDProfiler)
+#import "DDProfiler.h"
+
+// Import the autopilot (for DDAutopilotView)
+#import "DDAutopilot.h"
+
+/**
+ * @brief   Number of sprites killed in a single tick that there is room
+ *          for at first; the room doubles whenever a tick kills more
+ */
+#define DD_DOOMED_CAPACITY 64
+
+/**
+ * @brief   Time (in ms) the game over screen is held for by default
+ */
+#define DD_GAME_OVER_DELAY 3000
+
 @interface DDGame : NSObject
 {
     // Define ivars
@@ -31,18 +60,54 @@
     DDBackground*   _background;    //!< Defines the current game's background
     DDBalloon*      _balloon;       //!< Defined the balloon object, the playable object which
                                     //!< the game revolves around
-    NSMutableArray* _darts;         //!< Defines a collection of darts used to kill the player
+    DDDartPool*     _darts;         //!< Defines the pool of darts used to kill the player
     DDCanvas*       _canvas;        //!< Defines the game canvas which draws every drawable
                                     //!< sprite onto as well as the game's HUD
-    SGTimer*        _chanceTimer;   //!< Random chance timer
-                                    //!< Defines the chance timer for creating new health kits
-                                    //!< and clouds
-    SGTimer*        _scoreTimer;    //!< Score incrementing timer
-                                    //!< Defines the timer for increasing score and
-                                    //!< decrementing score when dying
-    SGTimer*        _dyingTimer;    //!< Defines the timer to check whether the player has
-                                    //!< been dying for too long (and hence kill them once
-                                    //!< this clock ticks over)
+    DDCollisionGrid* _grid;         //!< Defines the broad phase grid darts are binned into
+                                    //!< so only those near another collidable are checked
+    DDRectBatch     _dartBatch;     //!< Defines the masks of the darts the broad phase found,
+                                    //!< tested together by the batch collision kernel (as
+                                    //!< many batches as it takes)
+    int             _batchSlots[DD_RECT_BATCH_CAPACITY];
+                                    //!< Defines the DDDartPool slot of each dart in _dartBatch
+    uint64_t        _balloonHits[DD_HIT_MASK_WORDS];
+                                    //!< Defines which darts in _dartBatch hit the balloon (or
+                                    //!< its duplicate)
+    uint64_t        _healthHits[DD_HIT_MASK_WORDS];
+                                    //!< Defines which darts in _dartBatch hit the health kit
+    float           _tickLength;    //!< Length of a single simulation tick in ms, which the
+                                    //!< game's clocks below advance by on every update
+    float           _chanceTime;    //!< Random chance clock (ms)
+                                    //!< Defines the time since new health kits and clouds
+                                    //!< were last given a chance to appear
+    float           _scoreTime;     //!< Score incrementing clock (ms)
+                                    //!< Defines the time since the score was last increased
+                                    //!< (or decreased when dying)
+    float           _dyingTime;     //!< Defines the time the player has been dying for (and
+                                    //!< hence whether to give them another health kit), or
+                                    //!< -1 if they have not died yet
+    DDKeys          _keys;          //!< Defines the keys held or typed this frame
+    DDRandom        _rng;           //!< Defines this game's own random number generator, so
+                                    //!< that its play depends only on its seed
+    const DDDifficulty* _difficulty;//!< Defines the difficulty curve the game's rounds follow
+    DDRound         _round;         //!< Defines the round the game is currently in
+    int             _roundLow;      //!< Defines the lowest score in the current round
+    int             _roundHigh;     //!< Defines the score the next round starts at, so that
+                                    //!< the curve is only looked up when a round changes
+    unsigned int    _roundGeneration;
+                                    //!< Defines the curve's generation when _round was looked
+                                    //!< up, so that a reloaded curve is picked up at once
+    DDProfiler*     _profiler;      //!< Defines the profiler each phase of a tick (and the
+                                    //!< draw) is timed into, or NULL if not profiled
+    BOOL            _over;          //!< Defines whether the game has reached game over
+    int             _gameOverDelay; //!< Defines how long (in ms) the game over screen is
+                                    //!< held for
+    int             _autopilotSteer;//!< Defines which way the autopilot last steered the
+                                    //!< balloon (-1 left, 0 stay, 1 right)
+    DDSprite**      _doomed;        //!< Defines the sprites killed this tick, taken out of
+                                    //!< play at once but destroyed only at the end of it
+    int             _doomedCount;   //!< Defines the number of sprites in _doomed
+    int             _doomedCapacity;//!< Defines the number of sprites _doomed has room for
 }
 
 // Define properties
@@ -50,13 +115,36 @@
                                                     //!< for DDController
 @property   (readonly)  int             score;      //!< Readonly access to the game's score
                                                     //!< for DDController
+@property   (readonly)  DDDartPool*     darts;      //!< Readonly access to the dart pool,
+                                                    //!< for profiling its hits and misses
+@property               float           tickLength; //!< Access to the length of a tick in ms,
+                                                    //!< set by DDController from its tick rate
+@property               DDKeys          keys;       //!< Access to the keys held or typed this
+                                                    //!< frame, set by DDController (live or
+                                                    //!< from an input log)
+@property   (readonly)  DDRandom*       rng;        //!< Readonly access to the game's random
+                                                    //!< number generator, which every sprite
+                                                    //!< in the game draws from
+@property               DDProfiler*     profiler;   //!< Access to the profiler the game is
+                                                    //!< timed into, set by DDController
+@property   (readonly)  BOOL            over;       //!< Readonly access to whether the game
+                                                    //!< is over, for games played without a
+                                                    //!< DDController (such as the farm's)
+@property               int             gameOverDelay;
+                                                    //!< Access to how long the game over
+                                                    //!< screen is held for, set to zero by
+                                                    //!< DDController when replaying
 
 
 // Define methods
 -(id)   init;
+-(id)   initWithSeed:(uint32_t) seed;
+-(id)   initWithSeed:(uint32_t) seed difficulty:(const DDDifficulty*) difficulty;
 -(void) updateGame;
+-(void) drawGameWithInterpolation:(float) alpha;
 -(void) removeSprite:(DDSprite*) sprite;
 -(void) addSprite:(DDSprite*) sprite;
 -(void) moveBalloonInDirection:(DDDirection) dir;
+-(DDKeys) autopilotKeys;
 
 @end
@@ -8,6 +8,7 @@
 
 // Import SwinGame Framework
 #import "SwinGame.h"
+#import "GeometryInline.h"
 
 // Import my interface
 #import "DDGame.h"
@@ -16,30 +17,151 @@
 #import "DDBackground.h"
 #import "DDBalloon.h"
 #import "DDCanvas.h"
+#import "DDCollisionGrid.h"
 #import "DDCollisionMask.h"
 #import "DDDart.h"
+#import "DDDartPool.h"
 #import "DDHealth.h"
 #import "DDCloud.h"
 #import "DDInterrupt.h"
+#import "DDBitmapCache.h"
+#import "DDSoundBank.h"
+
+/**
+ * @brief   Broad phase mark for darts sharing a grid cell with the
+ *          balloon or its duplicate
+ */
+#define DD_NEAR_BALLOON 0x01
+
+/**
+ * @brief   Broad phase mark for darts sharing a grid cell with the
+ *          health kit
+ */
+#define DD_NEAR_HEALTH  0x02
+
+/**
+ * @brief   Typed cheat keys, which stay down from the frame they were
+ *          typed in until a tick has acted on them
+ */
+#define DD_TYPED_CHEATS (DDKEY_C | DDKEY_H)
+
+/**
+ * @brief   Declare the built-in difficulty curve as a static
+ *          variable; games created without a curve of their
+ *          own follow it
+ */
+static DDDifficulty _builtInDifficulty;
 
 @implementation DDGame
 // Synthesize properties
-@synthesize speed   = _speed;
-@synthesize score   = _score;
+@synthesize speed         = _speed;
+@synthesize score         = _score;
+@synthesize darts         = _darts;
+@synthesize tickLength    = _tickLength;
+@synthesize profiler      = _profiler;
+@synthesize over          = _over;
+@synthesize gameOverDelay = _gameOverDelay;
+
+/**
+ * @brief   Compiles the built-in difficulty curve before
+ *          the first game is created
+ */
++(void)initialize
+{
+    if (self == [DDGame class]) { dd_difficulty_init(&_builtInDifficulty); }
+}
+
+/**
+ * @brief   Manual synthesis for the keys held or typed this frame
+ * @return  The keys
+ */
+-(DDKeys) keys
+{
+    return _keys;
+}
+
+/**
+ * @brief   Manual synthesis for the keys held or typed this frame,
+ *          keeping any cheat typed in an earlier frame down until a
+ *          tick acts on it (a frame may run no ticks)
+ * @param   keys
+ *          The keys
+ */
+-(void) setKeys:(DDKeys) keys
+{
+    _keys = keys | (_keys & DD_TYPED_CHEATS);
+}
+
+/**
+ * @brief   Manual synthesis for the game's random number generator
+ * @return  A pointer to the generator
+ */
+-(DDRandom*) rng
+{
+    return &_rng;
+}
 
 /**
  * @brief   The constructor for DDGame which intialises
- *          instance variables to be used.
+ *          instance variables to be used, seeding its
+ *          random numbers from the clock.
  * @return  The class's self pointer
  */
 -(id)init
+{
+    return [self initWithSeed:(uint32_t)time(NULL)];
+}
+
+/**
+ * @brief   The constructor for DDGame which intialises
+ *          instance variables to be used, following the
+ *          built-in difficulty curve.
+ * @param   seed
+ *          Seed for the game's random numbers; games with the same
+ *          seed and input play out exactly the same
+ * @return  The class's self pointer
+ */
+-(id)initWithSeed:(uint32_t) seed
+{
+    return [self initWithSeed:seed difficulty:&_builtInDifficulty];
+}
+
+/**
+ * @brief   The constructor for DDGame which intialises
+ *          instance variables to be used.
+ * @param   seed
+ *          Seed for the game's random numbers; games with the same
+ *          seed and input play out exactly the same
+ * @param   difficulty
+ *          Difficulty curve for the game's rounds to follow, which
+ *          must outlive the game (and may be reloaded during it)
+ * @return  The class's self pointer
+ */
+-(id)initWithSeed:(uint32_t) seed difficulty:(const DDDifficulty*) difficulty
 {
     if (self = [super init])
     {
+        // Seed first, as creating sprites draws random numbers
+        dd_random_seed(&_rng, seed);
+        
+        // Look the first round up on the first update
+        _difficulty = difficulty;
+        _roundLow   = 0;
+        _roundHigh  = 0;
+        
         _score      = 0;
         _recScore   = 0;
         _maxDarts   = 5;
         _speed      = 3;
+        // Load every sprite's bitmap up front, so spawning never
+        // waits on the image loader (a no-op after the first game)
+        [DDBitmapCache preloadBitmapsNamed:@[@"background.png", @"balloon.png",
+                                             @"dart.png", @"health.png",
+                                             @"cloudL.png", @"cloudR.png"]];
+        // ...and pack them into the atlas (if enabled), for sprites to
+        // draw in batches
+        [DDBitmapCache packAtlas];
+        
         // Initialise canvas first
         // @todo: use a fake nsmutabledict instead for now
         NSMutableDictionary* hudEls = [[NSMutableDictionary alloc] init];
@@ -50,30 +172,84 @@
         _background = [[DDBackground alloc] initInGame:self];
         _balloon    = [[DDBalloon alloc] initInGame:self];
 
-        _darts      = [[NSMutableArray alloc] init];
+        _darts      = [[DDDartPool alloc] initInGame:self];
+        _grid       = [[DDCollisionGrid alloc] initWithWidth:[SGGraphics screenWidth]
+                                                      height:[SGGraphics screenHeight]];
         
-        // Init and start the timers (had to use C function
-        // here since create on its own does not exist in SG)
-        _scoreTimer     = [SGTimer createWithId:create_timer()];
-        _chanceTimer    = [SGTimer createWithId:create_timer()];
-        _dyingTimer     = [SGTimer createWithId:create_timer()];
-        [_scoreTimer start];
-        [_chanceTimer start];
+        // Start the clocks; they count simulated time rather than
+        // wall time so a replayed game plays out exactly the same
+        _tickLength     = 1000.0f / 60;
+        _scoreTime      = 0;
+        _chanceTime     = 0;
+        _dyingTime      = -1;
+        _keys           = 0;
+        _over           = NO;
+        _gameOverDelay  = DD_GAME_OVER_DELAY;
+        _autopilotSteer = 0;
+        _doomedCount    = 0;
+        _doomedCapacity = DD_DOOMED_CAPACITY;
+        _doomed         = malloc(sizeof(DDSprite*) * _doomedCapacity);
     }
     return self;
 }
 
 /**
- * @brief   Updates the game using a series of private
- *          methods. Returns an id as a flag to kill the
- *          game (i.e. to the controller) as required.
+ * @brief   Releases the game's sprites, pool, grid and canvas (which
+ *          releases every sprite still on it, and the HUD), and frees
+ *          the room kept for sprites killed in a tick
+ * @note    The profiler is not the game's; it belongs to whoever set it
+ */
+-(void)dealloc
+{
+    [_balloon release];
+    [_background release];
+    [_darts release];
+    [_grid release];
+    [_canvas release];
+    free(_doomed);
+    [super dealloc];
+}
+
+/**
+ * @brief   Updates the game by one fixed simulation tick using
+ *          a series of private methods, moving the balloon for the
+ *          keys held. Drawing is left to
+ *          drawGameWithInterpolation: so that it can run at its
+ *          own rate.
  */
 -(void)updateGame
 {
+    // Remember where everything was for interpolated drawing
+    [_canvas savePositions];
+    
+    // Move the balloon for the keys held, only now that its position is
+    // saved, so that it is drawn moving as smoothly as everything else
+    if (_keys & DDKEY_LEFT)  { [_balloon moveInDirection:DDLEFT];  }
+    if (_keys & DDKEY_RIGHT) { [_balloon moveInDirection:DDRIGHT]; }
+    
+    // Advance the game's clocks by one tick
+    _scoreTime  += _tickLength;
+    _chanceTime += _tickLength;
+    if (_dyingTime >= 0) { _dyingTime += _tickLength; }
+    
+    // Time each phase into the profiler (if there is one)
+    uint64_t start = dd_profile_begin(_profiler);
     [self checkCollisions];
+    dd_profile_end(_profiler, DDPHASE_COLLISIONS, start);
+    
+    start = dd_profile_begin(_profiler);
     [self updateDifficulty];
+    dd_profile_end(_profiler, DDPHASE_DIFFICULTY, start);
+    
+    start = dd_profile_begin(_profiler);
     [self updateDarts];
+    dd_profile_end(_profiler, DDPHASE_DARTS, start);
+    
+    start = dd_profile_begin(_profiler);
     [self updateScore];
+    dd_profile_end(_profiler, DDPHASE_SCORE, start);
+    
+    start = dd_profile_begin(_profiler);
     
     // Check if balloon is off screen for duplicate
     // balloon creation
@@ -85,37 +261,57 @@
     [[_canvas getSprite:[DDHealth class]] fall];
     [[_canvas getSprite:[DDCloud class]] fall];
     
-    // Make all dart objects fall
-    for (int i = 0; i < [_darts count]; i++)
+    // Make all dart objects fall (those falling off the screen stay
+    // in their slots until the end of the tick)
+    for (int i = 0; i < _darts.count; i++)
     {
-        [[_darts objectAtIndex:i] fall];
+        [[_darts dartAtIndex:i] fall];
     }
+    dd_profile_end(_profiler, DDPHASE_FALL, start);
+    
+    // Testing cheats :D (held, so applied per tick...
+    if ((_keys & DDKEY_SPACE) && (_keys & DDKEY_Q))
+    {
+        _score++;
+    }
+    // ...or typed, so applied on one tick only)
+    if ((_keys & DDKEY_SPACE) && (_keys & DDKEY_C))
+    {
+        [self spawnCloud];
+    }
+    if ((_keys & DDKEY_SPACE) && (_keys & DDKEY_H))
+    {
+        [self spawnHealth];
+    }
+    _keys &= ~DD_TYPED_CHEATS;
+    
+    // Lastly, destroy everything killed during the tick
+    [self destroyDoomedSprites];
+}
+
+/**
+ * @brief   Draws the game canvas (or the debug view) with every
+ *          sprite placed between its previous and current tick
+ *          position.
+ * @param   alpha
+ *          Fraction of a tick elapsed since the last update, from 0
+ *          (previous position) to 1 (current position)
+ */
+-(void)drawGameWithInterpolation:(float)alpha
+{
+    uint64_t start = dd_profile_begin(_profiler);
     
     // Enable debug mode on spacebar
-    if ([SGInput keyDown:VK_SPACE])
+    if (_keys & DDKEY_SPACE)
     {
-        [_canvas drawDebug];
-        
-        // Testing cheats :D
-        if ([SGInput keyDown:VK_Q])
-        {
-            _score++;
-        }
-        if ([SGInput keyTyped:VK_C])
-        {
-            [self spawnCloud];
-        }
-        if ([SGInput keyTyped:VK_H])
-        {
-            [self spawnHealth];
-        }
-        
+        [_canvas drawDebugWithProfiler:_profiler];
     }
     // Draw normal game canvas if not debug
-    else { [_canvas drawWithItems:@{@"left":  [NSString stringWithFormat:@"%d metres" ,
-                                               _score],
-                                    @"right": [NSString stringWithFormat:@"Patches: %d" ,
-                                               _balloon.health]}]; }
+    else { [_canvas drawWithScore:_score
+                          patches:_balloon.health
+                    interpolation:alpha]; }
+    
+    dd_profile_end(_profiler, DDPHASE_DRAW, start);
 }
 
 /**
@@ -130,25 +326,55 @@
 }
 
 /**
- * @brief   Removes a sprite from the game canvas and destroys all references
- *          to this sprite henceforth, depending on what kind it is
+ * @brief   Takes a sprite out of play at once, so nothing else this
+ *          tick sees it, but leaves destroying it until the end of the
+ *          tick, so that sprites killed while the game is iterating
+ *          over them don't shift the collections being iterated
  * @param   sprite
- *          The sprite to remove
+ *          The sprite to remove; sprites already out of play (killed
+ *          earlier this tick, or darts parked in the pool) are ignored
  */
 -(void)removeSprite:(DDSprite *)sprite
 {
-    // Remove sprite from the canvas
-    [_canvas removeSprite:sprite];
+    if (!sprite.active) return;
     
-    // Removing a dart?
-    if ([sprite class] == [DDDart class])
+    // Make room for another
+    if (_doomedCount == _doomedCapacity)
     {
-        // Remove the dart from the _darts collection
-        [_darts removeObjectIdenticalTo:sprite];
+        _doomedCapacity *= 2;
+        _doomed = realloc(_doomed, sizeof(DDSprite*) * _doomedCapacity);
+    }
+    sprite.active               = NO;
+    _doomed[_doomedCount++]     = sprite;
+}
+
+/**
+ * @brief   Destroys every sprite killed this tick: darts are parked in
+ *          the pool (a swap with the last live dart) and the rest are
+ *          removed from the canvas in one pass
+ * @note    This method is private.
+ */
+-(void)destroyDoomedSprites
+{
+    int removed = 0;
+    for (int i = 0; i < _doomedCount; i++)
+    {
+        DDSprite* sprite = _doomed[i];
+        
+        // Removing a dart? Park it in the pool; it stays on the canvas
+        // to be re-armed later
+        if ([sprite class] == [DDDart class])
+        {
+            [_darts despawn:(DDDart*)sprite];
+            continue;
+        }
+        NSLog(@"Deallocated %9p for a %@", sprite, [sprite className]);
+        _doomed[removed++] = sprite;
     }
     
-    // Lastly, clear all references to this sprite
-    NSLog(@"Deallocated %9p for a %@", sprite, [sprite className]);
+    // Remove the rest from the canvas, clearing all references to them
+    [_canvas removeSprites:_doomed count:removed];
+    _doomedCount = 0;
 }
 
 /**
@@ -162,39 +388,183 @@
 }
 
 /**
- * @brief   Checks for collisions between objects by iterating through
- *          all collidable sprites and running their check collision
- *          with method
- *
+ * @brief   Asks the autopilot which keys to hold this tick, in place
+ *          of the player: it looks ahead at where the darts will fall
+ *          and steers the balloon out of their way (or, with none in
+ *          the way, towards a health kit)
+ * @return  DDKEY_LEFT, DDKEY_RIGHT or no keys
+ */
+-(DDKeys) autopilotKeys
+{
+    DDAutopilotView view;
+    DDHealth*       health = [_canvas getSprite:[DDHealth class]];
+    
+    view.balloon        = *_balloon.outerCollisionMask.tri;
+    view.speed          = _balloon.isAlive ? _speed : 0;
+    view.screenWidth    = [SGGraphics screenWidth];
+    view.hasHealth      = health != nil;
+    view.healthX        = health ? rectangle_center_bottom_inline([health getCollisionMask].rect).x : 0;
+    view.dartCount      = MIN(_darts.count, DD_AUTOPILOT_MAX_DARTS);
+    for (int i = 0; i < view.dartCount; i++)
+    {
+        view.darts[i] = rectangle_center_bottom_inline([[_darts dartAtIndex:i] getCollisionMask].rect);
+    }
+    
+    _autopilotSteer = dd_autopilot_steer(&view, _autopilotSteer);
+    if (_autopilotSteer < 0) { return DDKEY_LEFT;  }
+    if (_autopilotSteer > 0) { return DDKEY_RIGHT; }
+    return 0;
+}
+
+/**
+ * @brief   Tests the first darts of the collision batch against the
+ *          balloon's (and its duplicate's) triangles, marking the hits
+ *          in _balloonHits
  * @note    This method is private.
+ * @param   count
+ *          Number of darts, from the start of the batch, to test
  */
--(void)checkCollisions
+-(void)testDartBatchAgainstBalloon:(int) count
 {
-    for (int i = 0; i < _darts.count; i++ )             // For every dart
+    DDBalloon* dup = _balloon.duplicate;
+    
+    dd_hit_mask_clear(_balloonHits, count);
+    dd_rect_batch_bottoms_in_triangle(&_dartBatch, count, _balloon.innerCollisionMask.tri,
+                                      _balloonHits);
+    dd_rect_batch_bottoms_in_triangle(&_dartBatch, count, _balloon.outerCollisionMask.tri,
+                                      _balloonHits);
+    if (dup)
     {
-        // Check collision with balloon
-        if ([_balloon collideWithSprite:[_darts objectAtIndex:i]])
+        dd_rect_batch_bottoms_in_triangle(&_dartBatch, count, dup.innerCollisionMask.tri,
+                                          _balloonHits);
+        dd_rect_batch_bottoms_in_triangle(&_dartBatch, count, dup.outerCollisionMask.tri,
+                                          _balloonHits);
+    }
+}
+
+/**
+ * @brief   Marks the darts in the collision grid that share a cell with
+ *          the balloon or its duplicate, where they are now
+ * @note    This method is private.
+ */
+-(void)markDartsNearBalloon
+{
+    DDBalloon* dup = _balloon.duplicate;
+    
+    [_grid markItemsNear:rectangle_from_triangle_inline(_balloon.outerCollisionMask.tri)
+                withFlag:DD_NEAR_BALLOON];
+    if (dup)
+    {
+        [_grid markItemsNear:rectangle_from_triangle_inline(dup.outerCollisionMask.tri)
+                    withFlag:DD_NEAR_BALLOON];
+    }
+}
+
+/**
+ * @brief   Gathers the marked darts below a DDDartPool slot into the
+ *          collision batch, from the highest slot down until the batch
+ *          is full, and tests them all against the balloon (marking the
+ *          hits in _balloonHits) and the health kit (in _healthHits)
+ * @note    This method is private.
+ * @param   slot
+ *          The slot to gather darts below
+ * @return  Number of darts gathered, or 0 if there are none left
+ */
+-(int)gatherDartsBelowSlot:(int) slot
+{
+    dd_rect_batch_clear(&_dartBatch);
+    for (int i = slot - 1; i >= 0 && _dartBatch.count < DD_RECT_BATCH_CAPACITY; i--)
+    {
+        if ([_grid marksForItem:i])
         {
-            if (!_balloon.isAlive && [_dyingTimer ticks] == 0)      // This dart killed the player?
-                [_dyingTimer start];                                // Start death timer
+            int b = dd_rect_batch_add(&_dartBatch,
+                                      [[_darts dartAtIndex:i] getCollisionMask].rect);
+            _batchSlots[b] = i;
         }
-        // If a health kit exists in canvas?
-        if ([_canvas getSprite:[DDHealth class]])
-        {
-            DDHealth* health =
-                [_canvas getSprite:[DDHealth class]];               // Get that healthkit
-            [health collideWithSprite:_balloon];                    // Check if it collided
+    }
+    
+    [self testDartBatchAgainstBalloon:_dartBatch.count];
+    dd_hit_mask_clear(_healthHits, _dartBatch.count);
+    DDHealth* health = [_canvas getSprite:[DDHealth class]];        // Unless the balloon
+    if (health)                                                     // took it
+    {
+        point2d healthPoint = rectangle_center_bottom_inline([health getCollisionMask].rect);
+        dd_rect_batch_containing_point(&_dartBatch, _dartBatch.count, &healthPoint,
+                                       _healthHits);
+    }
+    return _dartBatch.count;
+}
+
+/**
+ * @brief   Checks for collisions between objects. Darts are first
+ *          binned into the collision grid; those sharing a cell with
+ *          the balloon or health kit are tested together by the batch
+ *          collision kernel, a batch at a time, and only the hits go on
+ *          to the collideWithSprite: methods which act on them.
+ *
+ * @note    This method is private.
+ */
+-(void)checkCollisions
+{
+    DDHealth*   health  = [_canvas getSprite:[DDHealth class]];
+    
+    // Broad phase: bin every live dart by its mask...
+    [_grid clear];
+    for (int i = 0; i < _darts.count; i++)
+    {
+        [_grid insertItem:i withBounds:*[[_darts dartAtIndex:i] getCollisionMask].rect];
+    }
+    // ...and mark the ones near something they could hit
+    [self markDartsNearBalloon];
+    if (health)
+    {
+        [_grid markItemsNear:*[health getCollisionMask].rect withFlag:DD_NEAR_HEALTH];
+        [health collideWithSprite:_balloon];                        // Check if it collided
                                                                     // with a balloon
-            [[_darts objectAtIndex:i] collideWithSprite:health];    // Check if dart hit
-                                                                    // health kit
+    }
+    
+    // Narrow phase: test the marked darts from the last slot down, a
+    // batch at a time, acting on each hit in turn
+    int slot = _darts.count;
+    while ([self gatherDartsBelowSlot:slot] > 0)
+    {
+        for (int b = 0; b < _dartBatch.count; b++)
+        {
+            BOOL moved  = NO;
+            slot        = _batchSlots[b];
+            DDDart* dart = [_darts dartAtIndex:slot];
+            
+            // Dart hit the balloon?
+            if (dd_hit_mask_test(_balloonHits, b))
+            {
+                [_balloon collideWithSprite:dart];                  // Burst or jiggle
+                if (!_balloon.isAlive && _dyingTime < 0)            // This dart killed the player?
+                    _dyingTime = 0;                                 // Start death clock
+                moved = YES;
+            }
+            // Dart hit a health kit that still exists? (looked up per dart
+            // since the previous dart may have destroyed it)
+            if (dd_hit_mask_test(_healthHits, b) && dart.active)
+            {
+                health = [_canvas getSprite:[DDHealth class]];      // Get that healthkit
+                if (health)                                         // Unless it burst the
+                    [dart collideWithSprite:health];                // balloon, check if dart
+                                                                    // hit health kit
+            }
+            
+            // A jiggle moves the balloon, perhaps near darts that weren't
+            // marked; mark around it again and gather the rest afresh
+            if (moved)
+            {
+                [self markDartsNearBalloon];
+                break;
+            }
         }
     }
     // If a cloud exists in canvas?
-    if ([_canvas getSprite:[DDCloud class]])
+    DDCloud* cloud = [_canvas getSprite:[DDCloud class]];
+    if (cloud)
     {
-        // Get that cloud
-        DDCloud* cloud =
-            [_canvas getSprite:[DDCloud class]];
         [cloud collideWithSprite:_balloon];
     }
 }
@@ -208,7 +578,7 @@
 -(void)updateDarts
 {
     // Add _maxDarts number of darts (and do not readd if _darts = _maxDarts)
-    for (int i = 0; i < _maxDarts && [_darts count] <= _maxDarts; i++)
+    for (int i = 0; i < _maxDarts && _darts.count <= _maxDarts; i++)
     {
         [self spawnDart];
     }
@@ -222,10 +592,10 @@
 -(void)updateScore
 {
     // For player alive
-    if (([_scoreTimer ticks] >= 3000/_speed) &&     // For every ~1 second (depends on _speed)
+    if ((_scoreTime >= 3000/_speed) &&              // For every ~1 second (depends on _speed)
         (_balloon.isAlive)) {                       // and balloon is alive
         _score++;
-        [_scoreTimer reset];
+        _scoreTime = 0;
         
         // Check for recovery score
         if (_score < _recScore) {                   // Actual score < recovered score?
@@ -238,27 +608,28 @@
     // If player dead?
     else if (!(_balloon.isAlive)) {
         // Death sound if not playing
-        if (![SGAudio soundEffectNamedPlaying:@"dying"])
-            [SGAudio playSoundEffect:[[SGSoundEffect alloc] initWithName:@"dying"
-                                                            fromFile:@"die-1.ogg"]];
+        if (![DDSoundBank isPlaying:DDSOUND_DYING])
+            [DDSoundBank play:DDSOUND_DYING];
         _speed = -5;
-        if ([_dyingTimer ticks] >= 500) {          // Every 1.5 secs
+        if (_dyingTime >= 500) {                   // Every 1.5 secs
             [self spawnHealth];                     // Give chance to have new health
-            [_dyingTimer reset];
+            _dyingTime = 0;
         }
-        if ([_scoreTimer ticks] >= 100) {           // Every 100ms
+        if (_scoreTime >= 100) {                    // Every 100ms
             _score -= 3;                            // Eat away at life
-            [_scoreTimer reset];
+            _scoreTime = 0;
         } else if (_score <= 0) {                   // Out of score to eat away?
-            [SGAudio stopSoundEffectNamed:@"dying"];
+            [DDSoundBank stop:DDSOUND_DYING];
             
             [SGAudio stopMusic];
-            [SGAudio playSoundEffect:[[SGSoundEffect alloc] initFromFile:@"die-2.ogg"]];
+            [DDSoundBank play:DDSOUND_DIE];
 
             [_canvas drawWithItems:@{@"center" : @"G A M E  O V E R!",
                                      @"backCol": @"red"}];
-            [SGUtils delay:3000];                               // Delay everything
+            if (_gameOverDelay > 0)
+                [SGUtils delay:_gameOverDelay];                 // Delay everything
             [SGAudio playMusicNamed:@"song" looped:-1];
+            _over = YES;
             [DDInterrupt killGame];                             // Force an interrupt to kill
                                                                 // the entire game (game over)
         }
@@ -266,7 +637,9 @@
 }
 
 /**
- * @brief   Updates game difficulty based on score
+ * @brief   Updates game difficulty based on score, looking
+ *          the round up on the difficulty curve only when
+ *          the score leaves the current one
  *
  * @note    This method is private.
  */
@@ -276,121 +649,56 @@
     float cloudChance  = 0.00f;
     // If the ballon is alive
     if (_balloon.isAlive) {
-        // Check conditions for each round
-        // ROUND 1
-        if (_score >= 0  && _score <= 9)
-        {
-            _maxDarts       = 3;
-            _speed          = 3;
-            healthChance    = 0.00f;
-            cloudChance     = 0.00f;
-        }
-        else
-        // ROUND 2
-        if (_score >= 10 && _score <= 19)
-        {
-            _maxDarts       = 4;
-            _speed          = 3;
-            healthChance    = 0.50f;
-            cloudChance     = 0.00f;
-        }
-        else
-        // ROUND 3
-        if (_score >= 20 && _score <= 29)
-        {
-            _maxDarts       = 5;
-            _speed          = 4;
-            healthChance    = 0.10f;
-            cloudChance     = 0.10f;
-        }
-        else
-        // ROUND 4
-        if (_score >= 30 && _score <= 39)
-        {
-            _maxDarts       = 8;
-            _speed          = 4;
-            healthChance    = 0.20f;
-            cloudChance     = 0.20f;
-        }
-        else
-        // ROUND 5
-        if (_score >= 40 && _score <= 49)
-        {
-            _maxDarts       = 10;
-            _speed          = 5;
-            healthChance    = 0.30f;
-            cloudChance     = 0.30f;
-        }
-        else
-        // ROUND 6
-        if (_score >= 50 && _score <= 59)
+        // Entered a new round (or the curve was reloaded)?
+        if (_score < _roundLow || _score >= _roundHigh ||
+            _roundGeneration != _difficulty->generation)
         {
-            _maxDarts       = 12;
-            _speed          = 5;
-            healthChance    = 0.50f;
-            cloudChance     = 0.50f;
-        }
-        else
-        // ROUND 7
-        if (_score >= 60 && _score <= 69)
-        {
-            _maxDarts       = 14;
-            _speed          = 6;
-            healthChance    = 0.20f;
-            cloudChance     = 0.60f;
-        } else
-        // ROUND 8
-        if (_score >= 70 && _score <= 79)
-        {
-            _maxDarts       = 18;
-            _speed          = 7;
-            healthChance    = 0.20f;
-            cloudChance     = 0.65f;
-        } else
-        // GREATER THAN ROUND 8
-        {
-            _maxDarts       = 30;
-            _speed          = 7;
-            healthChance    = 0.20f;
-            cloudChance     = 0.65f;
+            _round              = *dd_difficulty_round_at(_difficulty, _score,
+                                                          &_roundLow, &_roundHigh);
+            _roundGeneration    = _difficulty->generation;
+            _maxDarts           = _round.maxDarts;
+            _speed              = _round.speed;
         }
+        healthChance    = _round.healthChance;
+        cloudChance     = _round.cloudChance;
     }
+    // Dying sets its own speed, so look the round up again on recovery
+    else { _roundHigh = _roundLow; }
+    
     // Now check the chance timer for > 3500
     // and create health and clouds accordingly
     // to their chances
-    if ([_chanceTimer ticks] > 3500)
+    if (_chanceTime > 3500)
     {
         // Cloud isn't on screen (i.e. doesn't exist) and
         // rnd is < chance possibility?
         if (![_canvas getSprite:[DDCloud class]] &&
-            [SGUtils rnd] < cloudChance)
+            dd_random_float(&_rng) < cloudChance)
         {
             [self spawnCloud];
         }
         // Health isn't on screen (i.e. doesn't exist) and
         // rnd is < chance possibility?
         if (![_canvas getSprite:[DDCloud class]] &&
-            [SGUtils rnd] < healthChance)
+            dd_random_float(&_rng) < healthChance)
         {
             [self spawnHealth];
         }
         
         // Reset the timer for next time
-        [_chanceTimer reset];
+        _chanceTime = 0;
     }
 }
 
 /**
- * @brief   Adds a singular dart, which is created
- *          and initalised here, to _darts
+ * @brief   Adds a singular dart to play, re-arming one
+ *          from the _darts pool where possible
  *
  * @note    This method is private.
  */
 -(void)spawnDart
 {
-    DDDart* dartToAdd = [[DDDart alloc] initInGame:self];
-    [_darts addObject:dartToAdd];
-    [dartToAdd release];
+    [_darts spawn];
 }
 
 /**
@@ -403,16 +711,16 @@
 -(void)spawnCloud
 {
     // 50/50 Chance
-    float side = [SGUtils rnd];
+    float side = dd_random_float(&_rng);
     DDDirection dir;
     
     if (side > 0.50f) { dir = DDRIGHT; }
     else              { dir = DDLEFT;  }
     
-    // Although this variable is unused, it is still referenced
-    // by the _canvas' _sprites collection; ARC therefore doesn't
-    // destroy it because it is still being referenced!
-    DDCloud* __unused cloud = [[DDCloud alloc] initInGame:self inDirection:dir];
+    // The cloud adds itself to the _canvas' _sprites collection,
+    // which keeps it until it is killed
+    DDCloud* cloud = [[DDCloud alloc] initInGame:self inDirection:dir];
+    [cloud release];
 }
 
 /**
@@ -422,10 +730,10 @@
  */
 -(void)spawnHealth
 {
-    // Although this variable is unused, it is still referenced
-    // by the _canvas' _sprites collection; ARC therefore doesn't
-    // destroy it because it is still being referenced!
-    DDHealth* __unused health = [[DDHealth alloc] initInGame:self];
+    // The health kit adds itself to the _canvas' _sprites collection,
+    // which keeps it until it is killed
+    DDHealth* health = [[DDHealth alloc] initInGame:self];
+    [health release];
 }
 
 @end
@@ -32,18 +32,26 @@
 -(id)initInGame:(DDGame*) game
 {
     if (self = [super initWithBitmapFile:@"health.png"
-                               atStaticY:-100 - [SGUtils rndUpto:200]
+                               atStaticY:-100 - dd_random_upto(game.rng, 200)
                                   inGame:game]) {
         _collisionMask  = [[DDCollisionMask alloc]
-                           initAsRectangleAtPointA:_position
-                                            pointB:[SGGeometry pointAtX:_position.x+
-                                                                        _bitmap.width
-                                                                      y:_position.y+
-                                                                        _bitmap.height]];
+                           initAsRectangle:rectangle_from(_position.x,
+                                                          _position.y,
+                                                          _bitmap.width,
+                                                          _bitmap.height)];
     }
     return self;
 }
 
+/**
+ * @brief   Releases the health kit's collision mask
+ */
+-(void) dealloc
+{
+    [_collisionMask release];
+    [super dealloc];
+}
+
 /**
  * @brief   Causes the health kit to fall down by its speed
  * @note    This method is required by the DDFallable protocol
@@ -52,18 +60,13 @@
 {
     _speed = abs(_game.speed); // Always fall down (absolute)
     _position.y += _speed;
-    NSArray* pts = [[NSArray alloc] initWithObjects:_position,
-                    [SGGeometry pointAtX:_position.x+_bitmap.width
-                                       y:_position.y+_bitmap.height],
-                    nil];
-    [_collisionMask updateWithPoints:pts];
+    [_collisionMask moveByX:0 y:_speed];
     // Automatically kill myself once off bottom of screen
     if (_position.y > [SGGraphics screenHeight])
     {
         [self kill];
         self = nil;
     };
-    [pts release];
 }
 
 /**
@@ -92,12 +95,11 @@
     {
         
         // Make mask for both outer triangle
-        SGTriangle* outerColMsk = sprite.getCollisionMask.shape;
+        const triangle* outerColMsk = sprite.getCollisionMask.tri;
         DDBalloon* balloon = (DDBalloon*)sprite;
         
         // Now check the collision
-        if ([SGGeometry triangle:outerColMsk
-             intersectsRectangle:_collisionMask.shape])
+        if (triangle_rectangle_intersect(outerColMsk, _collisionMask.rect))
         {
             [balloon oneUp];
             
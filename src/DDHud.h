@@ -8,13 +8,19 @@
 
 #import <Foundation/Foundation.h>
 
+// Forward reference classes referenced in interface
+@class DDHudLabel;
+
 @interface DDHud : NSObject {
     SGFont* _smallFnt;  //!< Defines a large font for large HUD output
     SGFont* _largeFnt;  //!< Defines a small font for small HUD output
+    DDHudLabel* _scoreLabel;    //!< Defines the in-game score (left) label
+    DDHudLabel* _patchesLabel;  //!< Defines the in-game patches (right) label
 }
 
 // Declare Methods
 -(id)   init;
 -(void) drawWithItems:(NSDictionary*) items;
+-(void) drawWithScore:(int) score patches:(int) patches;
 
 @end
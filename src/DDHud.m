@@ -12,6 +12,9 @@
 // Import my interface
 #import "DDHud.h"
 
+// Import interfaces of other classes used
+#import "DDHudLabel.h"
+
 @implementation DDHud
 
 /**
@@ -24,10 +27,64 @@
     {
         _smallFnt = [SGText loadFontFile:@"BitxMap.ttf" size:20];
         _largeFnt = [SGText loadFontFile:@"edunline.ttf" size:65];
+        
+        // Same spots as the left and right items of drawWithItems:
+        _scoreLabel     = [[DDHudLabel alloc] initWithFormat:@"%d metres"
+                                                        font:_smallFnt
+                                                       color:ColorWhite
+                                                         atX:30
+                                                           y:[SGGraphics screenHeight] - 30];
+        _patchesLabel   = [[DDHudLabel alloc] initWithFormat:@"Patches: %d"
+                                                        font:_smallFnt
+                                                       color:ColorWhite
+                                                         atX:[SGGraphics screenWidth] - 120
+                                                           y:[SGGraphics screenHeight] - 30];
     }
     return self;
 }
 
+/**
+ * @brief   Releases the in-game labels
+ */
+-(void) dealloc
+{
+    [_scoreLabel release];
+    [_patchesLabel release];
+    [super dealloc];
+}
+
+/**
+ * @brief   Draws the standard black box at the bottom of
+ *          the screen that the left and right items sit in
+ * @note    This method is private
+ */
+-(void) drawStatusBar
+{
+    [SGGraphics fill:ColorBlack
+  rectangleOnScreenX:0
+                   y:[SGGraphics screenHeight] -35
+               width:[SGGraphics screenWidth]
+              height:35];
+}
+
+/**
+ * @brief   Draws the in-game HUD: the score and patches left,
+ *          re-rendering either's text only when it has changed
+ * @param   score
+ *          The score to show on the left
+ * @param   patches
+ *          The number of patches to show on the right
+ */
+-(void) drawWithScore:(int) score patches:(int) patches
+{
+    [self drawStatusBar];
+    
+    _scoreLabel.value   = score;
+    _patchesLabel.value = patches;
+    [_scoreLabel draw];
+    [_patchesLabel draw];
+}
+
 /**
  * @brief   The draw method will vary depending on the
  *          _displayItems that need to be drawn
@@ -49,11 +106,7 @@
     if ([backCol  isEqual: @"blue"]) { [SGGraphics clearScreen:ColorBlue]; }
     
     // Standard black box at bottom of screen
-    [SGGraphics fill:ColorBlack
-  rectangleOnScreenX:0
-                   y:[SGGraphics screenHeight] -35
-               width:[SGGraphics screenWidth]
-              height:35];
+    [self drawStatusBar];
     
     // If left string exists
     if (left)
@@ -0,0 +1,43 @@
+/**
+ * @class   DDHudLabel
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a retained HUD element showing a number (such as
+ *          the score), whose text is rendered to a bitmap only when
+ *          the number changes and blitted from it every frame.
+ */
+
+#import <Foundation/Foundation.h>
+
+// Import SwinGame types (for color)
+#import "Types.h"
+
+// Forward reference classes referenced in interface
+@class SGFont, SGBitmap;
+
+@interface DDHudLabel : NSObject
+{
+    // Declare ivars
+    NSString*   _format;    //!< Defines the format the value is shown with (one %d)
+    SGFont*     _font;      //!< Defines the font the text is rendered in
+    color       _color;     //!< Defines the colour the text is rendered in
+    int         _x;         //!< Defines where the text is drawn along the x axis
+    int         _y;         //!< Defines where the text is drawn along the y axis
+    int         _value;     //!< Defines the value shown
+    BOOL        _rendered;  //!< Defines whether _bitmap shows the current _value
+    SGBitmap*   _bitmap;    //!< Defines the rendered text, or nil before the first draw
+    int         _renders;   //!< Defines the number of times the text has been rendered
+}
+
+// Declare properties
+@property               int     value;      //!< Allows access to the value shown; setting
+                                            //!< a new value renders it on the next draw
+@property   (readonly)  int     renders;    //!< Readonly access to the number of renders,
+                                            //!< for profiling
+
+// Declare methods
+-(id)   initWithFormat:(NSString*) format font:(SGFont*) font color:(color) textColor
+                   atX:(int) x y:(int) y;
+-(void) draw;
+
+@end
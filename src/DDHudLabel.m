@@ -0,0 +1,124 @@
+/**
+ * @class   DDHudLabel
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a retained HUD element showing a number, rendered
+ *          to a bitmap only when the number changes.
+ */
+
+// Import SwinGame Framework
+#import "SwinGame.h"
+
+// Import my interface
+#import "DDHudLabel.h"
+
+@implementation DDHudLabel
+
+// Synthesize properties
+@synthesize value   = _value;
+@synthesize renders = _renders;
+
+/**
+ * @brief   The constructor for DDHudLabel
+ * @param   format
+ *          Format the value is shown with, containing one %d
+ * @param   font
+ *          Font the text is rendered in
+ * @param   textColor
+ *          Colour the text is rendered in
+ * @param   x
+ *          Where the text is drawn along the x axis
+ * @param   y
+ *          Where the text is drawn along the y axis
+ * @return  The class's self pointer
+ */
+-(id) initWithFormat:(NSString*) format font:(SGFont*) font color:(color) textColor
+                 atX:(int) x y:(int) y
+{
+    if (self = [super init])
+    {
+        _format     = [format copy];
+        _font       = [font retain];
+        _color      = textColor;
+        _x          = x;
+        _y          = y;
+        _value      = 0;
+        _rendered   = NO;
+        _bitmap     = nil;
+        _renders    = 0;
+    }
+    return self;
+}
+
+/**
+ * @brief   Frees the rendered text and releases the format and font
+ */
+-(void) dealloc
+{
+    if (_bitmap)
+    {
+        [SGImages freeBitmap:_bitmap];
+        [_bitmap release];
+    }
+    [_format release];
+    [_font release];
+    [super dealloc];
+}
+
+/**
+ * @brief   Manual synthesis for the value shown, to pair with the
+ *          setter below
+ * @return  The value shown
+ */
+-(int) value
+{
+    return _value;
+}
+
+/**
+ * @brief   Manual synthesis for the value shown, marking the
+ *          text to be rendered again only if it changed
+ * @param   value
+ *          The value to show
+ */
+-(void) setValue:(int) value
+{
+    if (value != _value)
+    {
+        _value      = value;
+        _rendered   = NO;
+    }
+}
+
+/**
+ * @brief   Renders the value's text to a new bitmap, freeing
+ *          the previous one
+ * @note    This method is private
+ */
+-(void) render
+{
+    SGBitmap* bitmap = [SGText drawTextFont:_font
+                                     string:[NSString stringWithFormat:_format, _value]
+                                  textColor:_color
+                            backgroundColor:ColorTransparent];
+    if (_bitmap)
+    {
+        [SGImages freeBitmap:_bitmap];
+        [_bitmap release];
+    }
+    _bitmap     = [bitmap retain];
+    _rendered   = YES;
+    _renders++;
+}
+
+/**
+ * @brief   Draws the label, rendering its text first only if
+ *          the value has changed since it was last rendered
+ */
+-(void) draw
+{
+    if (!_rendered) { [self render]; }
+    [SGImages draw:_bitmap x:_x y:_y];
+}
+
+@end
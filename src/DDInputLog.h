@@ -0,0 +1,72 @@
+/**
+ * @typedef DDKey
+ * @brief   Defines the keys Dart Dodger responds to, as bits of a
+ *          DDKeys set polled once per frame.
+ */
+typedef enum DDKey
+{
+    DDKEY_LEFT  = 1 << 0,   //!< Left arrow held (move balloon left)
+    DDKEY_RIGHT = 1 << 1,   //!< Right arrow held (move balloon right)
+    DDKEY_P     = 1 << 2,   //!< P typed (play/pause)
+    DDKEY_S     = 1 << 3,   //!< S held (reset high score from the menu)
+    DDKEY_SPACE = 1 << 4,   //!< Spacebar held (debug view)
+    DDKEY_Q     = 1 << 5,   //!< Q held (score cheat, with spacebar)
+    DDKEY_C     = 1 << 6,   //!< C typed (cloud cheat, with spacebar)
+    DDKEY_H     = 1 << 7    //!< H typed (health cheat, with spacebar)
+} DDKey;
+
+/**
+ * @typedef DDKeys
+ * @brief   Defines a set of DDKey bits
+ */
+typedef unsigned char DDKeys;
+
+/**
+ * @class   DDInputLog
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a recording of a session's input: the random seed
+ *          and tick rate it was played with, then the keys polled and
+ *          number of simulation ticks run on every frame. Replaying
+ *          the frames in order reproduces the session exactly.
+ * @note    The file is a 12 byte header (the magic "DDIL", a version
+ *          byte, a reserved byte, the tick rate as 16 bits and the seed
+ *          as 32 bits, all little-endian) followed by 3 bytes a frame:
+ *          the DDKeys byte and the tick count as 16 bits. Since version
+ *          2, a frame of 0xffff ticks instead starts a difficulty table
+ *          record: a round count byte, then 20 bytes a round (its score,
+ *          darts and speed as 32 bits, then its health kit and cloud
+ *          chances as 32 bit floats), which holds from the next frame.
+ */
+#import <Foundation/Foundation.h>
+
+// Import the difficulty curve (for DDDifficulty)
+#import "DDDifficulty.h"
+
+@interface DDInputLog : NSObject
+{
+    // Declare ivars
+    NSMutableData*  _data;      //!< Defines the header and every frame recorded (or read)
+    uint32_t        _seed;      //!< Defines the random seed the session was played with
+    int             _tickRate;  //!< Defines the simulation ticks per second of the session
+    NSUInteger      _cursor;    //!< Defines where the next frame is read from on replay
+    NSUInteger      _frameCount;//!< Defines the number of frames recorded (or read)
+    int             _version;   //!< Defines the format version of the log
+}
+
+// Declare properties
+@property   (readonly)  uint32_t    seed;       //!< Readonly access to the session's seed
+@property   (readonly)  int         tickRate;   //!< Readonly access to the session's tick
+                                                //!< rate, restored by DDController on replay
+@property   (readonly)  NSUInteger  frameCount; //!< Readonly access to the number of frames
+                                                //!< in the log
+
+// Declare methods
+-(id)   initWithSeed:(uint32_t) seed tickRate:(int) tickRate;
+-(id)   initWithContentsOfFile:(NSString*) path;
+-(void) recordFrameWithKeys:(DDKeys) keys ticks:(int) ticks;
+-(void) recordDifficulty:(const DDDifficulty*) curve;
+-(BOOL) nextFrameKeys:(DDKeys*) keys ticks:(int*) ticks difficulty:(DDDifficulty*) curve;
+-(BOOL) writeToFile:(NSString*) path;
+
+@end
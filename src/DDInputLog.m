@@ -0,0 +1,273 @@
+/**
+ * @class   DDInputLog
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines a recording of a session's input which can be
+ *          written to and replayed from a compact binary file.
+ */
+
+// Import my interface
+#import "DDInputLog.h"
+
+/**
+ * @brief   Magic bytes at the start of every input log
+ */
+#define DD_INPUT_LOG_MAGIC      "DDIL"
+
+/**
+ * @brief   Version of the input log format written
+ */
+#define DD_INPUT_LOG_VERSION    2
+
+/**
+ * @brief   Size of the input log header in bytes
+ */
+#define DD_INPUT_LOG_HEADER     12
+
+/**
+ * @brief   Size of each recorded frame in bytes
+ */
+#define DD_INPUT_LOG_FRAME      3
+
+/**
+ * @brief   Tick count of a frame that instead starts a difficulty table
+ *          record (since version 2)
+ */
+#define DD_INPUT_LOG_TABLE      0xffff
+
+/**
+ * @brief   Size of each round of a difficulty table record in bytes
+ */
+#define DD_INPUT_LOG_ROUND      20
+
+/**
+ * @brief   Writes 32 bits little-endian
+ * @param   bytes
+ *          Where to write them
+ * @param   value
+ *          The bits to write
+ */
+static void dd_put32(unsigned char* bytes, uint32_t value)
+{
+    bytes[0] = value & 0xff;            bytes[1] = (value >> 8) & 0xff;
+    bytes[2] = (value >> 16) & 0xff;    bytes[3] = (value >> 24) & 0xff;
+}
+
+/**
+ * @brief   Reads 32 bits little-endian
+ * @param   bytes
+ *          Where to read them from
+ * @return  The bits read
+ */
+static uint32_t dd_get32(const unsigned char* bytes)
+{
+    return (uint32_t)bytes[0]       | (uint32_t)bytes[1] << 8 |
+           (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+}
+
+@implementation DDInputLog
+
+// Synthesize properties
+@synthesize seed        = _seed;
+@synthesize tickRate    = _tickRate;
+@synthesize frameCount  = _frameCount;
+
+/**
+ * @brief   Constructor for a new, empty log to record a session into
+ * @param   seed
+ *          The random seed the session is played with
+ * @param   tickRate
+ *          The simulation ticks per second the session is played at
+ * @return  The class's self pointer
+ */
+-(id)initWithSeed:(uint32_t) seed tickRate:(int) tickRate
+{
+    if (self = [super init])
+    {
+        unsigned char header[DD_INPUT_LOG_HEADER] =
+        {
+            'D', 'D', 'I', 'L', DD_INPUT_LOG_VERSION, 0,
+            tickRate & 0xff, (tickRate >> 8) & 0xff,
+            seed & 0xff, (seed >> 8) & 0xff, (seed >> 16) & 0xff, (seed >> 24) & 0xff
+        };
+
+        _seed       = seed;
+        _tickRate   = tickRate;
+        _data       = [[NSMutableData alloc] initWithBytes:header length:DD_INPUT_LOG_HEADER];
+        _cursor     = DD_INPUT_LOG_HEADER;
+        _frameCount = 0;
+        _version    = DD_INPUT_LOG_VERSION;
+    }
+    return self;
+}
+
+/**
+ * @brief   Constructor for a log read back from a file for replay
+ * @param   path
+ *          Path of the input log file
+ * @return  The class's self pointer, or nil if the file could not be
+ *          read or is not an input log
+ */
+-(id)initWithContentsOfFile:(NSString*) path
+{
+    if (self = [super init])
+    {
+        _data = [[NSMutableData alloc] initWithContentsOfFile:path];
+        const unsigned char* bytes = [_data bytes];
+
+        // Missing, truncated or from an unknown version?
+        if (!_data || [_data length] < DD_INPUT_LOG_HEADER ||
+            memcmp(bytes, DD_INPUT_LOG_MAGIC, 4) != 0 ||
+            bytes[4] < 1 || bytes[4] > DD_INPUT_LOG_VERSION)
+        {
+            NSLog(@"%@ is not a Dart Dodger input log", path);
+            [self release];
+            return nil;
+        }
+
+        _tickRate   = bytes[6] | bytes[7] << 8;
+        _seed       = (uint32_t)bytes[8]        | (uint32_t)bytes[9]  << 8 |
+                      (uint32_t)bytes[10] << 16 | (uint32_t)bytes[11] << 24;
+        _version    = bytes[4];
+        _cursor     = DD_INPUT_LOG_HEADER;
+
+        // Count the whole frames, stepping over any difficulty tables
+        DDKeys keys;
+        int    ticks;
+        _frameCount = 0;
+        while ([self nextFrameKeys:&keys ticks:&ticks difficulty:NULL]) { _frameCount++; }
+        _cursor     = DD_INPUT_LOG_HEADER;
+    }
+    return self;
+}
+
+/**
+ * @brief   Releases the recorded data
+ */
+-(void)dealloc
+{
+    [_data release];
+    [super dealloc];
+}
+
+/**
+ * @brief   Appends a frame to the log
+ * @param   keys
+ *          The keys polled at the start of the frame
+ * @param   ticks
+ *          The number of simulation ticks run in the frame
+ */
+-(void) recordFrameWithKeys:(DDKeys) keys ticks:(int) ticks
+{
+    // Far more ticks than DD_MAX_FRAME_TIME allows at any sane tick rate
+    if (ticks >= DD_INPUT_LOG_TABLE) { ticks = DD_INPUT_LOG_TABLE - 1; }
+
+    unsigned char frame[DD_INPUT_LOG_FRAME] = { keys, ticks & 0xff, (ticks >> 8) & 0xff };
+    [_data appendBytes:frame length:DD_INPUT_LOG_FRAME];
+    _frameCount++;
+}
+
+/**
+ * @brief   Appends the difficulty table the session plays from the next
+ *          frame on (once at the start, then whenever it is reloaded)
+ * @param   curve
+ *          The curve whose rounds are recorded
+ */
+-(void) recordDifficulty:(const DDDifficulty*) curve
+{
+    unsigned char record[DD_INPUT_LOG_FRAME + 1] =
+    {
+        0, DD_INPUT_LOG_TABLE & 0xff, DD_INPUT_LOG_TABLE >> 8, curve->roundCount
+    };
+    [_data appendBytes:record length:sizeof(record)];
+
+    for (int i = 0; i < curve->roundCount; i++)
+    {
+        const DDRound*  round = &curve->rounds[i];
+        unsigned char   bytes[DD_INPUT_LOG_ROUND];
+        uint32_t        healthChance, cloudChance;
+
+        memcpy(&healthChance, &round->healthChance, sizeof(uint32_t));
+        memcpy(&cloudChance,  &round->cloudChance,  sizeof(uint32_t));
+        dd_put32(bytes,      (uint32_t)round->score);
+        dd_put32(bytes + 4,  (uint32_t)round->maxDarts);
+        dd_put32(bytes + 8,  (uint32_t)round->speed);
+        dd_put32(bytes + 12, healthChance);
+        dd_put32(bytes + 16, cloudChance);
+        [_data appendBytes:bytes length:DD_INPUT_LOG_ROUND];
+    }
+}
+
+/**
+ * @brief   Reads the next frame of the log for replay, first loading
+ *          any difficulty table recorded ahead of it
+ * @param   keys
+ *          Set to the keys polled at the start of the frame
+ * @param   ticks
+ *          Set to the number of simulation ticks run in the frame
+ * @param   curve
+ *          The curve recorded tables are loaded into, or NULL to skip
+ *          them
+ * @return  YES if a frame was read, NO once every frame has been read
+ */
+-(BOOL) nextFrameKeys:(DDKeys*) keys ticks:(int*) ticks difficulty:(DDDifficulty*) curve
+{
+    const unsigned char* bytes = [_data bytes];
+    NSUInteger           length = [_data length];
+
+    while (_cursor + DD_INPUT_LOG_FRAME <= length)
+    {
+        const unsigned char* frame = bytes + _cursor;
+        int                  count;
+
+        // An ordinary frame?
+        if (_version < 2 || (frame[1] | frame[2] << 8) != DD_INPUT_LOG_TABLE)
+        {
+            *keys   = frame[0];
+            *ticks  = frame[1] | frame[2] << 8;
+            _cursor += DD_INPUT_LOG_FRAME;
+            return YES;
+        }
+
+        // A difficulty table, cut short?
+        if (_cursor + DD_INPUT_LOG_FRAME + 1 > length) { return NO; }
+        count = frame[DD_INPUT_LOG_FRAME];
+        if (_cursor + DD_INPUT_LOG_FRAME + 1 + count * DD_INPUT_LOG_ROUND > length) { return NO; }
+
+        if (curve)
+        {
+            DDRound rounds[UCHAR_MAX];
+            const unsigned char* round = frame + DD_INPUT_LOG_FRAME + 1;
+            for (int i = 0; i < count; i++, round += DD_INPUT_LOG_ROUND)
+            {
+                uint32_t healthChance = dd_get32(round + 12);
+                uint32_t cloudChance  = dd_get32(round + 16);
+
+                rounds[i].score     = (int32_t)dd_get32(round);
+                rounds[i].maxDarts  = (int32_t)dd_get32(round + 4);
+                rounds[i].speed     = (int32_t)dd_get32(round + 8);
+                memcpy(&rounds[i].healthChance, &healthChance, sizeof(float));
+                memcpy(&rounds[i].cloudChance,  &cloudChance,  sizeof(float));
+            }
+            if (dd_difficulty_set_rounds(curve, rounds, count) != DD_DIFFICULTY_LOADED)
+            {
+                NSLog(@"Bad difficulty table in the input log; keeping the previous rounds");
+            }
+        }
+        _cursor += DD_INPUT_LOG_FRAME + 1 + count * DD_INPUT_LOG_ROUND;
+    }
+    return NO;
+}
+
+/**
+ * @brief   Writes the log to a file
+ * @param   path
+ *          Path of the file to write (replacing it if it exists)
+ * @return  YES if the file was written
+ */
+-(BOOL) writeToFile:(NSString*) path
+{
+    return [_data writeToFile:path atomically:YES];
+}
+
+@end
@@ -0,0 +1,104 @@
+/**
+ * @file    DDMemory.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the memory monitor.
+ */
+
+#include "DDMemory.h"
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(__linux__)
+#include <malloc.h>
+#endif
+
+/**
+ * @brief   Reads how many bytes the heap has handed out and not had back
+ * @return  Bytes in use, or 0 where the allocator can't say
+ */
+size_t dd_memory_in_use(void)
+{
+#if defined(__APPLE__)
+    malloc_statistics_t stats;
+    malloc_zone_statistics(NULL, &stats);
+    return stats.size_in_use;
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief   Starts a monitor with nothing seen
+ * @param   monitor
+ *          The monitor
+ * @param   budget
+ *          Bytes a frame may allocate before it is flagged
+ */
+void dd_memory_init(DDMemoryMonitor *monitor, size_t budget)
+{
+    size_t inUse = dd_memory_in_use();
+
+    monitor->budget     = budget;
+    monitor->frameStart = inUse;
+    monitor->frameBytes = 0;
+    monitor->worstFrame = 0;
+    monitor->highWater  = inUse;
+    monitor->reported   = inUse;
+    monitor->frames     = 0;
+    monitor->overBudget = 0;
+}
+
+/**
+ * @brief   Begins a frame, after the last frame's pool has drained,
+ *          so that what is in use now is what the frames have kept
+ * @param   monitor
+ *          The monitor
+ * @return  DD_MEMORY_HIGH_WATER if what is kept has grown a step past
+ *          the high-water mark last reported, otherwise 0
+ */
+int dd_memory_frame_begin(DDMemoryMonitor *monitor)
+{
+    size_t inUse = dd_memory_in_use();
+
+    monitor->frameStart = inUse;
+    if (inUse > monitor->highWater) { monitor->highWater = inUse; }
+    if (monitor->highWater >= monitor->reported + DD_MEMORY_HIGH_WATER_STEP)
+    {
+        monitor->reported = monitor->highWater;
+        return DD_MEMORY_HIGH_WATER;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Ends a frame, before its pool drains, so that its
+ *          temporaries are counted
+ * @param   monitor
+ *          The monitor
+ * @return  DD_MEMORY_OVER_BUDGET if the frame allocated more than the
+ *          budget, with DD_MEMORY_WORST_FRAME if it is the most any
+ *          frame has; otherwise 0
+ */
+int dd_memory_frame_end(DDMemoryMonitor *monitor)
+{
+    size_t inUse = dd_memory_in_use();
+    int flags = 0;
+
+    monitor->frameBytes = inUse > monitor->frameStart ? inUse - monitor->frameStart : 0;
+    monitor->frames++;
+    if (monitor->frameBytes > monitor->budget)
+    {
+        flags |= DD_MEMORY_OVER_BUDGET;
+        monitor->overBudget++;
+    }
+    if (monitor->frameBytes > monitor->worstFrame)
+    {
+        monitor->worstFrame = monitor->frameBytes;
+        if (flags) { flags |= DD_MEMORY_WORST_FRAME; }
+    }
+    return flags;
+}
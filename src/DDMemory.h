@@ -0,0 +1,64 @@
+/**
+ * @file    DDMemory.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the memory monitor: it reads how much the heap has
+ *          handed out at the start and end of every frame, flags frames
+ *          that allocate more than a budget of temporaries, and keeps
+ *          the high-water mark of what stays in use between frames, so
+ *          that a slow leak in a long-running build shows in the log.
+ * @note    Each frame runs in its own autorelease pool: the frame is
+ *          ended before the pool drains (so its temporaries are still
+ *          counted) and the next frame begins after it has drained (so
+ *          only what was kept is).
+ */
+
+#ifndef DDMemory_h
+#define DDMemory_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief   Bytes of temporaries a frame may allocate before it is flagged
+ */
+#define DD_MEMORY_FRAME_BUDGET      (256 * 1024)
+
+/**
+ * @brief   Growth of the high-water mark between reports of it
+ */
+#define DD_MEMORY_HIGH_WATER_STEP   (1024 * 1024)
+
+/**
+ * @brief   Flags returned by dd_memory_frame_begin and dd_memory_frame_end
+ */
+enum
+{
+    DD_MEMORY_OVER_BUDGET   = 0x01, //!< The frame allocated more than the budget
+    DD_MEMORY_WORST_FRAME   = 0x02, //!< ...and more than any frame before it
+    DD_MEMORY_HIGH_WATER    = 0x04  //!< Memory kept between frames passed the next step
+};
+
+/**
+ * @struct  DDMemoryMonitor
+ * @brief   Memory use seen over a run of frames
+ */
+typedef struct DDMemoryMonitor
+{
+    size_t      budget;         //!< Bytes a frame may allocate before it is flagged
+    size_t      frameStart;     //!< Bytes in use at the start of the current frame
+    size_t      frameBytes;     //!< Bytes the last frame allocated (and had not freed
+                                //!< before its pool drained)
+    size_t      worstFrame;     //!< Most bytes any frame allocated
+    size_t      highWater;      //!< Most bytes in use between frames
+    size_t      reported;       //!< High-water mark as last reported
+    uint64_t    frames;         //!< Frames ended
+    uint64_t    overBudget;     //!< Frames that went over the budget
+} DDMemoryMonitor;
+
+size_t  dd_memory_in_use(void);
+void    dd_memory_init(DDMemoryMonitor *monitor, size_t budget);
+int     dd_memory_frame_begin(DDMemoryMonitor *monitor);
+int     dd_memory_frame_end(DDMemoryMonitor *monitor);
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * @file    DDProfiler.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the frame profiler's percentiles and exports.
+ */
+
+#include "DDProfiler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief   Names of the phases, as shown and exported
+ */
+static const char *dd_phase_names[DDPHASE_COUNT] =
+{
+    "collisions", "difficulty", "darts", "score", "fall", "draw"
+};
+
+/**
+ * @brief   Finds the oldest sample still in the ring buffer
+ * @param   head
+ *          The number of samples taken, as read by the caller
+ * @return  The index (counting every sample ever taken) of the oldest
+ */
+static uint64_t dd_profile_oldest(uint64_t head)
+{
+    return head > DD_PROFILE_CAPACITY ? head - DD_PROFILE_CAPACITY : 0;
+}
+
+/**
+ * @brief   Orders durations for qsort
+ */
+static int dd_profile_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief   Empties a profiler and starts its clock
+ * @param   profiler
+ *          The profiler to reset
+ */
+void dd_profile_init(DDProfiler *profiler)
+{
+    profiler->head      = 0;
+    profiler->origin    = dd_profile_now();
+}
+
+/**
+ * @brief   Names a phase
+ * @param   phase
+ *          The phase
+ * @return  The phase's name, or "?" if it is not a phase
+ */
+const char* dd_profile_phase_name(DDPhase phase)
+{
+    return phase < DDPHASE_COUNT ? dd_phase_names[phase] : "?";
+}
+
+/**
+ * @brief   Works out the median, 95th and 99th percentile durations of
+ *          a phase over the samples still in the ring buffer
+ * @param   profiler
+ *          The profiler
+ * @param   phase
+ *          The phase
+ * @param   p50
+ *          Set to the median, in microseconds
+ * @param   p95
+ *          Set to the 95th percentile, in microseconds
+ * @param   p99
+ *          Set to the 99th percentile, in microseconds
+ * @return  The number of samples of the phase (the percentiles are
+ *          left untouched if there are none)
+ */
+int dd_profile_percentiles(const DDProfiler *profiler, DDPhase phase,
+                           float *p50, float *p95, float *p99)
+{
+    uint32_t durations[DD_PROFILE_CAPACITY];
+    int count = 0;
+
+    uint64_t head = __atomic_load_n(&profiler->head, __ATOMIC_ACQUIRE);
+    for (uint64_t i = dd_profile_oldest(head); i < head; i++)
+    {
+        const DDProfileSample *sample = &profiler->samples[i & (DD_PROFILE_CAPACITY - 1)];
+        if (sample->phase == (uint32_t)phase) { durations[count++] = sample->duration; }
+    }
+    if (!count) { return 0; }
+
+    qsort(durations, count, sizeof(uint32_t), dd_profile_compare);
+    *p50 = durations[(count - 1) * 50 / 100] / 1000.0f;
+    *p95 = durations[(count - 1) * 95 / 100] / 1000.0f;
+    *p99 = durations[(count - 1) * 99 / 100] / 1000.0f;
+    return count;
+}
+
+/**
+ * @brief   Writes the samples still in the ring buffer as CSV, one
+ *          line a sample (phase, start and duration in nanoseconds,
+ *          the start counted from dd_profile_init), oldest first
+ * @param   profiler
+ *          The profiler
+ * @param   path
+ *          Path of the file to write
+ * @return  The number of samples written, or -1 if the file could
+ *          not be written
+ */
+int dd_profile_write_csv(const DDProfiler *profiler, const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (!file) { return -1; }
+
+    uint64_t head = __atomic_load_n(&profiler->head, __ATOMIC_ACQUIRE);
+    uint64_t oldest = dd_profile_oldest(head);
+
+    fprintf(file, "phase,start_ns,duration_ns\n");
+    for (uint64_t i = oldest; i < head; i++)
+    {
+        const DDProfileSample *sample = &profiler->samples[i & (DD_PROFILE_CAPACITY - 1)];
+        fprintf(file, "%s,%llu,%lu\n", dd_profile_phase_name(sample->phase),
+                (unsigned long long)(sample->start - profiler->origin),
+                (unsigned long)sample->duration);
+    }
+    return fclose(file) == 0 ? (int)(head - oldest) : -1;
+}
+
+/**
+ * @brief   Writes the samples still in the ring buffer as a Chrome
+ *          trace: one complete ("X") event a sample, in microseconds
+ * @param   profiler
+ *          The profiler
+ * @param   path
+ *          Path of the file to write
+ * @return  The number of samples written, or -1 if the file could
+ *          not be written
+ */
+int dd_profile_write_trace(const DDProfiler *profiler, const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (!file) { return -1; }
+
+    uint64_t head = __atomic_load_n(&profiler->head, __ATOMIC_ACQUIRE);
+    uint64_t oldest = dd_profile_oldest(head);
+
+    fprintf(file, "{\"traceEvents\":[");
+    for (uint64_t i = oldest; i < head; i++)
+    {
+        const DDProfileSample *sample = &profiler->samples[i & (DD_PROFILE_CAPACITY - 1)];
+        fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                      "\"ts\":%.3f,\"dur\":%.3f}",
+                i == oldest ? "" : ",", dd_profile_phase_name(sample->phase),
+                (sample->start - profiler->origin) / 1000.0, sample->duration / 1000.0);
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ns\"}\n");
+    return fclose(file) == 0 ? (int)(head - oldest) : -1;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file    DDProfiler.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the frame profiler: timers around each phase of a
+ *          simulation tick and of drawing, read off a monotonic clock
+ *          in nanoseconds and kept in a ring buffer of the most recent
+ *          samples, from which percentiles are worked out for the debug
+ *          view and which can be written out as CSV or as a Chrome
+ *          trace (load it at chrome://tracing or ui.perfetto.dev).
+ */
+
+#ifndef DDProfiler_h
+#define DDProfiler_h
+
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief   Number of samples the ring buffer keeps (a power of two)
+ */
+#define DD_PROFILE_CAPACITY     4096
+
+/**
+ * @typedef DDPhase
+ * @brief   Defines the phases of a frame that are timed
+ */
+typedef enum DDPhase
+{
+    DDPHASE_COLLISIONS,     //!< DDGame checkCollisions
+    DDPHASE_DIFFICULTY,     //!< DDGame updateDifficulty
+    DDPHASE_DARTS,          //!< DDGame updateDarts
+    DDPHASE_SCORE,          //!< DDGame updateScore
+    DDPHASE_FALL,           //!< Every sprite's fall (and the balloon's off screen check)
+    DDPHASE_DRAW,           //!< Drawing the canvas, up to and including the refresh
+    DDPHASE_COUNT           //!< Number of phases
+} DDPhase;
+
+/**
+ * @struct  DDProfileSample
+ * @brief   One timing of one phase
+ */
+typedef struct DDProfileSample
+{
+    uint64_t    start;      //!< When the phase started (ns, monotonic clock)
+    uint32_t    duration;   //!< How long the phase took (ns)
+    uint32_t    phase;      //!< Which DDPhase was timed
+} DDProfileSample;
+
+/**
+ * @struct  DDProfiler
+ * @brief   The ring buffer of samples. It is written by one thread,
+ *          and only that thread can read the samples without a lock:
+ *          a reader on another thread could see the oldest samples
+ *          overwritten while it reads them.
+ */
+typedef struct DDProfiler
+{
+    DDProfileSample samples[DD_PROFILE_CAPACITY];   //!< The most recent samples
+    uint64_t        head;                           //!< Number of samples ever taken
+    uint64_t        origin;                         //!< Clock reading at dd_profile_init
+} DDProfiler;
+
+void        dd_profile_init(DDProfiler *profiler);
+const char* dd_profile_phase_name(DDPhase phase);
+int         dd_profile_percentiles(const DDProfiler *profiler, DDPhase phase,
+                                   float *p50, float *p95, float *p99);
+int         dd_profile_write_csv(const DDProfiler *profiler, const char *path);
+int         dd_profile_write_trace(const DDProfiler *profiler, const char *path);
+
+/**
+ * @brief   Reads the monotonic clock
+ * @return  Nanoseconds since an arbitrary point
+ */
+static inline uint64_t dd_profile_now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief   Starts timing a phase
+ * @param   profiler
+ *          The profiler, or NULL if not profiling
+ * @return  The start time, to be handed to dd_profile_end
+ */
+static inline uint64_t dd_profile_begin(const DDProfiler *profiler)
+{
+    return profiler ? dd_profile_now() : 0;
+}
+
+/**
+ * @brief   Finishes timing a phase, storing the sample in the ring
+ *          buffer over the oldest one
+ * @param   profiler
+ *          The profiler, or NULL if not profiling
+ * @param   phase
+ *          The phase timed
+ * @param   start
+ *          What dd_profile_begin returned
+ */
+static inline void dd_profile_end(DDProfiler *profiler, DDPhase phase, uint64_t start)
+{
+    if (!profiler) { return; }
+
+    uint64_t head = profiler->head;
+    DDProfileSample *sample = &profiler->samples[head & (DD_PROFILE_CAPACITY - 1)];
+    sample->start       = start;
+    sample->duration    = (uint32_t)(dd_profile_now() - start);
+    sample->phase       = phase;
+
+    // Publish the sample only once it is whole
+    __atomic_store_n(&profiler->head, head + 1, __ATOMIC_RELEASE);
+}
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @file    DDRandom.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines seeding and bulk draws for the random number
+ *          generator each DDGame owns.
+ */
+
+#include "DDRandom.h"
+
+/**
+ * @brief   Seeds a generator, spreading the 32-bit seed over all 128
+ *          bits of state (with splitmix32) so nearby seeds give
+ *          unrelated sequences
+ * @param   rng
+ *          The generator to seed
+ * @param   seed
+ *          Any value; the same seed always gives the same sequence
+ */
+void dd_random_seed(DDRandom *rng, uint32_t seed)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t z = (seed += 0x9e3779b9u);
+        z = (z ^ (z >> 16)) * 0x85ebca6bu;
+        z = (z ^ (z >> 13)) * 0xc2b2ae35u;
+        rng->s[i] = z ^ (z >> 16);
+    }
+
+    // All-zero state would only ever give zeros
+    if (!(rng->s[0] | rng->s[1] | rng->s[2] | rng->s[3])) rng->s[0] = 1;
+}
+
+/**
+ * @brief   Draws a run of spawn positions above the screen in one go,
+ *          each a random x across the screen and a random y above it
+ * @param   rng
+ *          The generator to draw from
+ * @param   points
+ *          Filled with count positions
+ * @param   count
+ *          Number of positions to draw
+ * @param   width
+ *          Positions' x is drawn from [0, width)
+ * @param   top
+ *          Positions' y is drawn from (top - depth, top]
+ * @param   depth
+ *          How far above top positions may be
+ */
+void dd_random_spawn_points(DDRandom *rng, point2d *points, int count,
+                            int width, int top, int depth)
+{
+    // Draw from a local copy so the state stays in registers rather
+    // than being stored and reloaded around every point written
+    DDRandom local = *rng;
+
+    for (int i = 0; i < count; i++)
+    {
+        // y first, then x, as DDDart's constructor has always drawn them
+        points[i].y = top - dd_random_upto(&local, depth);
+        points[i].x = dd_random_upto(&local, width);
+    }
+    *rng = local;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file    DDRandom.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the random number generator each DDGame owns
+ *          (xoshiro128**), used in place of SGUtils rnd and rndUpto:
+ *          so that a game's random numbers depend only on its seed.
+ *          Draws are inline; spawn positions can be drawn in bulk.
+ */
+
+#ifndef DDRandom_h
+#define DDRandom_h
+
+#include <stdint.h>
+
+// Import SwinGame types (for point2d)
+#include "Types.h"
+
+/**
+ * @struct  DDRandom
+ * @brief   State of one generator; seed with dd_random_seed before use.
+ */
+typedef struct DDRandom
+{
+    uint32_t s[4];  //!< The generator's 128 bits of state (never all zero)
+} DDRandom;
+
+void    dd_random_seed(DDRandom *rng, uint32_t seed);
+void    dd_random_spawn_points(DDRandom *rng, point2d *points, int count,
+                               int width, int top, int depth);
+
+/**
+ * @brief   Draws the next 32 random bits
+ * @param   rng
+ *          The generator to draw from
+ * @return  32 uniformly random bits
+ */
+static inline uint32_t dd_random_next(DDRandom *rng)
+{
+    uint32_t *s     = rng->s;
+    uint32_t x      = s[1] * 5;
+    uint32_t result = ((x << 7) | (x >> 25)) * 9;
+    uint32_t t      = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3]  = (s[3] << 11) | (s[3] >> 21);
+    return result;
+}
+
+/**
+ * @brief   Draws a random number from 0 up to (but not including) 1,
+ *          as SGUtils rnd does
+ * @param   rng
+ *          The generator to draw from
+ * @return  A random float in [0, 1)
+ */
+static inline float dd_random_float(DDRandom *rng)
+{
+    return (dd_random_next(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief   Draws a random whole number from 0 up to (but not including)
+ *          a limit, as SGUtils rndUpto: does
+ * @param   rng
+ *          The generator to draw from
+ * @param   limit
+ *          One more than the largest number wanted
+ * @return  A random int in [0, limit), or 0 if limit is not positive
+ */
+static inline int dd_random_upto(DDRandom *rng, int limit)
+{
+    if (limit <= 0) return 0;
+    return (int)(((uint64_t)dd_random_next(rng) * (uint32_t)limit) >> 32);
+}
+
+#endif
@@ -0,0 +1,35 @@
+/**
+ * @typedef DDSound
+ * @brief   Defines the handles of every sound effect Dart Dodger
+ *          plays, as indexes into the DDSoundBank.
+ */
+typedef enum DDSound
+{
+    DDSOUND_SLIDEPAST,      //!< Balloon jiggled by a near miss
+    DDSOUND_LOSELIFE,       //!< Balloon popped by a dart
+    DDSOUND_NEWROUND,       //!< Balloon patched by a health kit
+    DDSOUND_DYING,          //!< Balloon falling with no patches left
+    DDSOUND_DIE,            //!< Game over
+    DDSOUND_MENU,           //!< Game paused or resumed
+    DDSOUND_COUNT           //!< Number of sound effects in the bank
+} DDSound;
+
+/**
+ * @class   DDSoundBank
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the process-wide bank of sound effects, each loaded
+ *          once up front and then played, stopped and polled through
+ *          its DDSound handle without any loading or name lookups.
+ */
+#import <Foundation/Foundation.h>
+
+@interface DDSoundBank : NSObject
+
+// Declare methods
++(void) preload;
++(void) play:(DDSound) sound;
++(void) stop:(DDSound) sound;
++(BOOL) isPlaying:(DDSound) sound;
+
+@end
@@ -0,0 +1,83 @@
+/**
+ * @class   DDSoundBank
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines the process-wide bank of sound effects, played
+ *          through DDSound handles.
+ */
+
+// Import SwinGame Framework
+#import "SwinGame.h"
+
+// Import my interface
+#import "DDSoundBank.h"
+
+/**
+ * @brief   Declare the file of each sound effect, in DDSound order
+ */
+static NSString* const _files[DDSOUND_COUNT] =
+{
+    @"slidepast-1.ogg",     // DDSOUND_SLIDEPAST
+    @"loselife-1.ogg",      // DDSOUND_LOSELIFE
+    @"newround.ogg",        // DDSOUND_NEWROUND
+    @"die-1.ogg",           // DDSOUND_DYING
+    @"die-2.ogg",           // DDSOUND_DIE
+    @"menu.ogg"             // DDSOUND_MENU
+};
+
+/**
+ * @brief   Declare the loaded sound effects as a static variable;
+ *          the bank is shared by the whole process
+ */
+static SGSoundEffect* _effects[DDSOUND_COUNT];
+
+@implementation DDSoundBank
+
+/**
+ * @brief   Loads every sound effect in the bank (once; later
+ *          calls do nothing). Must be called after audio is
+ *          opened and before any sound is played.
+ */
++(void) preload
+{
+    for (int i = 0; i < DDSOUND_COUNT; i++)
+    {
+        if (!_effects[i])
+        {
+            _effects[i] = [[SGSoundEffect alloc] initWithName:_files[i] fromFile:_files[i]];
+        }
+    }
+}
+
+/**
+ * @brief   Plays a sound effect once
+ * @param   sound
+ *          Handle of the sound effect
+ */
++(void) play:(DDSound) sound
+{
+    [_effects[sound] play];
+}
+
+/**
+ * @brief   Stops a sound effect if it is playing
+ * @param   sound
+ *          Handle of the sound effect
+ */
++(void) stop:(DDSound) sound
+{
+    [_effects[sound] stop];
+}
+
+/**
+ * @brief   Checks whether a sound effect is playing
+ * @param   sound
+ *          Handle of the sound effect
+ * @return  YES if the sound effect is playing
+ */
++(BOOL) isPlaying:(DDSound) sound
+{
+    return [_effects[sound] isPlaying];
+}
+
+@end
@@ -11,6 +11,12 @@
 // Import DDDirection Enumeration
 #import "DDDirection.h"
 
+// Import SwinGame types (point2d)
+#import "Types.h"
+
+// Import the atlas regions and batches sprites draw through
+#import "DDAtlas.h"
+
 // Forward reference classes referenced in interface
 @class SGPoint2D, SGBitmap;
 @class DDGame;
@@ -19,10 +25,25 @@
 {
     // Declare ivars
     SGBitmap*   _bitmap;    //!< The SwinGame bitmap that is drawn to the screen on the
-                            //!< invocation of this sprite's draw method
+                            //!< invocation of this sprite's draw method (shared through
+                            //!< DDBitmapCache with every sprite drawing the same file)
+    const DDAtlasRegion* _region;   //!< Defines where _bitmap was packed in the atlas, or
+                                    //!< NULL if it is drawn by itself
     SGPoint2D*  _position;  //!< Defines the current position of this sprite on the screen
                             //!< where the origin is at the top left of the bitmap
     DDGame*     _game;      //!< Defines the current game this sprite exists within
+    point2d     _lastPosition;  //!< Defines where this sprite was at the start of the
+                                //!< current simulation tick, so it can be drawn part
+                                //!< way between ticks
+    BOOL        _active;        //!< Defines whether this sprite is in play; inactive
+                                //!< sprites stay on the canvas but are not drawn
+    rectangle   _drawnBounds;   //!< Defines where this sprite was last drawn on screen
+                                //!< (empty if it was not drawn), so DDCanvas knows what
+                                //!< to redraw when it moves
+    NSUInteger  _bucketIndex;   //!< Defines where this sprite is in DDCanvas' bucket of
+                                //!< sprites of its class, so it is removed without a search
+    NSUInteger  _addedOrder;    //!< Defines when this sprite was added to DDCanvas, which
+                                //!< the bucket (in no order) doesn't keep
 }
 
 // Declare properties
@@ -38,6 +59,20 @@
                                             //!<   - DDCanvas in debug mode to label the name
                                             //!<     and other details of the sprite under
                                             //!<     its centre
+@property (readonly)  point2d    centrePoint;   //!< The centre as a point2d, without
+                                                //!< allocating a wrapper, for checks made
+                                                //!< every frame
+
+@property             BOOL       active;    //!< Allows access to whether the sprite is
+                                            //!< in play, used by DDDartPool to park
+                                            //!< darts without removing them from the
+                                            //!< canvas
+@property             rectangle  drawnBounds;   //!< Allows access to where the sprite was
+                                                //!< last drawn, kept by DDCanvas
+@property             NSUInteger bucketIndex;   //!< Allows access to where the sprite is
+                                                //!< in its class' bucket, kept by DDCanvas
+@property             NSUInteger addedOrder;    //!< Allows access to when the sprite was
+                                                //!< added to DDCanvas, kept by DDCanvas
 
 // Declare methods
 -(id)   initWithBitmapFile:(NSString*)fileName atX:(int)xPos atY:(int)yPos
@@ -46,5 +81,9 @@
 -(id)   initWithBitmapFile:(NSString*)fileName atStaticY:(int)yPos inGame:(DDGame*) game;
 -(void) kill;
 -(void) draw;
+-(void) drawWithInterpolation:(float) alpha;
+-(void) drawWithInterpolation:(float) alpha inBatch:(DDBatch*) batch;
+-(rectangle) boundsWithInterpolation:(float) alpha;
+-(void) savePosition;
 
 @end
@@ -8,16 +8,29 @@
 
 // Import SwinGame Framework
 #import "SwinGame.h"
+#import "GeometryInline.h"
 
 // Import my interface
 #import "DDSprite.h"
 #import "DDGame.h"
 #import "DDCanvas.h"
+#import "DDBitmapCache.h"
+
+/**
+ * @brief   Largest move (in pixels) in a single tick that is drawn
+ *          interpolated; bigger moves are wraps or respawns and are
+ *          drawn where they land
+ */
+#define DD_MAX_INTERPOLATED_MOVE 50
 
 @implementation DDSprite
 
 // Sythesize ivars.
 @synthesize position = _position;
+@synthesize active   = _active;
+@synthesize drawnBounds = _drawnBounds;
+@synthesize bucketIndex = _bucketIndex;
+@synthesize addedOrder  = _addedOrder;
 
 // Manual sythesis of centre
 /**
@@ -29,8 +42,18 @@
  */
 -(SGPoint2D*) centre
 {
-    return [SGGeometry pointAtX:_position.x + _bitmap.width /2
-                              y:_position.y + _bitmap.height/2];
+    return [SGPoint2D point2DForData:[self centrePoint]];
+}
+
+/**
+ * @brief   Calculates the centrepoint of the sprite as
+ *          centre does, but by value
+ * @return  The centrepoint of the sprite's _bitmap
+ */
+-(point2d) centrePoint
+{
+    return [SGGeometry pointDataAtX:_position.x + _bitmap.width /2
+                                  y:_position.y + _bitmap.height/2];
 }
 -(void) setCentre:(SGPoint2D *)centre
 {
@@ -48,9 +71,12 @@
 {
     if (self = [super init])
     {
-        _bitmap     = [[SGBitmap alloc] initWithName:fileName fromFile:fileName];
+        _bitmap     = [DDBitmapCache bitmapNamed:fileName];
+        _region     = [DDBitmapCache atlasRegionOfBitmap:_bitmap];
         _position   = [[SGPoint2D alloc] initAtX:xPos - _bitmap.width/2
                                                y:yPos - _bitmap.height/2];
+        _lastPosition = _position.data;
+        _active     = YES;
         // Automatically add me to the game canvas' sprites
         _game = game;
         [game addSprite:self];
@@ -70,11 +96,14 @@
 {
     if (self = [super init])
     {
-        int yPos    = [SGUtils rndUpto:[SGGraphics screenHeight]];
+        int yPos    = dd_random_upto(game.rng, [SGGraphics screenHeight]);
         // Initialise ivars
-        _bitmap     = [[SGBitmap alloc] initWithName:fileName fromFile:fileName];
+        _bitmap     = [DDBitmapCache bitmapNamed:fileName];
+        _region     = [DDBitmapCache atlasRegionOfBitmap:_bitmap];
         _position   = [[SGPoint2D alloc] initAtX:xPos - _bitmap.width/2
                                                y:yPos - _bitmap.height/2];
+        _lastPosition = _position.data;
+        _active     = YES;
         // Automatically add me to the game canvas' sprites
         _game = game;
         [game addSprite:self];
@@ -93,11 +122,14 @@
 -(id) initWithBitmapFile:(NSString *)fileName atStaticY:(int)yPos inGame:(DDGame*) game {
     if (self = [super init])
     {
-        int xPos    = [SGUtils rndUpto:[SGGraphics screenWidth]];
+        int xPos    = dd_random_upto(game.rng, [SGGraphics screenWidth]);
         // Initialise ivars
-        _bitmap     = [[SGBitmap alloc] initWithName:fileName fromFile:fileName];
+        _bitmap     = [DDBitmapCache bitmapNamed:fileName];
+        _region     = [DDBitmapCache atlasRegionOfBitmap:_bitmap];
         _position   = [[SGPoint2D alloc] initAtX:xPos - _bitmap.width/2
                                                y:yPos - _bitmap.height/2];
+        _lastPosition = _position.data;
+        _active     = YES;
         // Automatically add me to the game canvas' sprites
         _game = game;
         [game addSprite:self];
@@ -106,8 +138,20 @@
 }
 
 /**
- * @brief   Tells the canvas who I belong to to remove me and
- *          releases me.
+ * @brief   Hands my bitmap back to the bitmap cache and releases
+ *          my position
+ */
+-(void) dealloc
+{
+    [DDBitmapCache releaseBitmap:_bitmap];
+    [_position release];
+    [super dealloc];
+}
+
+/**
+ * @brief   Tells the game who I belong to to take me out of play;
+ *          I am removed from its canvas and released at the end
+ *          of the tick.
  */
 -(void) kill;
 {
@@ -124,4 +168,73 @@
     [SGImages draw:_bitmap onScreenAt:_position];
 }
 
+/**
+ * @brief   Draws the sprite's bitmap to screen part way between
+ *          where it was at the start of the last tick and where
+ *          it is now
+ * @param   alpha
+ *          Fraction of the way from the last position to the
+ *          current position (0 to 1)
+ */
+-(void) drawWithInterpolation:(float) alpha
+{
+    rectangle bounds = [self boundsWithInterpolation:alpha];
+    [SGImages draw:_bitmap onScreenAtX:bounds.x y:bounds.y];
+}
+
+/**
+ * @brief   Draws the sprite as drawWithInterpolation: does, but gathers
+ *          the draw into a batch if the bitmap was packed in the atlas
+ * @param   alpha
+ *          Fraction of the way from the last position to the
+ *          current position (0 to 1)
+ * @param   batch
+ *          The batch to gather the draw into; it is flushed first if
+ *          the sprite must be drawn by itself, to keep the draw order
+ */
+-(void) drawWithInterpolation:(float) alpha inBatch:(DDBatch*) batch
+{
+    rectangle bounds = [self boundsWithInterpolation:alpha];
+    if (_region)
+    {
+        dd_batch_add(batch, _region, bounds.x, bounds.y);
+    }
+    else
+    {
+        dd_batch_flush(batch);
+        [SGImages draw:_bitmap onScreenAtX:bounds.x y:bounds.y];
+    }
+}
+
+/**
+ * @brief   Works out where drawWithInterpolation: draws the sprite
+ * @param   alpha
+ *          Fraction of the way from the last position to the
+ *          current position (0 to 1)
+ * @return  The rectangle of screen the sprite's bitmap covers
+ */
+-(rectangle) boundsWithInterpolation:(float) alpha
+{
+    float dx = _position.x - _lastPosition.x;
+    float dy = _position.y - _lastPosition.y;
+    
+    // Jumped (wrapped around or respawned)? Don't smear it across the screen
+    if (fabsf(dx) > DD_MAX_INTERPOLATED_MOVE || fabsf(dy) > DD_MAX_INTERPOLATED_MOVE)
+    {
+        alpha = 1.0f;
+    }
+    
+    return rectangle_from_inline(_lastPosition.x + dx * alpha, _lastPosition.y + dy * alpha,
+                                 _bitmap.width, _bitmap.height);
+}
+
+/**
+ * @brief   Remembers the current position as the position at the
+ *          start of this simulation tick
+ */
+-(void) savePosition
+{
+    _lastPosition = _position.data;
+}
+
 @end
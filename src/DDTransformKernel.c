@@ -0,0 +1,475 @@
+/**
+ * @file    DDTransformKernel.c
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines batch matrix transforms that move many shapes at
+ *          once rather than one apply_matrix call at a time.
+ */
+
+#include <math.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define DD_TRANSFORM_X86 1
+#else
+#define DD_TRANSFORM_X86 0
+#endif
+
+#include "GeometryInline.h"
+#include "DDTransformKernel.h"
+
+/**
+ * @brief   A kernel: transforms count points held as separate x and y arrays
+ */
+typedef void (*DDTransformFunction)(const matrix2d *m, float *x, float *y, int count);
+
+/**
+ * @brief   Kernel transforms go through; -1 until the first transform picks one
+ */
+static int dd_transform_chosen = -1;
+
+/**
+ * @brief   Transforms one point, as SwinGame's ApplyMatrixToPoints would
+ * @param   m
+ *          The matrix to apply
+ * @param   x
+ *          X of the point, replaced with the transformed x
+ * @param   y
+ *          Y of the point, replaced with the transformed y
+ */
+static inline void dd_transform_point(const matrix2d *m, float *x, float *y)
+{
+    float px = *x, py = *y;
+    *x = px * m->elements[0][0] + py * m->elements[0][1] + m->elements[0][2];
+    *y = px * m->elements[1][0] + py * m->elements[1][1] + m->elements[1][2];
+}
+
+/**
+ * @brief   Transforms points one at a time
+ * @note    This is the fallback of dd_transform_points and the reference
+ *          it is checked against.
+ * @param   m
+ *          The matrix to apply
+ * @param   x
+ *          X of each point, replaced with the transformed x
+ * @param   y
+ *          Y of each point, replaced with the transformed y
+ * @param   count
+ *          Number of points
+ */
+void dd_transform_points_scalar(const matrix2d *m, float *x, float *y, int count)
+{
+    // Read once, as the points could (for all the compiler knows) overlap m
+    const float m00 = m->elements[0][0], m01 = m->elements[0][1], m02 = m->elements[0][2];
+    const float m10 = m->elements[1][0], m11 = m->elements[1][1], m12 = m->elements[1][2];
+
+    for (int i = 0; i < count; i++)
+    {
+        float px = x[i], py = y[i];
+        x[i] = px * m00 + py * m01 + m02;
+        y[i] = px * m10 + py * m11 + m12;
+    }
+}
+
+/**
+ * @brief   Gives the smallest rectangle around four transformed corners,
+ *          rounded as RectangleFromTriangle rounds
+ * @param   x
+ *          X of each corner
+ * @param   y
+ *          Y of each corner
+ * @return  The rectangle around them
+ */
+static rectangle dd_rectangle_around(const float *x, const float *y)
+{
+    // Compared directly, as fminf and fmaxf are library calls here
+    float minX = x[0], maxX = x[0], minY = y[0], maxY = y[0];
+    for (int p = 1; p < 4; p++)
+    {
+        minX = x[p] < minX ? x[p] : minX;   maxX = x[p] > maxX ? x[p] : maxX;
+        minY = y[p] < minY ? y[p] : minY;   maxY = y[p] > maxY ? y[p] : maxY;
+    }
+
+    // Rounded up as ceilf would, without the library call; a size is never
+    // negative, so truncating then adding one if anything was cut off does
+    int32_t width = (int32_t)(maxX - minX), height = (int32_t)(maxY - minY);
+    width  += (float)width < maxX - minX;
+    height += (float)height < maxY - minY;
+    return rectangle_from_inline(minX, minY, width, height);
+}
+
+#if DD_TRANSFORM_X86
+
+/**
+ * @brief   Transforms points four at a time
+ * @param   m
+ *          The matrix to apply
+ * @param   x
+ *          X of each point, replaced with the transformed x
+ * @param   y
+ *          Y of each point, replaced with the transformed y
+ * @param   count
+ *          Number of points
+ */
+__attribute__((target("sse")))
+static void dd_transform_points_sse(const matrix2d *m, float *x, float *y, int count)
+{
+    const __m128 m00 = _mm_set1_ps(m->elements[0][0]), m01 = _mm_set1_ps(m->elements[0][1]);
+    const __m128 m02 = _mm_set1_ps(m->elements[0][2]);
+    const __m128 m10 = _mm_set1_ps(m->elements[1][0]), m11 = _mm_set1_ps(m->elements[1][1]);
+    const __m128 m12 = _mm_set1_ps(m->elements[1][2]);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 px   = _mm_loadu_ps(&x[i]);
+        __m128 py   = _mm_loadu_ps(&y[i]);
+        _mm_storeu_ps(&x[i], _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, m00), _mm_mul_ps(py, m01)), m02));
+        _mm_storeu_ps(&y[i], _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, m10), _mm_mul_ps(py, m11)), m12));
+    }
+    for (; i < count; i++) dd_transform_point(m, &x[i], &y[i]);
+}
+
+/**
+ * @brief   Transforms points eight at a time
+ * @param   m
+ *          The matrix to apply
+ * @param   x
+ *          X of each point, replaced with the transformed x
+ * @param   y
+ *          Y of each point, replaced with the transformed y
+ * @param   count
+ *          Number of points
+ */
+__attribute__((target("avx")))
+static void dd_transform_points_avx(const matrix2d *m, float *x, float *y, int count)
+{
+    const __m256 m00 = _mm256_set1_ps(m->elements[0][0]), m01 = _mm256_set1_ps(m->elements[0][1]);
+    const __m256 m02 = _mm256_set1_ps(m->elements[0][2]);
+    const __m256 m10 = _mm256_set1_ps(m->elements[1][0]), m11 = _mm256_set1_ps(m->elements[1][1]);
+    const __m256 m12 = _mm256_set1_ps(m->elements[1][2]);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 px   = _mm256_loadu_ps(&x[i]);
+        __m256 py   = _mm256_loadu_ps(&y[i]);
+        _mm256_storeu_ps(&x[i], _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, m00),
+                                                            _mm256_mul_ps(py, m01)), m02));
+        _mm256_storeu_ps(&y[i], _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, m10),
+                                                            _mm256_mul_ps(py, m11)), m12));
+    }
+    for (; i < count; i++) dd_transform_point(m, &x[i], &y[i]);
+}
+
+#endif
+
+/**
+ * @brief   Checks whether this CPU can run a kernel
+ * @param   kernel
+ *          The kernel to check
+ * @return  Non-zero if it can
+ */
+static int dd_transform_supported(DDTransformKernel kernel)
+{
+    switch (kernel)
+    {
+        case DDTRANSFORM_SCALAR:    return 1;
+#if DD_TRANSFORM_X86
+        case DDTRANSFORM_SSE:       return __builtin_cpu_supports("sse");
+        case DDTRANSFORM_AVX:       return __builtin_cpu_supports("avx");
+#endif
+        default:                    return 0;
+    }
+}
+
+/**
+ * @brief   Gives the kernel transforms go through, picking the widest
+ *          the CPU supports the first time it is asked
+ * @return  The kernel in use
+ */
+DDTransformKernel dd_transform_kernel(void)
+{
+    int chosen = __atomic_load_n(&dd_transform_chosen, __ATOMIC_RELAXED);
+    if (chosen < 0)
+    {
+        chosen = DDTRANSFORM_AVX;
+        while (!dd_transform_supported((DDTransformKernel)chosen)) chosen--;
+        __atomic_store_n(&dd_transform_chosen, chosen, __ATOMIC_RELAXED);
+    }
+    return (DDTransformKernel)chosen;
+}
+
+/**
+ * @brief   Makes transforms go through a given kernel (e.g. to compare
+ *          them), if the CPU supports it
+ * @param   kernel
+ *          The kernel to use
+ * @return  0 if transforms now use it, -1 if the CPU cannot run it
+ */
+int dd_transform_use_kernel(DDTransformKernel kernel)
+{
+    if (!dd_transform_supported(kernel)) return -1;
+    __atomic_store_n(&dd_transform_chosen, (int)kernel, __ATOMIC_RELAXED);
+    return 0;
+}
+
+/**
+ * @brief   Names a kernel, for logs and benchmarks
+ * @param   kernel
+ *          The kernel to name
+ * @return  The kernel's name
+ */
+const char *dd_transform_kernel_name(DDTransformKernel kernel)
+{
+    switch (kernel)
+    {
+        case DDTRANSFORM_SSE:   return "SSE";
+        case DDTRANSFORM_AVX:   return "AVX";
+        default:                return "scalar";
+    }
+}
+
+/**
+ * @brief   Transforms points held as separate x and y arrays of any
+ *          length, through the widest kernel the CPU supports
+ * @param   m
+ *          The matrix to apply
+ * @param   x
+ *          X of each point, replaced with the transformed x
+ * @param   y
+ *          Y of each point, replaced with the transformed y
+ * @param   count
+ *          Number of points
+ */
+void dd_transform_points(const matrix2d *m, float *x, float *y, int count)
+{
+    DDTransformFunction transform = dd_transform_points_scalar;
+#if DD_TRANSFORM_X86
+    switch (dd_transform_kernel())
+    {
+        case DDTRANSFORM_AVX:   transform = dd_transform_points_avx;    break;
+        case DDTRANSFORM_SSE:   transform = dd_transform_points_sse;    break;
+        default:                                                        break;
+    }
+#endif
+    transform(m, x, y, count);
+}
+
+/**
+ * @brief   Transforms triangles one at a time, as apply_matrix does
+ * @note    What DDCollisionMask applyMatrix:toMasks: uses, as a batch
+ *          gains too little to make up for copying the points in and out.
+ * @param   m
+ *          The matrix to apply
+ * @param   tris
+ *          The triangles, transformed in place
+ * @param   count
+ *          Number of triangles
+ */
+void dd_transform_triangles(const matrix2d *m, triangle *tris, int count)
+{
+    for (int i = 0; i < count; i++) apply_matrix_inline(m, &tris[i]);
+}
+
+/**
+ * @brief   Transforms rectangles one at a time, leaving each as
+ *          dd_point_batch_get_rectangles would
+ * @note    What DDCollisionMask applyMatrix:toMasks: uses, as with
+ *          dd_transform_triangles.
+ * @param   m
+ *          The matrix to apply
+ * @param   rects
+ *          The rectangles, replaced with those around their transformed
+ *          corners
+ * @param   count
+ *          Number of rectangles
+ */
+void dd_transform_rectangles(const matrix2d *m, rectangle *rects, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float l = rectangle_left_inline(&rects[i]),  r = rectangle_right_inline(&rects[i]);
+        float t = rectangle_top_inline(&rects[i]),   b = rectangle_bottom_inline(&rects[i]);
+        float x[4] = { l, r, l, r }, y[4] = { t, t, b, b };
+        for (int p = 0; p < 4; p++) dd_transform_point(m, &x[p], &y[p]);
+        rects[i] = dd_rectangle_around(x, y);
+    }
+}
+
+/**
+ * @brief   Empties a batch, ready for shapes to be added
+ * @param   batch
+ *          The batch to empty
+ */
+void dd_point_batch_clear(DDPointBatch *batch)
+{
+    batch->count = 0;
+}
+
+/**
+ * @brief   Adds loose points to the end of a batch
+ * @param   batch
+ *          The batch to add to
+ * @param   pts
+ *          The points to add
+ * @param   count
+ *          Number of points
+ * @return  Index of the first point in the batch, or -1 (and nothing
+ *          added) if they do not all fit
+ */
+int dd_point_batch_add_points(DDPointBatch *batch, const point2d *pts, int count)
+{
+    if (batch->count + count > DD_POINT_BATCH_CAPACITY) return -1;
+
+    int first = batch->count;
+    for (int i = 0; i < count; i++)
+    {
+        batch->x[first + i] = pts[i].x;
+        batch->y[first + i] = pts[i].y;
+    }
+    batch->count += count;
+    return first;
+}
+
+/**
+ * @brief   Adds the points of triangles to the end of a batch, three
+ *          per triangle
+ * @param   batch
+ *          The batch to add to
+ * @param   tris
+ *          The triangles to add
+ * @param   count
+ *          Number of triangles
+ * @return  Index of the first triangle's first point in the batch, or -1
+ *          (and nothing added) if they do not all fit
+ */
+int dd_point_batch_add_triangles(DDPointBatch *batch, const triangle *tris, int count)
+{
+    if (batch->count + 3 * count > DD_POINT_BATCH_CAPACITY) return -1;
+
+    int first = batch->count;
+    float *x = &batch->x[first], *y = &batch->y[first];
+    for (int i = 0; i < count; i++)
+    {
+        for (int p = 0; p < 3; p++)
+        {
+            x[3 * i + p] = tris[i].points[p].x;
+            y[3 * i + p] = tris[i].points[p].y;
+        }
+    }
+    batch->count += 3 * count;
+    return first;
+}
+
+/**
+ * @brief   Adds the corners of rectangles to the end of a batch, four
+ *          per rectangle
+ * @param   batch
+ *          The batch to add to
+ * @param   rects
+ *          The rectangles to add
+ * @param   count
+ *          Number of rectangles
+ * @return  Index of the first rectangle's first corner in the batch, or
+ *          -1 (and nothing added) if they do not all fit
+ */
+int dd_point_batch_add_rectangles(DDPointBatch *batch, const rectangle *rects, int count)
+{
+    if (batch->count + 4 * count > DD_POINT_BATCH_CAPACITY) return -1;
+
+    int first = batch->count;
+    float *x = &batch->x[first], *y = &batch->y[first];
+    for (int i = 0; i < count; i++)
+    {
+        float l = rectangle_left_inline(&rects[i]),  r = rectangle_right_inline(&rects[i]);
+        float t = rectangle_top_inline(&rects[i]),   b = rectangle_bottom_inline(&rects[i]);
+        x[4 * i]     = l;   y[4 * i]     = t;
+        x[4 * i + 1] = r;   y[4 * i + 1] = t;
+        x[4 * i + 2] = l;   y[4 * i + 2] = b;
+        x[4 * i + 3] = r;   y[4 * i + 3] = b;
+    }
+    batch->count += 4 * count;
+    return first;
+}
+
+/**
+ * @brief   Copies points out of a batch
+ * @param   batch
+ *          The batch to copy from
+ * @param   first
+ *          Index of the first point to copy
+ * @param   pts
+ *          Where to copy the points to
+ * @param   count
+ *          Number of points
+ */
+void dd_point_batch_get_points(const DDPointBatch *batch, int first, point2d *pts, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        pts[i].x = batch->x[first + i];
+        pts[i].y = batch->y[first + i];
+    }
+}
+
+/**
+ * @brief   Copies triangles out of a batch
+ * @param   batch
+ *          The batch to copy from
+ * @param   first
+ *          Index of the first triangle's first point
+ * @param   tris
+ *          Where to copy the triangles to
+ * @param   count
+ *          Number of triangles
+ */
+void dd_point_batch_get_triangles(const DDPointBatch *batch, int first, triangle *tris,
+                                  int count)
+{
+    const float *x = &batch->x[first], *y = &batch->y[first];
+    for (int i = 0; i < count; i++)
+    {
+        for (int p = 0; p < 3; p++)
+        {
+            tris[i].points[p].x = x[3 * i + p];
+            tris[i].points[p].y = y[3 * i + p];
+        }
+    }
+}
+
+/**
+ * @brief   Gives the bounds of rectangles' corners in a batch, as the
+ *          rectangles the transformed rectangles now cover
+ * @note    A rotated rectangle has no exact SwinGame rectangle, so this
+ *          gives the smallest one around it, rounded as
+ *          RectangleFromTriangle rounds.
+ * @param   batch
+ *          The batch to copy from
+ * @param   first
+ *          Index of the first rectangle's first corner
+ * @param   rects
+ *          Where to put the rectangles
+ * @param   count
+ *          Number of rectangles
+ */
+void dd_point_batch_get_rectangles(const DDPointBatch *batch, int first, rectangle *rects,
+                                   int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        rects[i] = dd_rectangle_around(&batch->x[first + 4 * i], &batch->y[first + 4 * i]);
+    }
+}
+
+/**
+ * @brief   Transforms every point in a batch
+ * @param   batch
+ *          The batch to transform
+ * @param   m
+ *          The matrix to apply
+ */
+void dd_point_batch_transform(DDPointBatch *batch, const matrix2d *m)
+{
+    dd_transform_points(m, batch->x, batch->y, batch->count);
+}
@@ -0,0 +1,79 @@
+/**
+ * @file    DDTransformKernel.h
+ * @author  Alex Cummaudo
+ * @date    17 Oct 2026
+ * @brief   Defines batch matrix transforms that move many shapes at
+ *          once rather than one apply_matrix call at a time. Points
+ *          (loose, or the corners of triangles and rectangles) are
+ *          copied into a structure-of-arrays batch and transformed
+ *          eight (AVX) or four (SSE) at a time, picked by what the CPU
+ *          running the game supports. This pays for long runs of loose
+ *          points; for shapes, copying them in and out costs about what
+ *          the vectors save, so DDCollisionMask transforms its masks one
+ *          at a time with dd_transform_triangles and
+ *          dd_transform_rectangles instead.
+ * @note    Each point comes out exactly as SwinGame's ApplyMatrix would
+ *          leave it (the kernels multiply and add in the same order and
+ *          never fuse the two), so a batch can stand in for a loop of
+ *          apply_matrix calls.
+ */
+
+#ifndef DDTransformKernel_h
+#define DDTransformKernel_h
+
+// Import SwinGame types (for matrix2d, triangle, rectangle and point2d)
+#include "Types.h"
+
+/**
+ * @brief   Most points a DDPointBatch can hold (a multiple of eight, so
+ *          a full batch is a whole number of vectors)
+ */
+#define DD_POINT_BATCH_CAPACITY 1024
+
+/**
+ * @enum    DDTransformKernel
+ * @brief   The ways a transform can be carried out
+ */
+typedef enum DDTransformKernel
+{
+    DDTRANSFORM_SCALAR, //!< One point at a time
+    DDTRANSFORM_SSE,    //!< Four points at a time
+    DDTRANSFORM_AVX     //!< Eight points at a time
+} DDTransformKernel;
+
+/**
+ * @struct  DDPointBatch
+ * @brief   Points laid out as one array per coordinate so that several
+ *          can be transformed at once. Triangles take three points each
+ *          (in order) and rectangles four (their top left, top right,
+ *          bottom left and bottom right corners, as PointsFromRect gives
+ *          them).
+ */
+typedef struct DDPointBatch
+{
+    float   x[DD_POINT_BATCH_CAPACITY]; //!< X of each point
+    float   y[DD_POINT_BATCH_CAPACITY]; //!< Y of each point
+    int     count;                      //!< Number of points in the batch
+} DDPointBatch;
+
+void    dd_point_batch_clear(DDPointBatch *batch);
+int     dd_point_batch_add_points(DDPointBatch *batch, const point2d *pts, int count);
+int     dd_point_batch_add_triangles(DDPointBatch *batch, const triangle *tris, int count);
+int     dd_point_batch_add_rectangles(DDPointBatch *batch, const rectangle *rects, int count);
+void    dd_point_batch_get_points(const DDPointBatch *batch, int first, point2d *pts, int count);
+void    dd_point_batch_get_triangles(const DDPointBatch *batch, int first, triangle *tris,
+                                     int count);
+void    dd_point_batch_get_rectangles(const DDPointBatch *batch, int first, rectangle *rects,
+                                      int count);
+void    dd_point_batch_transform(DDPointBatch *batch, const matrix2d *m);
+
+void    dd_transform_points(const matrix2d *m, float *x, float *y, int count);
+void    dd_transform_triangles(const matrix2d *m, triangle *tris, int count);
+void    dd_transform_rectangles(const matrix2d *m, rectangle *rects, int count);
+void    dd_transform_points_scalar(const matrix2d *m, float *x, float *y, int count);
+
+DDTransformKernel   dd_transform_kernel(void);
+int                 dd_transform_use_kernel(DDTransformKernel kernel);
+const char          *dd_transform_kernel_name(DDTransformKernel kernel);
+
+#endif
@@ -6,6 +6,8 @@
 #import "DDCanvas.h"
 #import "DDGame.h"
 #import "DDController.h"
+#import "DDBitmapCache.h"
+#import "DDMemory.h"
 
 int main()
 {
@@ -22,15 +24,60 @@ int main()
         // Create a new Game Controller
         DDController* controller = [[DDController alloc] init];
         
+        // Replay (DD_REPLAY) or record (DD_RECORD) an input log?
+        NSDictionary* env = [[NSProcessInfo processInfo] environment];
+        if      ([env objectForKey:@"DD_REPLAY"])
+        {
+            if (![controller replayFromFile:[env objectForKey:@"DD_REPLAY"]]) { return 1; }
+        }
+        else if ([env objectForKey:@"DD_RECORD"])
+        {
+            [controller recordToFile:[env objectForKey:@"DD_RECORD"]];
+        }
+        
+        // Let the autopilot play (DD_AUTOPILOT), for soak runs? (Recorded
+        // like any other input, so a soak run can be replayed)
+        controller.autopilot = [env objectForKey:@"DD_AUTOPILOT"] != nil;
+        
+        // Draw sprites in batches from a texture atlas (DD_ATLAS)? Off by
+        // default, as drawing each from its own bitmap measures faster
+        [DDBitmapCache setAtlasEnabled:[env objectForKey:@"DD_ATLAS"] != nil];
         
         [controller newGame];
         
-        while (![SGInput windowCloseRequested])
+        // Watch the memory each frame allocates, and what stays in use
+        DDMemoryMonitor memory;
+        dd_memory_init(&memory, DD_MEMORY_FRAME_BUDGET);
+        
+        while (![SGInput windowCloseRequested] && !controller.finished)
         {
-            [SGInput processEvents];
-            [controller update];
+            // Drain each frame's temporaries (such as the framework's
+            // autoreleased points and rectangles) at the end of the frame,
+            // rather than keeping every one until the game quits
+            @autoreleasepool
+            {
+                int events = dd_memory_frame_begin(&memory);
+                
+                [SGInput processEvents];
+                [controller update];
+                
+                events |= dd_memory_frame_end(&memory);
+                if (events & DD_MEMORY_WORST_FRAME)
+                {
+                    NSLog(@"Frame %llu allocated %zu bytes (budget %zu)",
+                          (unsigned long long)memory.frames, memory.frameBytes, memory.budget);
+                }
+                if (events & DD_MEMORY_HIGH_WATER)
+                {
+                    NSLog(@"Memory in use between frames reached %zu bytes", memory.highWater);
+                }
+            }
         }
+        NSLog(@"Memory: %llu of %llu frames over budget, worst %zu bytes, high water %zu bytes",
+              (unsigned long long)memory.overBudget, (unsigned long long)memory.frames,
+              memory.worstFrame, memory.highWater);
         
+        [controller endSession];
         [controller release];
         [SGAudio closeAudio];
         [SGResources releaseAllResources];